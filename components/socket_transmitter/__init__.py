@@ -3,6 +3,15 @@ from esphome import codegen as cg
 from esphome import automation
 from esphome.const import CONF_ID, CONF_IP_ADDRESS, CONF_PORT, CONF_PROTOCOL, CONF_DATA
 
+CONF_QUEUE_SIZE = "queue_size"
+CONF_FRAMED = "framed"
+CONF_PERSISTENT = "persistent"
+CONF_BATCH_SIZE = "batch_size"
+CONF_BATCH_TIMEOUT = "batch_timeout"
+CONF_STORE_PATH = "store_path"
+CONF_STORE_SIZE = "store_size"
+CONF_REPLAY_RATE = "replay_rate"
+
 AUTO_LOAD = ["socket"]
 
 MULTI_CONF = True
@@ -15,6 +24,9 @@ SocketTransmitter = socket_ns.class_("SocketTransmitter", cg.Component)
 SocketTransmitterSendAction = socket_ns.class_(
     "SocketTransmitterSendAction", automation.Action
 )
+SocketTransmitterFlushAction = socket_ns.class_(
+    "SocketTransmitterFlushAction", automation.Action
+)
 
 CONFIG_SCHEMA = cv.Schema(
     {
@@ -28,6 +40,17 @@ CONFIG_SCHEMA = cv.Schema(
             },
             upper=True,
         ),
+        cv.Optional(CONF_QUEUE_SIZE, default=16): cv.int_range(min=1, max=10000),
+        cv.Optional(CONF_STORE_PATH): cv.string_strict,
+        cv.Optional(CONF_STORE_SIZE, default=1000): cv.int_range(min=1, max=100000),
+        cv.Optional(CONF_REPLAY_RATE, default=10): cv.int_range(min=0, max=1000),
+        cv.Optional(CONF_FRAMED, default=False): cv.boolean,
+        # Defaults to framed, plain TCP messages are only delimited by their connection.
+        cv.Optional(CONF_PERSISTENT): cv.boolean,
+        cv.Optional(CONF_BATCH_SIZE, default=1400): cv.int_range(min=64, max=65535),
+        cv.Optional(
+            CONF_BATCH_TIMEOUT, default="100ms"
+        ): cv.positive_time_period_milliseconds,
     }
 )
 
@@ -37,6 +60,17 @@ async def to_code(config):
     cg.add(var.set_host(config[CONF_IP_ADDRESS]))
     cg.add(var.set_port(config[CONF_PORT]))
     cg.add(var.set_protocol(config[CONF_PROTOCOL]))
+    cg.add(var.set_queue_size(config[CONF_QUEUE_SIZE]))
+    cg.add(var.set_replay_rate(config[CONF_REPLAY_RATE]))
+    if CONF_STORE_PATH in config:
+        cg.add(var.set_store_path(config[CONF_STORE_PATH]))
+        cg.add(var.set_store_size(config[CONF_STORE_SIZE]))
+    if config.get(CONF_PERSISTENT, config[CONF_FRAMED]):
+        cg.add(var.set_persistent(True))
+    if config[CONF_FRAMED]:
+        cg.add(var.set_framed(True))
+        cg.add(var.set_batch_size(config[CONF_BATCH_SIZE]))
+        cg.add(var.set_batch_timeout(config[CONF_BATCH_TIMEOUT]))
 
     await cg.register_component(var, config)
 
@@ -62,3 +96,18 @@ async def socket_transmitter_send_to_code(config, action_id, template_arg, args)
     cg.add(var.set_data(template_))
 
     return var
+
+
+SOCKET_FLUSH_ACTION_SCHEMA = automation.maybe_simple_id(
+    {
+        cv.GenerateID(): cv.use_id(SocketTransmitter),
+    }
+)
+
+
+@automation.register_action(
+    "socket_transmitter.flush", SocketTransmitterFlushAction, SOCKET_FLUSH_ACTION_SCHEMA
+)
+async def socket_transmitter_flush_to_code(config, action_id, template_arg, args):
+    paren = await cg.get_variable(config[CONF_ID])
+    return cg.new_Pvariable(action_id, template_arg, paren)
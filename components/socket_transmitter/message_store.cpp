@@ -0,0 +1,361 @@
+#include "message_store.h"
+
+#include <algorithm>
+
+#include "esphome/core/log.h"
+
+namespace esphome
+{
+    namespace socket_transmitter
+    {
+        static const char *TAG = "socket_transmitter.store";
+
+        static const uint32_t FILE_RECORD_HEADER_SIZE = 4;
+        // The log is compacted before an append when the sent messages in front take more
+        // than this and more than the messages still waiting.
+        static const uint32_t FILE_COMPACT_THRESHOLD = 16 * 1024;
+
+        static void put_u32(uint8_t *p, uint32_t v)
+        {
+            p[0] = v >> 24;
+            p[1] = v >> 16;
+            p[2] = v >> 8;
+            p[3] = v;
+        }
+
+        static uint32_t get_u32(const uint8_t *p)
+        {
+            return (uint32_t)p[0] << 24 | (uint32_t)p[1] << 16 | (uint32_t)p[2] << 8 | p[3];
+        }
+
+        size_t RamMessageStore::push(std::string message)
+        {
+            size_t evicted = 0;
+            while (this->messages_.size() >= this->capacity_)
+            {
+                this->messages_.pop_front();
+                evicted++;
+            }
+            this->messages_.push_back(std::move(message));
+            return evicted;
+        }
+
+        const std::string *RamMessageStore::front()
+        {
+            return this->messages_.empty() ? nullptr : &this->messages_.front();
+        }
+
+        void RamMessageStore::pop()
+        {
+            if (!this->messages_.empty())
+                this->messages_.pop_front();
+        }
+
+        FileMessageLog::~FileMessageLog()
+        {
+            if (this->file_)
+                fclose(this->file_);
+        }
+
+        bool FileMessageLog::open()
+        {
+            // A reboot during compaction leaves either the old log and a partial copy, or, when
+            // the log could not be renamed over, only the complete copy.
+            auto tmp_path = this->path_ + ".tmp";
+            if (FILE *log = fopen(this->path_.c_str(), "rb"))
+            {
+                fclose(log);
+                remove(tmp_path.c_str());
+            }
+            else
+                rename(tmp_path.c_str(), this->path_.c_str());
+
+            if (!this->open_file_())
+            {
+                ESP_LOGE(TAG, "Cannot open %s", this->path_.c_str());
+                return false;
+            }
+
+            if (FILE *head = fopen((this->path_ + ".head").c_str(), "rb"))
+            {
+                uint8_t offset[4];
+                if (fread(offset, 1, sizeof(offset), head) == sizeof(offset))
+                    this->head_ = get_u32(offset);
+                fclose(head);
+            }
+            this->saved_head_ = this->head_;
+
+            if (fseek(this->file_, 0, SEEK_END) != 0)
+                return false;
+            uint32_t size = ftell(this->file_);
+            // Without a valid head the log is read from its start, repeating rather than losing messages.
+            if (this->head_ > size)
+                this->head_ = 0;
+
+            // Index the messages left from before, a torn tail is dropped.
+            uint32_t offset = this->head_;
+            while (offset + FILE_RECORD_HEADER_SIZE <= size)
+            {
+                uint8_t length[FILE_RECORD_HEADER_SIZE];
+                if (fseek(this->file_, offset, SEEK_SET) != 0 || fread(length, 1, sizeof(length), this->file_) != sizeof(length))
+                    break;
+                auto length_value = get_u32(length);
+                if (length_value > size - offset - FILE_RECORD_HEADER_SIZE)
+                    break;
+                this->lengths_.push_back(length_value);
+                offset += FILE_RECORD_HEADER_SIZE + length_value;
+            }
+            this->end_ = offset;
+
+            if (this->lengths_.empty())
+                this->clear_();
+            else
+            {
+                ESP_LOGI(TAG, "Restored %zu messages from %s", this->lengths_.size(), this->path_.c_str());
+                if (this->end_ < size)
+                    this->compact_();
+            }
+            return true;
+        }
+
+        bool FileMessageLog::append(const std::string &message)
+        {
+            if (!this->file_ && !this->open_file_())
+            {
+                ESP_LOGW(TAG, "Cannot open %s", this->path_.c_str());
+                return false;
+            }
+
+            if (fseek(this->file_, 0, SEEK_END) != 0)
+                return false;
+            // A failed append may have left a torn record, which is dropped before the next one.
+            // The sent messages are dropped too once they take most of the file. A drain alone
+            // never rewrites the file, it is removed once empty.
+            bool torn = (uint32_t)ftell(this->file_) != this->end_;
+            if ((torn || (this->head_ > FILE_COMPACT_THRESHOLD && this->head_ > this->end_ - this->head_)) && !this->compact_() && torn)
+                return false;
+
+            uint8_t length[FILE_RECORD_HEADER_SIZE];
+            put_u32(length, message.size());
+            if (fseek(this->file_, 0, SEEK_END) != 0 ||
+                fwrite(length, 1, sizeof(length), this->file_) != sizeof(length) ||
+                fwrite(message.data(), 1, message.size(), this->file_) != message.size())
+            {
+                ESP_LOGW(TAG, "Failed to write %s", this->path_.c_str());
+                return false;
+            }
+            this->end_ += FILE_RECORD_HEADER_SIZE + message.size();
+            this->lengths_.push_back(message.size());
+            this->unflushed_ = true;
+            return true;
+        }
+
+        const std::string *FileMessageLog::front()
+        {
+            if (this->lengths_.empty())
+                return nullptr;
+            if (!this->front_loaded_)
+            {
+                this->front_.resize(this->lengths_.front());
+                if (fseek(this->file_, this->head_ + FILE_RECORD_HEADER_SIZE, SEEK_SET) != 0 ||
+                    fread(&this->front_[0], 1, this->front_.size(), this->file_) != this->front_.size())
+                {
+                    ESP_LOGW(TAG, "Failed to read %s", this->path_.c_str());
+                    return nullptr;
+                }
+                this->front_loaded_ = true;
+            }
+            return &this->front_;
+        }
+
+        void FileMessageLog::pop()
+        {
+            if (this->lengths_.empty())
+                return;
+
+            this->head_ += FILE_RECORD_HEADER_SIZE + this->lengths_.front();
+            this->lengths_.pop_front();
+            this->front_loaded_ = false;
+
+            if (this->lengths_.empty())
+                this->clear_();
+        }
+
+        void FileMessageLog::save()
+        {
+            if (!this->file_)
+                return;
+            if (this->unflushed_)
+            {
+                if (fflush(this->file_) != 0)
+                    ESP_LOGW(TAG, "Failed to write %s", this->path_.c_str());
+                this->unflushed_ = false;
+            }
+            if (this->head_ != this->saved_head_ && this->write_head_(this->head_))
+                this->saved_head_ = this->head_;
+        }
+
+        bool FileMessageLog::open_file_()
+        {
+            // Appends always go to the end, reads seek to the head.
+            this->file_ = fopen(this->path_.c_str(), "a+b");
+            return this->file_ != nullptr;
+        }
+
+        bool FileMessageLog::write_head_(uint32_t head)
+        {
+            uint8_t offset[4];
+            put_u32(offset, head);
+            FILE *file = fopen((this->path_ + ".head").c_str(), "wb");
+            bool written = file && fwrite(offset, 1, sizeof(offset), file) == sizeof(offset);
+            if (file && fclose(file) != 0)
+                written = false;
+            if (!written)
+                ESP_LOGW(TAG, "Failed to write %s.head", this->path_.c_str());
+            return written;
+        }
+
+        bool FileMessageLog::compact_()
+        {
+            // The waiting messages are copied to a new file, which then replaces the log. The
+            // log is never written in place, a reboot finds the old or the new one complete.
+            auto tmp_path = this->path_ + ".tmp";
+            FILE *tmp = fopen(tmp_path.c_str(), "wb");
+            bool copied = tmp != nullptr;
+            uint8_t chunk[256];
+            for (uint32_t from = this->head_; copied && from < this->end_;)
+            {
+                size_t n = std::min<size_t>(sizeof(chunk), this->end_ - from);
+                copied = fseek(this->file_, from, SEEK_SET) == 0 && fread(chunk, 1, n, this->file_) == n &&
+                         fwrite(chunk, 1, n, tmp) == n;
+                from += n;
+            }
+            if (tmp && fclose(tmp) != 0)
+                copied = false;
+
+            // The head is reset first: read from its start, the old log only repeats messages,
+            // while the new one read from the old head would skip some.
+            if (!copied || !this->write_head_(0))
+            {
+                ESP_LOGW(TAG, "Failed to compact %s", this->path_.c_str());
+                remove(tmp_path.c_str());
+                return false;
+            }
+            fclose(this->file_);
+            this->file_ = nullptr;
+            // Not every file system renames over an existing file.
+            if (rename(tmp_path.c_str(), this->path_.c_str()) != 0)
+            {
+                remove(this->path_.c_str());
+                rename(tmp_path.c_str(), this->path_.c_str());
+            }
+
+            this->end_ -= this->head_;
+            this->head_ = this->saved_head_ = 0;
+            this->unflushed_ = false;
+            this->front_loaded_ = false;
+            if (!this->open_file_())
+            {
+                ESP_LOGE(TAG, "Cannot open %s, dropped %zu messages", this->path_.c_str(), this->lengths_.size());
+                this->lengths_.clear();
+                this->end_ = 0;
+                return false;
+            }
+            return true;
+        }
+
+        void FileMessageLog::clear_()
+        {
+            // The head goes first, a log left without it is read from its start.
+            remove((this->path_ + ".head").c_str());
+            if (this->file_)
+                fclose(this->file_);
+            this->file_ = nullptr;
+            remove(this->path_.c_str());
+
+            this->head_ = this->end_ = this->saved_head_ = 0;
+            this->unflushed_ = false;
+            this->lengths_.clear();
+            this->front_loaded_ = false;
+        }
+
+        bool FileMessageStore::open()
+        {
+            if (!this->log_.open())
+                return false;
+            while (this->log_.size() > this->file_capacity_)
+                this->log_.pop();
+            return true;
+        }
+
+        size_t FileMessageStore::push(std::string message)
+        {
+            // The file holds the older messages, so new ones only go there while RAM is empty.
+            if (this->spilling_)
+                return this->append_(message);
+            if (this->ram_.size() < this->ram_capacity_)
+            {
+                this->ram_.push_back(std::move(message));
+                return 0;
+            }
+
+            auto evicted = this->append_(this->ram_.front());
+            this->ram_.pop_front();
+            this->ram_.push_back(std::move(message));
+            return evicted;
+        }
+
+        const std::string *FileMessageStore::front()
+        {
+            while (this->log_.size() > 0)
+            {
+                if (auto message = this->log_.front())
+                    return message;
+                // An unreadable message would block the queue.
+                this->log_.pop();
+            }
+            return this->ram_.empty() ? nullptr : &this->ram_.front();
+        }
+
+        void FileMessageStore::pop()
+        {
+            if (this->log_.size() > 0)
+                this->log_.pop();
+            else if (!this->ram_.empty())
+                this->ram_.pop_front();
+        }
+
+        bool FileMessageStore::full() const
+        {
+            return (this->spilling_ || this->ram_.size() >= this->ram_capacity_) && this->log_.size() >= this->file_capacity_;
+        }
+
+        size_t FileMessageStore::set_spilling(bool spilling)
+        {
+            this->spilling_ = spilling;
+            if (!spilling)
+                return 0;
+
+            size_t evicted = 0;
+            for (auto &message : this->ram_)
+                evicted += this->append_(message);
+            this->ram_.clear();
+            this->log_.save();
+            return evicted;
+        }
+
+        size_t FileMessageStore::append_(const std::string &message)
+        {
+            size_t evicted = 0;
+            while (this->log_.size() >= this->file_capacity_)
+            {
+                this->log_.pop();
+                evicted++;
+            }
+            // A message that cannot be written is lost, which counts like an eviction.
+            if (!this->log_.append(message))
+                evicted++;
+            return evicted;
+        }
+    }
+}
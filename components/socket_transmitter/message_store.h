@@ -0,0 +1,124 @@
+#pragma once
+#include <cstdint>
+#include <cstdio>
+#include <deque>
+#include <string>
+
+namespace esphome
+{
+    namespace socket_transmitter
+    {
+        // The messages waiting to be sent, oldest first.
+        class MessageStore
+        {
+        public:
+            virtual ~MessageStore() = default;
+
+            // Appends the message, evicting the oldest messages when the store is full.
+            // Returns the number of evicted messages.
+            virtual size_t push(std::string message) = 0;
+            // The oldest message, nullptr when empty. Valid until the next push or pop.
+            virtual const std::string *front() = 0;
+            virtual void pop() = 0;
+            virtual size_t size() const = 0;
+            // True when the next push evicts the oldest message.
+            virtual bool full() const = 0;
+            bool empty() const { return this->size() == 0; }
+
+            // While spilling, the messages are kept where they survive a reboot. Set while the
+            // collector is unreachable. Returns the number of evicted messages.
+            virtual size_t set_spilling(bool spilling) { return 0; }
+            // Writes out what is still buffered, called on a timer.
+            virtual void save() {}
+        };
+
+        class RamMessageStore : public MessageStore
+        {
+        public:
+            RamMessageStore(size_t capacity) : capacity_(capacity) {}
+
+            size_t push(std::string message) override;
+            const std::string *front() override;
+            void pop() override;
+            size_t size() const override { return this->messages_.size(); }
+            bool full() const override { return this->messages_.size() >= this->capacity_; }
+
+        protected:
+            size_t capacity_;
+            std::deque<std::string> messages_;
+        };
+
+        // An append-only log of messages in a file, each a big endian uint32 length and the
+        // data. Sent messages are skipped, not overwritten. The offset of the oldest message
+        // is kept as a big endian uint32 in <path>.head, written by save() only. Once the sent
+        // messages take most of the file, the waiting ones are copied to <path>.tmp, which
+        // then replaces the log. The file is removed when the log is drained.
+        class FileMessageLog
+        {
+        public:
+            FileMessageLog(std::string path) : path_(std::move(path)) {}
+            ~FileMessageLog();
+
+            // Indexes the messages left from before. False when the file cannot be opened.
+            bool open();
+            bool append(const std::string &message);
+            // The oldest message, nullptr when empty or unreadable. Valid until the next pop.
+            const std::string *front();
+            void pop();
+            size_t size() const { return this->lengths_.size(); }
+            // Flushes the appended messages and writes the head offset when it moved.
+            void save();
+
+        protected:
+            bool open_file_();
+            bool write_head_(uint32_t head);
+            bool compact_();
+            void clear_();
+
+            std::string path_;
+            FILE *file_{nullptr};
+
+            uint32_t head_{0};
+            uint32_t end_{0};
+            uint32_t saved_head_{0};
+            bool unflushed_{false};
+            std::deque<uint32_t> lengths_;
+            // The oldest message, read from the file on demand.
+            std::string front_;
+            bool front_loaded_{false};
+        };
+
+        // Keeps the messages in RAM like RamMessageStore, and moves them to a FileMessageLog
+        // while spilling or when more than ram_capacity are waiting, so a backlog survives a
+        // reboot, for example on a LittleFS partition. The messages in the file are always
+        // older than the ones in RAM, so the file is only written during an outage or a burst.
+        class FileMessageStore : public MessageStore
+        {
+        public:
+            FileMessageStore(std::string path, size_t ram_capacity, size_t file_capacity)
+                : log_(std::move(path)), ram_capacity_(ram_capacity), file_capacity_(file_capacity) {}
+
+            // Opens the file and restores the messages left from before. False when the file
+            // cannot be opened.
+            bool open();
+
+            size_t push(std::string message) override;
+            const std::string *front() override;
+            void pop() override;
+            size_t size() const override { return this->log_.size() + this->ram_.size(); }
+            bool full() const override;
+            size_t set_spilling(bool spilling) override;
+            void save() override { this->log_.save(); }
+
+        protected:
+            // Appends to the file, evicting its oldest messages when it is full.
+            size_t append_(const std::string &message);
+
+            FileMessageLog log_;
+            size_t ram_capacity_;
+            size_t file_capacity_;
+            std::deque<std::string> ram_;
+            bool spilling_{false};
+        };
+    }
+}
@@ -1,40 +1,387 @@
 #include "socket_transmitter.h"
 
+#include <algorithm>
+#include <cerrno>
+#include <cinttypes>
+
+#include "esphome/core/hal.h"
+
+#ifdef USE_SOCKET_IMPL_BSD_SOCKETS
+#include <sys/select.h>
+#endif
+
 namespace esphome
 {
     namespace socket_transmitter
     {
-        void SocketTransmitter::send(std::string data)
+        void SocketTransmitter::send(std::string &&data)
+        {
+            if (!this->framed)
+            {
+                this->enqueue_(std::move(data));
+                return;
+            }
+            struct iovec piece = {(void *)data.data(), data.size()};
+            this->send(&piece, 1);
+        }
+
+        void SocketTransmitter::send(const std::string &data)
         {
-            return this->send((uint8_t *)data.c_str(), data.length());
+            struct iovec piece = {(void *)data.data(), data.size()};
+            this->send(&piece, 1);
         }
 
-        void SocketTransmitter::send(std::vector<uint8_t> data)
+        void SocketTransmitter::send(const std::vector<uint8_t> &data)
         {
-            return this->send(data.data(), data.size());
+            struct iovec piece = {(void *)data.data(), data.size()};
+            this->send(&piece, 1);
         }
 
         void SocketTransmitter::send(const uint8_t *data, size_t length)
         {
-            ESP_LOGD(TAG, "Setting up socket transmitter");
+            struct iovec piece = {(void *)data, length};
+            this->send(&piece, 1);
+        }
+
+        void SocketTransmitter::send(const struct iovec *pieces, size_t count)
+        {
+            size_t length = 0;
+            for (size_t i = 0; i < count; i++)
+                length += pieces[i].iov_len;
+
+            if (!this->framed)
+            {
+                std::string data;
+                data.reserve(length);
+                for (size_t i = 0; i < count; i++)
+                    data.append((const char *)pieces[i].iov_base, pieces[i].iov_len);
+                this->enqueue_(std::move(data));
+                return;
+            }
+
+            if (length > UINT16_MAX - FRAMED_RECORD_HEADER_SIZE)
+            {
+                ESP_LOGE(TAG, "Record too large for framed mode [%zu bytes]", length);
+                return;
+            }
+            if (!this->batch.empty() && this->batch.size() + FRAMED_RECORD_HEADER_SIZE + length > this->batch_size)
+                this->flush();
+
+            if (this->batch.empty())
+            {
+                // The counts are filled in by flush().
+                this->batch.reserve(this->batch_size);
+                this->batch.append({'W', 'B', (char)FRAMED_VERSION, 0, 0, 0, 0, 0, 0, 0});
+                this->batch_started = millis();
+            }
+            this->batch.push_back(length >> 8);
+            this->batch.push_back(length & 0xff);
+            for (size_t i = 0; i < count; i++)
+                this->batch.append((const char *)pieces[i].iov_base, pieces[i].iov_len);
+            this->batch_records++;
+
+            if (this->batch_records == FRAMED_MAX_RECORDS || this->batch.size() >= this->batch_size)
+                this->flush();
+        }
+
+        void SocketTransmitter::flush()
+        {
+            if (this->batch.empty())
+                return;
+
+            size_t length = this->batch.size() - FRAMED_HEADER_SIZE;
+            this->batch[3] = this->batch_records;
+            this->batch[4] = length >> 8;
+            this->batch[5] = length & 0xff;
+            for (int i = 0; i < 4; i++)
+                this->batch[6 + i] = this->sequence >> (24 - 8 * i);
+            ESP_LOGV(TAG, "Flushing batch %" PRIu32 " of %zu records [%zu bytes]", this->sequence, this->batch_records, this->batch.size());
+            this->sequence++;
+
+            this->enqueue_(std::move(this->batch));
+            this->batch.clear();
+            this->batch_records = 0;
+        }
+
+        void SocketTransmitter::enqueue_(std::string &&data)
+        {
+            if (!this->store)
+            {
+                ESP_LOGW(TAG, "Not set up yet, dropped data");
+                return;
+            }
+
+            // A partially written front is finished from a copy when it is evicted,
+            // the stream would be corrupted without its tail.
+            if (this->front_written > 0 && !this->front_evicted && this->store->full())
+            {
+                this->evicted_front = *this->store->front();
+                this->front_evicted = true;
+            }
+
+            this->count_evicted_(this->store->push(std::move(data)));
+        }
+
+        void SocketTransmitter::count_evicted_(size_t evicted)
+        {
+            if (evicted == 0)
+                return;
+
+            this->replay_remaining -= std::min(this->replay_remaining, evicted);
+            this->evicted += evicted;
+            ESP_LOGW(TAG, "Send queue full, evicted the oldest data (%" PRIu32 " evicted)", this->evicted);
+        }
+
+        void SocketTransmitter::setup()
+        {
+            if (!this->store_path.empty())
+            {
+                auto store = std::make_unique<FileMessageStore>(this->store_path, this->queue_size, this->store_size);
+                if (store->open())
+                    this->store = std::move(store);
+                else
+                    ESP_LOGE(TAG, "Keeping the queue in RAM only");
+            }
+            if (!this->store)
+                this->store = std::make_unique<RamMessageStore>(this->queue_size);
+        }
+
+        void SocketTransmitter::loop()
+        {
+            if (!this->batch.empty() && millis() - this->batch_started >= this->batch_timeout)
+                this->flush();
+            if (millis() - this->last_save >= STORE_SAVE_INTERVAL_MS)
+            {
+                this->last_save = millis();
+                this->store->save();
+            }
+
+            switch (this->state)
+            {
+            case ConnectionState::DISCONNECTED:
+                // Connect on demand, an idle transmitter does not keep retrying.
+                if (!this->store->empty() && millis() - this->disconnected_at >= this->reconnect_delay)
+                    this->connect_();
+                break;
+            case ConnectionState::CONNECTING:
+                this->check_connecting_();
+                break;
+            case ConnectionState::CONNECTED:
+                break;
+            }
+
+            if (this->state == ConnectionState::CONNECTED)
+                this->write_queue_();
+        }
+
+        void SocketTransmitter::on_shutdown()
+        {
+            if (this->store)
+                this->store->save();
+        }
+
+        void SocketTransmitter::connect_()
+        {
+            ESP_LOGD(TAG, "Connecting to %s:%d", this->host.c_str(), this->port);
             this->socket_ = socket::socket_ip(this->protocol, 0);
-            int enable = 1;
-            this->socket_->setsockopt(SOL_SOCKET, SO_REUSEADDR, &enable, sizeof(enable));
+            if (!this->socket_)
+            {
+                ESP_LOGE(TAG, "Failed to create socket");
+                this->disconnect_();
+                return;
+            }
+            this->socket_->setblocking(false);
 
-            ESP_LOGD(TAG, "Connecting...");
-            sockaddr destination;
-            socket::set_sockaddr(&destination, sizeof(destination), this->host, this->port);
-            if (this->socket_->connect(&destination, sizeof(destination)) < 0)
+            sockaddr_storage destination;
+            auto length = socket::set_sockaddr((sockaddr *)&destination, sizeof(destination), this->host, this->port);
+            if (this->socket_->connect((sockaddr *)&destination, length) == 0)
+            {
+                // UDP, or a TCP connection that completed right away.
+                this->connected_();
+                return;
+            }
+            if (errno != EINPROGRESS && errno != EAGAIN)
             {
-                ESP_LOGE(TAG, "Failed to connect");
+                ESP_LOGW(TAG, "Failed to connect, errno %d", errno);
+                this->disconnect_();
                 return;
             }
+            this->state = ConnectionState::CONNECTING;
+            this->connect_started = millis();
+        }
 
-            ESP_LOGD(TAG, "Sending frame [%d bytes]", length);
-            int n_bytes = this->socket_->write(data, length);
-            if (n_bytes < 0)
-                ESP_LOGE(TAG, "Failed to send message");
-            this->socket_->close();
+        void SocketTransmitter::check_connecting_()
+        {
+            // SO_ERROR is read after the writability check, so a connect that failed in between
+            // is not taken as established.
+            bool writable = this->writable_();
+            int error = 0;
+            socklen_t error_length = sizeof(error);
+            if (this->socket_->getsockopt(SOL_SOCKET, SO_ERROR, &error, &error_length) == 0 && error != 0)
+            {
+                ESP_LOGW(TAG, "Failed to connect, errno %d", error);
+                this->disconnect_();
+                return;
+            }
+            if (writable)
+            {
+                this->connected_();
+                return;
+            }
+
+            if (millis() - this->connect_started > CONNECT_TIMEOUT_MS)
+            {
+                ESP_LOGW(TAG, "Connection timed out");
+                this->disconnect_();
+            }
+        }
+
+        bool SocketTransmitter::writable_()
+        {
+            // A connect in progress is done once the socket is writable. The peer address is not
+            // enough, lwIP knows it while the SYN is still unanswered.
+#ifdef USE_SOCKET_IMPL_BSD_SOCKETS
+            int fd = this->socket_->get_fd();
+            if (fd >= 0)
+            {
+                fd_set write_fds;
+                FD_ZERO(&write_fds);
+                FD_SET(fd, &write_fds);
+                struct timeval timeout = {0, 0};
+                return select(fd + 1, nullptr, &write_fds, nullptr, &timeout) > 0 && FD_ISSET(fd, &write_fds);
+            }
+#endif
+            // Without a descriptor to select on, a write that still finds the connect in progress
+            // goes back to connecting.
+            sockaddr_storage peer;
+            socklen_t peer_length = sizeof(peer);
+            return this->socket_->getpeername((sockaddr *)&peer, &peer_length) == 0;
+        }
+
+        void SocketTransmitter::connected_()
+        {
+            this->state = ConnectionState::CONNECTED;
+            this->backoff = RECONNECT_MIN_MS;
+            this->store->set_spilling(false);
+            if (!this->backlog)
+            {
+                ESP_LOGD(TAG, "Connected");
+                return;
+            }
+            this->backlog = false;
+            // A single message is what triggered the connect, not a backlog.
+            this->replay_remaining = this->store->size() > 1 ? this->store->size() : 0;
+            if (this->replay_remaining > 0)
+                ESP_LOGI(TAG, "Connected, replaying %zu queued messages", this->replay_remaining);
+            else
+                ESP_LOGD(TAG, "Connected");
+        }
+
+        void SocketTransmitter::write_queue_()
+        {
+            while (true)
+            {
+                // Written straight from the store, the front stays there until it is fully written.
+                const std::string *message = this->front_evicted ? &this->evicted_front : this->store->front();
+                if (!message)
+                    return;
+
+                bool replay = this->front_written == 0 && this->replay_remaining > 0;
+                if (replay && this->replay_rate && millis() - this->last_replay < 1000 / this->replay_rate)
+                    return;
+
+                ssize_t n_bytes = this->socket_->write(message->data() + this->front_written,
+                                                       message->size() - this->front_written);
+                if (n_bytes < 0 && (errno == EAGAIN || errno == EWOULDBLOCK))
+                    return;
+                if (n_bytes < 0 && this->protocol == SOCK_STREAM && (errno == EINPROGRESS || errno == ENOTCONN))
+                {
+                    // The connect has not finished after all, the connect timeout still applies.
+                    ESP_LOGV(TAG, "Still connecting");
+                    this->state = ConnectionState::CONNECTING;
+                    return;
+                }
+
+                // A replayed message is only counted once the write was attempted.
+                if (replay)
+                {
+                    this->last_replay = millis();
+                    this->replayed++;
+                    this->replay_remaining--;
+                }
+
+                if (n_bytes < 0)
+                {
+                    if (this->protocol == SOCK_DGRAM)
+                    {
+                        // An unreachable UDP collector only costs this datagram.
+                        ESP_LOGW(TAG, "Failed to send datagram [%zu bytes], errno %d", message->size(), errno);
+                        this->finish_front_();
+                        continue;
+                    }
+
+                    ESP_LOGW(TAG, "Failed to send, errno %d", errno);
+                    this->disconnect_();
+                    return;
+                }
+
+                this->front_written += n_bytes;
+                if (this->protocol == SOCK_STREAM && this->front_written < message->size())
+                    return;
+
+                ESP_LOGV(TAG, "Sent [%zu bytes]", message->size());
+                this->sent++;
+                this->finish_front_();
+
+                if (this->protocol == SOCK_STREAM && !this->persistent)
+                {
+                    // The close marks the end of the message, the next one connects again right away.
+                    this->close_();
+                    return;
+                }
+            }
+        }
+
+        void SocketTransmitter::finish_front_()
+        {
+            if (this->front_evicted)
+            {
+                this->front_evicted = false;
+                std::string().swap(this->evicted_front);
+            }
+            else
+                this->store->pop();
+            this->front_written = 0;
+        }
+
+        void SocketTransmitter::close_()
+        {
+            if (this->socket_)
+                this->socket_->close();
+            this->socket_ = nullptr;
+            this->state = ConnectionState::DISCONNECTED;
+            this->disconnected_at = millis();
+            this->reconnect_delay = 0;
+        }
+
+        void SocketTransmitter::disconnect_()
+        {
+            this->close_();
+            this->backlog = true;
+            // A partially written message stays in the store and is sent again from the start,
+            // unless it was already evicted.
+            this->front_written = 0;
+            if (this->front_evicted)
+            {
+                this->front_evicted = false;
+                std::string().swap(this->evicted_front);
+            }
+            // Until the collector is back, the queue goes to the store file.
+            this->count_evicted_(this->store->set_spilling(true));
+
+            this->reconnect_delay = this->backoff;
+            ESP_LOGD(TAG, "Reconnecting in %" PRIu32 " ms", this->backoff);
+            this->backoff = std::min(this->backoff * 2, RECONNECT_MAX_MS);
         }
 
         void SocketTransmitter::dump_config()
@@ -44,6 +391,17 @@ namespace esphome
             ESP_LOGCONFIG(TAG, "Socket Transmitter:");
             ESP_LOGCONFIG(TAG, "  Destination: %s:%d", this->host.c_str(), this->port);
             ESP_LOGCONFIG(TAG, "  Protocol: %s", protocol);
+            if (this->protocol == SOCK_STREAM)
+                ESP_LOGCONFIG(TAG, "  Connection: %s", this->persistent ? "persistent" : "one per message");
+            ESP_LOGCONFIG(TAG, "  Queue size: %zu", this->queue_size);
+            if (!this->store_path.empty())
+                ESP_LOGCONFIG(TAG, "  Store: %s [%zu messages]", this->store_path.c_str(), this->store_size);
+            ESP_LOGCONFIG(TAG, "  Replay rate: %" PRIu32 " messages/s", this->replay_rate);
+            if (this->framed)
+            {
+                ESP_LOGCONFIG(TAG, "  Framed: batches of up to %zu bytes", this->batch_size);
+                ESP_LOGCONFIG(TAG, "  Batch timeout: %" PRIu32 " ms", this->batch_timeout);
+            }
         }
     }
 }
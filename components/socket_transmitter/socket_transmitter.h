@@ -1,4 +1,6 @@
 #pragma once
+#include <array>
+#include <memory>
 #include <string>
 #include <vector>
 
@@ -7,29 +9,136 @@
 #include "esphome/core/component.h"
 #include "esphome/components/socket/socket.h"
 
+#include "message_store.h"
+
 namespace esphome
 {
     namespace socket_transmitter
     {
         static const char *TAG = "socket_transmitter";
 
+        // Backoff between failed connection attempts, doubled up to the maximum.
+        static const uint32_t RECONNECT_MIN_MS = 1000;
+        static const uint32_t RECONNECT_MAX_MS = 60000;
+        static const uint32_t CONNECT_TIMEOUT_MS = 5000;
+        // How often the messages spilled to the store file are flushed and its head saved.
+        static const uint32_t STORE_SAVE_INTERVAL_MS = 10000;
+
+        // In framed mode records are collected into batches. A batch starts with a header of
+        // the magic "WB", the version, the number of records, the length of the records that
+        // follow as big endian uint16 and the batch sequence number as big endian uint32.
+        // Every record is a big endian uint16 length and the data.
+        static const uint8_t FRAMED_VERSION = 2;
+        static const size_t FRAMED_HEADER_SIZE = 10;
+        static const size_t FRAMED_RECORD_HEADER_SIZE = 2;
+        static const size_t FRAMED_MAX_RECORDS = 255;
+
+        enum class ConnectionState
+        {
+            DISCONNECTED,
+            CONNECTING,
+            CONNECTED,
+        };
+
+        // Sends from loop(), so send() never blocks the main loop on a slow or unreachable
+        // collector. Over TCP every message gets its own connection, so the collector sees
+        // where it ends, unless the connection is persistent. For UDP the socket is connected
+        // once and every send is one datagram.
         class SocketTransmitter : public Component
         {
         public:
             void set_host(std::string host) { this->host = host; };
             void set_port(int port) { this->port = port; };
             void set_protocol(int protocol) { this->protocol = protocol; };
-            void send(std::string data);
-            void send(std::vector<uint8_t> data);
+            void set_queue_size(size_t queue_size) { this->queue_size = queue_size; };
+            void set_framed(bool framed) { this->framed = framed; };
+            void set_persistent(bool persistent) { this->persistent = persistent; };
+            void set_batch_size(size_t batch_size) { this->batch_size = batch_size; };
+            void set_batch_timeout(uint32_t batch_timeout) { this->batch_timeout = batch_timeout; };
+            void set_store_path(std::string store_path) { this->store_path = store_path; };
+            void set_store_size(size_t store_size) { this->store_size = store_size; };
+            void set_replay_rate(uint32_t replay_rate) { this->replay_rate = replay_rate; };
+            // Queue the data, the oldest queued data is evicted when the queue is full.
+            // In framed mode the data is added as a record to the current batch.
+            // The data is copied once, into the queue or the batch, a moved string not at all
+            // unless it goes into a batch.
+            void send(std::string &&data);
+            void send(const std::string &data);
+            void send(const std::vector<uint8_t> &data);
             void send(const uint8_t *data, size_t length);
+            // Queue the pieces as one message, or one record in framed mode, so a header, the
+            // payload and a trailer can be sent from where they are without joining them first.
+            void send(const struct iovec *pieces, size_t count);
+            template <size_t N> void send(const std::array<struct iovec, N> &pieces) { this->send(pieces.data(), N); }
+            // Queue the current batch without waiting for it to fill up or time out.
+            void flush();
+            void setup() override;
+            void loop() override;
+            void on_shutdown() override;
             void dump_config() override;
             float get_setup_priority() const override { return setup_priority::AFTER_CONNECTION; }
 
+            // Messages evicted from the full queue, sent, and sent as part of a backlog after a reconnect.
+            uint32_t get_evicted() const { return this->evicted; }
+            uint32_t get_sent() const { return this->sent; }
+            uint32_t get_replayed() const { return this->replayed; }
+            size_t get_queued() const { return this->store ? this->store->size() : 0; }
+
         protected:
+            void enqueue_(std::string &&data);
+            void count_evicted_(size_t evicted);
+            void connect_();
+            void check_connecting_();
+            bool writable_();
+            void write_queue_();
+            void connected_();
+            void finish_front_();
+            void close_();
+            void disconnect_();
+
             std::string host;
             int port;
             int protocol;
+            size_t queue_size{16};
+            bool framed{false};
+            bool persistent{false};
+            size_t batch_size{1400};
+            uint32_t batch_timeout{100};
+            std::string store_path;
+            size_t store_size{1000};
+            uint32_t last_save{0};
+            uint32_t replay_rate{10};
             std::unique_ptr<socket::Socket> socket_;
+
+            ConnectionState state{ConnectionState::DISCONNECTED};
+            uint32_t connect_started{0};
+            uint32_t disconnected_at{0};
+            uint32_t reconnect_delay{0};
+            uint32_t backoff{RECONNECT_MIN_MS};
+
+            std::unique_ptr<MessageStore> store;
+            // Bytes of the front of the store already written to the TCP stream.
+            size_t front_written{0};
+            // A partially written front that was evicted from the full store.
+            std::string evicted_front;
+            bool front_evicted{false};
+
+            // The messages queued before the last reconnect, they are sent at most at
+            // replay_rate messages per second. Newer messages are not rate limited.
+            // Only a connect after a failure, or the first one with a restored store, starts
+            // a replay, one connection per message carries the remaining count over.
+            size_t replay_remaining{0};
+            bool backlog{true};
+            uint32_t last_replay{0};
+
+            uint32_t sequence{0};
+            uint32_t evicted{0};
+            uint32_t sent{0};
+            uint32_t replayed{0};
+
+            std::string batch;
+            size_t batch_records{0};
+            uint32_t batch_started{0};
         };
 
         template <typename StrOrVector, typename... Ts>
@@ -48,5 +157,17 @@ namespace esphome
         protected:
             SocketTransmitter *parent_;
         };
+
+        template <typename... Ts>
+        class SocketTransmitterFlushAction : public Action<Ts...>
+        {
+        public:
+            SocketTransmitterFlushAction(SocketTransmitter *parent) : parent_(parent) {}
+
+            void play(Ts... x) override { this->parent_->flush(); }
+
+        protected:
+            SocketTransmitter *parent_;
+        };
     }
 }
@@ -6,6 +6,14 @@ from pathlib import Path
 
 CODEOWNERS = ["@kubasaw"]
 CONF_DRIVERS = "drivers"
+CONF_AES_BACKEND = "aes_backend"
+CONF_PERSIST_FORMAT_SIGNATURES = "persist_format_signatures"
+
+AES_BACKENDS = {
+    "tiny": None,
+    "ttable": "USE_WMBUS_AES_TTABLE",
+    "mbedtls": "USE_WMBUS_AES_MBEDTLS",
+}
 
 wmbus_common_ns = cg.esphome_ns.namespace("wmbus_common")
 WMBusCommon = wmbus_common_ns.class_("WMBusCommon", cg.Component)
@@ -36,18 +44,26 @@ CONFIG_SCHEMA = cv.Schema(
             lambda x: AVAILABLE_DRIVERS if x == "all" else x,
             [validate_driver],
         ),
+        cv.Optional(CONF_AES_BACKEND, default="tiny"): cv.one_of(
+            *AES_BACKENDS, lower=True
+        ),
+        cv.Optional(CONF_PERSIST_FORMAT_SIGNATURES, default=False): cv.boolean,
     }
 )
 
 
+def included_drivers():
+    if _registered_drivers:
+        return sorted(_registered_drivers)
+    return ["unknown"]
+
+
 class WMBusComponentManifest(ComponentManifest):
     @property
     def resources(self):
-        exclude_drivers = set(AVAILABLE_DRIVERS) - _registered_drivers
-        if _registered_drivers:
-            exclude_drivers |= _ALWAYS_EXCLUDED
-        else:
-            exclude_drivers |= _ALWAYS_EXCLUDED - {"unknown"}
+        exclude_drivers = (set(AVAILABLE_DRIVERS) | _ALWAYS_EXCLUDED) - set(
+            included_drivers()
+        )
 
         exclude_files = {f"driver_{name}.cc" for name in exclude_drivers}
         resources = [fr for fr in super().resources if fr.resource not in exclude_files]
@@ -56,6 +72,18 @@ class WMBusComponentManifest(ComponentManifest):
 
 async def to_code(config):
     cg.add_define("WMBUSMETERS_TAG", Path(__file__).with_name('.wmbusmeters_tag').read_text())
+    cg.add_define(
+        "WMBUS_DRIVER_LIST",
+        cg.RawExpression(
+            " ".join(f"X({name.replace('-', '_')})" for name in included_drivers())
+        ),
+    )
+
+    if aes_define := AES_BACKENDS[config[CONF_AES_BACKEND]]:
+        cg.add_define(aes_define)
+
+    if config[CONF_PERSIST_FORMAT_SIGNATURES]:
+        cg.add_define("USE_WMBUS_PERSIST_FORMAT_SIGNATURES")
 
     get_component("wmbus_common").__class__ = WMBusComponentManifest
 
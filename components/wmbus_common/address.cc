@@ -24,7 +24,7 @@
 
 std::vector<std::string> splitSequenceOfAddressExpressionsAtCommas(const std::string& mes);
 bool isValidMatchExpression(const std::string& s, bool *has_wildcard);
-bool doesIdMatchExpression(const std::string& id, std::string match_rule);
+bool doesIdMatchExpression(const std::string& id, const std::string& match_rule);
 bool doesAddressMatchExpressions(Address &address,
                                  std::vector<AddressExpression>& address_expressions,
                                  bool *used_wildcard,
@@ -148,51 +148,55 @@ std::vector<AddressExpression> splitAddressExpressions(const std::string &aes)
     return r;
 }
 
-bool doesIdMatchExpression(const std::string& s, std::string match)
+bool doesIdMatchExpression(const std::string& id, const std::string& match)
 {
-    std::string id = s;
     if (id.length() == 0) return false;
 
     // Here we assume that the match expression has been
     // verified to be valid.
-    bool can_match = true;
+    size_t i = 0;
+    size_t m = 0;
 
     // Now match bcd/hex until end of id, or '*' in match.
-    while (id.length() > 0 && match.length() > 0 && match.front() != '*')
+    while (i < id.length() && m < match.length() && match[m] != '*')
     {
-        if (id.front() != match.front())
-        {
-            // We hit a difference, it cannot match.
-            can_match = false;
-            break;
-        }
-        id.erase(0,1);
-        match.erase(0,1);
+        // We hit a difference, it cannot match.
+        if (id[i] != match[m]) return false;
+        i++;
+        m++;
     }
 
     bool wildcard_used = false;
-    if (match.length() && match.front() == '*')
+    if (m < match.length() && match[m] == '*')
     {
         wildcard_used = true;
-        match.erase(0,1);
+        m++;
     }
 
-    if (can_match)
+    // Ok, now the match expression should be empty.
+    // If wildcard is true, then the id can still have digits,
+    // otherwise it must also be empty.
+    if (wildcard_used)
     {
-        // Ok, now the match expression should be empty.
-        // If wildcard is true, then the id can still have digits,
-        // otherwise it must also be empty.
-        if (wildcard_used)
-        {
-            can_match = match.length() == 0;
-        }
-        else
-        {
-            can_match = match.length() == 0 && id.length() == 0;
-        }
+        return m == match.length();
     }
+    return m == match.length() && i == id.length();
+}
 
-    return can_match;
+// Converts the first len characters of s, which must be lowercase hex digits
+// just like the ids decoded from telegrams, into a number.
+static bool lowercaseHexToNumber(const std::string& s, size_t len, uint32_t *out)
+{
+    uint32_t v = 0;
+    for (size_t i = 0; i < len; ++i)
+    {
+        char c = s[i];
+        if (c >= '0' && c <= '9') v = v << 4 | (c - '0');
+        else if (c >= 'a' && c <= 'f') v = v << 4 | (c - 'a' + 10);
+        else return false;
+    }
+    *out = v;
+    return true;
 }
 
 bool hasWildCard(const std::string& mes)
@@ -210,6 +214,42 @@ bool AddressExpression::match(const std::string &i, uint16_t m, uchar v, uchar t
     return true;
 }
 
+bool AddressExpression::match(const Address &a) const
+{
+    if ((a.fields() & fields_mask) != fields_value) return false;
+    if (id_numeric && a.id_numeric) return (a.id_value & id_mask) == id_value;
+
+    return doesIdMatchExpression(a.id, id);
+}
+
+void AddressExpression::compile()
+{
+    fields_mask = (mfct == 0xffff ? 0 : 0xffff0000) |
+                  (version == 0xff ? 0 : 0x0000ff00) |
+                  (type == 0xff ? 0 : 0x000000ff);
+    fields_value = ((uint32_t)mfct << 16 | (uint32_t)version << 8 | type) & fields_mask;
+
+    // Only 8 digits, or up to 7 digits followed by a * can match an id of 8 digits.
+    // Uppercase hex never matches the decoded lowercase ids, that is left to the string match.
+    size_t digits = id.length();
+    if (digits > 0 && id.back() == '*') digits--;
+    id_numeric = (digits == id.length() ? digits == 8 : digits <= 7) &&
+        lowercaseHexToNumber(id, digits, &id_value);
+    if (!id_numeric)
+    {
+        id_value = id_mask = 0;
+        return;
+    }
+    // The wildcard digits are the low nibbles.
+    if (digits == 0)
+    {
+        id_mask = 0;
+        return;
+    }
+    id_mask = 0xffffffff << (4 * (8 - digits));
+    id_value <<= 4 * (8 - digits);
+}
+
 void AddressExpression::trimToIdentity(IdentityMode im, Address &a)
 {
     switch (im)
@@ -238,6 +278,7 @@ void AddressExpression::trimToIdentity(IdentityMode im, Address &a)
     default:
         break;
     }
+    compile();
 }
 
 bool AddressExpression::parse(const std::string &in)
@@ -318,6 +359,7 @@ bool AddressExpression::parse(const std::string &in)
         if (data.size() != 1) return false;
         type = data[0];
 
+        compile();
         return true;
     }
 
@@ -372,6 +414,7 @@ bool AddressExpression::parse(const std::string &in)
         }
     }
 
+    compile();
     return true;
 }
 
@@ -469,6 +512,8 @@ void Address::decodeMfctFirst(const std::vector<uchar>::iterator &pos)
 {
     mfct = *(pos+1) << 8 | *(pos+0);
     id = tostrprintf("%02x%02x%02x%02x", *(pos+5), *(pos+4), *(pos+3), *(pos+2));
+    id_value = (uint32_t)*(pos+5) << 24 | *(pos+4) << 16 | *(pos+3) << 8 | *(pos+2);
+    id_numeric = true;
     version = *(pos+6);
     type = *(pos+7);
 }
@@ -476,11 +521,20 @@ void Address::decodeMfctFirst(const std::vector<uchar>::iterator &pos)
 void Address::decodeIdFirst(const std::vector<uchar>::iterator &pos)
 {
     id = tostrprintf("%02x%02x%02x%02x", *(pos+3), *(pos+2), *(pos+1), *(pos+0));
+    id_value = (uint32_t)*(pos+3) << 24 | *(pos+2) << 16 | *(pos+1) << 8 | *(pos+0);
+    id_numeric = true;
     mfct = *(pos+5) << 8 | *(pos+4);
     version = *(pos+6);
     type = *(pos+7);
 }
 
+void Address::setId(const std::string &s)
+{
+    id = s;
+    id_numeric = id.length() == 8 && lowercaseHexToNumber(id, 8, &id_value);
+    if (!id_numeric) id_value = 0;
+}
+
 bool doesTelegramMatchExpressions(std::vector<Address> &addresses,
                                   std::vector<AddressExpression>& address_expressions,
                                   bool *used_wildcard)
@@ -545,7 +599,7 @@ bool doesAddressMatchExpressions(Address &address,
 
         if (is_required) *required_found = true;
 
-        bool m = ae.match(address.id, address.mfct, address.version, address.type);
+        bool m = ae.match(address);
 
         if (is_negative_rule)
         {
@@ -621,6 +675,7 @@ void AddressExpression::clear()
     mfct = 0xffff;
     version = 0xff;
     type = 0xff;
+    compile();
 }
 
 void AddressExpression::appendIdentity(IdentityMode im,
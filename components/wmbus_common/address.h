@@ -46,12 +46,18 @@ IdentityMode toIdentityMode(const char *s);
 struct Address
 {
     std::string id; // p1 or 12345678 or non-compliant hex: 1234abcd
+    uint32_t id_value {}; // The id as a number, valid when id_numeric is set.
+    bool id_numeric {}; // The id is 8 lowercase hex digits, as decoded from a telegram.
     uint16_t mfct {};
     uchar type {};
     uchar version {};
 
     void decodeMfctFirst(const std::vector<uchar>::iterator &pos);
     void decodeIdFirst(const std::vector<uchar>::iterator &pos);
+    // Sets the id and its numeric value, if it has one.
+    void setId(const std::string &s);
+    // The mfct, version and type packed for matching.
+    uint32_t fields() const { return (uint32_t)mfct << 16 | (uint32_t)version << 8 | type; }
 
     std::string str();
     static std::string concat(std::vector<Address> &addresses);
@@ -82,13 +88,25 @@ struct AddressExpression
     bool filter_out {}; // Telegrams matching this rule should be filtered out!
     bool required {}; // If true, then this address expression must be matched!
 
-    AddressExpression() {}
-    AddressExpression(Address &a) : id(a.id), mfct(a.mfct), version(a.version), type(a.type) { }
+    // Filled in by compile() from the fields above. A numeric id matches a numeric address id
+    // when (id_value & id_mask) == id_value, where the mask covers the digits before the *.
+    // Other ids, like p1 or ids with uppercase hex, are matched as strings.
+    uint32_t id_value {};
+    uint32_t id_mask {};
+    bool id_numeric {};
+    uint32_t fields_value {}; // mfct, version and type packed like Address::fields()
+    uint32_t fields_mask {}; // with zero bits for the ones that match anything.
+
+    AddressExpression() { compile(); }
+    AddressExpression(Address &a) : id(a.id), mfct(a.mfct), version(a.version), type(a.type) { compile(); }
     bool operator==(const AddressExpression&) const;
     void clear();
     void trimToIdentity(IdentityMode im, Address &a);
     bool parse(const std::string &s);
+    // Must be called after changing the id, mfct, version or type directly.
+    void compile();
     bool match(const std::string &id, uint16_t mfct, uchar version, uchar type);
+    bool match(const Address &a) const;
     std::string str();
     static std::string concat(std::vector<AddressExpression> &address_expressions);
     static void appendIdentity(IdentityMode im,
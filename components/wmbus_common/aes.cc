@@ -42,28 +42,24 @@ NOTE:   String length must be evenly divisible by 16byte (str_len % 16 == 0)
 #include <string.h> // CBC mode, for memset
 #include "aes.h"
 
+// The mbedTLS backend lives in aes_mbedtls.cc.
+#if !defined(USE_WMBUS_AES_MBEDTLS)
+
 /*****************************************************************************/
 /* Defines:                                                                  */
 /*****************************************************************************/
 // The number of columns comprising a state in AES. This is a constant in AES. Value=4
 #define Nb 4
-#define BLOCKLEN 16 //Block length in bytes AES is 128b block only
 
 #if defined(AES256) && (AES256 == 1)
     #define Nk 8
-    #define KEYLEN 32
     #define Nr 14
-    #define keyExpSize 240
 #elif defined(AES192) && (AES192 == 1)
     #define Nk 6
-    #define KEYLEN 24
     #define Nr 12
-    #define keyExpSize 208
 #else
     #define Nk 4        // The number of 32 bit words in a key.
-    #define KEYLEN 16   // Key length in bytes
     #define Nr 10       // The number of rounds in AES Cipher.
-    #define keyExpSize 176
 #endif
 
 // jcallan@github points out that declaring Multiply as a function
@@ -79,23 +75,11 @@ NOTE:   String length must be evenly divisible by 16byte (str_len % 16 == 0)
 /*****************************************************************************/
 // state - array holding the intermediate results during decryption.
 typedef uint8_t state_t[4][4];
-static state_t* state;
-
-// The array that stores the round keys.
-static uint8_t RoundKey[keyExpSize];
-
-// The Key input to the AES Program
-static const uint8_t* Key;
-
-#if defined(CBC) && CBC
-  // Initial Vector used only for CBC mode
-  static uint8_t* Iv;
-#endif
 
 // The lookup-tables are marked const so they can be placed in read-only storage instead of RAM
 // The numbers below can be computed dynamically trading ROM for RAM -
 // This can be useful in (embedded) bootloader applications, where ROM is often limited.
-static const uint8_t sbox[256] = {
+static constexpr uint8_t sbox[256] = {
   //0     1    2      3     4    5     6     7      8    9     A      B    C     D     E     F
   0x63, 0x7c, 0x77, 0x7b, 0xf2, 0x6b, 0x6f, 0xc5, 0x30, 0x01, 0x67, 0x2b, 0xfe, 0xd7, 0xab, 0x76,
   0xca, 0x82, 0xc9, 0x7d, 0xfa, 0x59, 0x47, 0xf0, 0xad, 0xd4, 0xa2, 0xaf, 0x9c, 0xa4, 0x72, 0xc0,
@@ -114,7 +98,7 @@ static const uint8_t sbox[256] = {
   0xe1, 0xf8, 0x98, 0x11, 0x69, 0xd9, 0x8e, 0x94, 0x9b, 0x1e, 0x87, 0xe9, 0xce, 0x55, 0x28, 0xdf,
   0x8c, 0xa1, 0x89, 0x0d, 0xbf, 0xe6, 0x42, 0x68, 0x41, 0x99, 0x2d, 0x0f, 0xb0, 0x54, 0xbb, 0x16 };
 
-static const uint8_t rsbox[256] = {
+static constexpr uint8_t rsbox[256] = {
   0x52, 0x09, 0x6a, 0xd5, 0x30, 0x36, 0xa5, 0x38, 0xbf, 0x40, 0xa3, 0x9e, 0x81, 0xf3, 0xd7, 0xfb,
   0x7c, 0xe3, 0x39, 0x82, 0x9b, 0x2f, 0xff, 0x87, 0x34, 0x8e, 0x43, 0x44, 0xc4, 0xde, 0xe9, 0xcb,
   0x54, 0x7b, 0x94, 0x32, 0xa6, 0xc2, 0x23, 0x3d, 0xee, 0x4c, 0x95, 0x0b, 0x42, 0xfa, 0xc3, 0x4e,
@@ -176,13 +160,15 @@ static uint8_t getSBoxValue(uint8_t num)
   return sbox[num];
 }
 
+#if !defined(USE_WMBUS_AES_TTABLE)
 static uint8_t getSBoxInvert(uint8_t num)
 {
   return rsbox[num];
 }
+#endif
 
 // This function produces Nb(Nr+1) round keys. The round keys are used in each round to decrypt the states.
-static void KeyExpansion(void)
+static void KeyExpansion(uint8_t* RoundKey, const uint8_t* Key)
 {
   uint32_t i, k;
   uint8_t tempa[4]; // Used for the column/row operations
@@ -253,9 +239,158 @@ static void KeyExpansion(void)
   }
 }
 
+#if defined(USE_WMBUS_AES_TTABLE)
+
+/*****************************************************************************/
+/* 32-bit T-table round functions:                                           */
+/*****************************************************************************/
+// A round is four table lookups and xors per column instead of the byte wise
+// SubBytes/ShiftRows/MixColumns steps. Only the first table of each direction
+// is stored (2 KiB in total), the other three are byte rotations of it.
+// Words hold a column with its first byte in the most significant position.
+
+struct TTables
+{
+  uint32_t Te[256]; // SubBytes followed by MixColumns
+  uint32_t Td[256]; // InvSubBytes followed by InvMixColumns
+};
+
+static constexpr uint8_t gmul(uint8_t x, uint8_t y)
+{
+  uint8_t r = 0;
+  while (y)
+  {
+    if (y & 1) r ^= x;
+    x = (x << 1) ^ ((x & 0x80) ? 0x1b : 0);
+    y >>= 1;
+  }
+  return r;
+}
+
+static constexpr TTables makeTTables()
+{
+  TTables t {};
+  for (int i = 0; i < 256; ++i)
+  {
+    uint8_t s = sbox[i];
+    t.Te[i] = ((uint32_t)gmul(s, 2) << 24) | ((uint32_t)s << 16) | ((uint32_t)s << 8) | gmul(s, 3);
+    uint8_t r = rsbox[i];
+    t.Td[i] = ((uint32_t)gmul(r, 0x0e) << 24) | ((uint32_t)gmul(r, 0x09) << 16) | ((uint32_t)gmul(r, 0x0d) << 8) | gmul(r, 0x0b);
+  }
+  return t;
+}
+
+static constexpr TTables ttables = makeTTables();
+
+static inline uint32_t rotr(uint32_t x, int n)
+{
+  return (x >> n) | (x << (32 - n));
+}
+
+#define TE(a, b, c, d) (ttables.Te[(a) >> 24] ^ rotr(ttables.Te[((b) >> 16) & 0xff], 8) ^ \
+                        rotr(ttables.Te[((c) >> 8) & 0xff], 16) ^ rotr(ttables.Te[(d) & 0xff], 24))
+#define TD(a, b, c, d) (ttables.Td[(a) >> 24] ^ rotr(ttables.Td[((b) >> 16) & 0xff], 8) ^ \
+                        rotr(ttables.Td[((c) >> 8) & 0xff], 16) ^ rotr(ttables.Td[(d) & 0xff], 24))
+#define SB(box, a, b, c, d) (((uint32_t)box[(a) >> 24] << 24) | ((uint32_t)box[((b) >> 16) & 0xff] << 16) | \
+                             ((uint32_t)box[((c) >> 8) & 0xff] << 8) | (uint32_t)box[(d) & 0xff])
+
+static inline uint32_t loadWord(const uint8_t* p)
+{
+  return ((uint32_t)p[0] << 24) | ((uint32_t)p[1] << 16) | ((uint32_t)p[2] << 8) | p[3];
+}
+
+static inline void storeWord(uint8_t* p, uint32_t w)
+{
+  p[0] = w >> 24; p[1] = w >> 16; p[2] = w >> 8; p[3] = w;
+}
+
+// InvMixColumns of a round key word, used to build the equivalent inverse cipher schedule.
+// Td includes InvSubBytes, so the bytes are passed through the forward S-box first.
+static uint32_t invMixWord(uint32_t w)
+{
+  uint32_t x = SB(sbox, w, w, w, w);
+  return TD(x, x, x, x);
+}
+
+void AES_init_ctx(struct AES_ctx* ctx, const uint8_t* key)
+{
+  uint8_t RoundKey[AES_keyExpSize];
+  KeyExpansion(RoundKey, key);
+
+  for (int i = 0; i < Nb * (Nr + 1); ++i)
+  {
+    ctx->EncKey[i] = loadWord(RoundKey + 4 * i);
+  }
+
+  // The decryption schedule uses the round keys in reverse order, with
+  // InvMixColumns applied to all but the first and the last round key.
+  for (int round = 0; round <= Nr; ++round)
+  {
+    for (int j = 0; j < Nb; ++j)
+    {
+      uint32_t w = ctx->EncKey[(Nr - round) * Nb + j];
+      ctx->DecKey[round * Nb + j] = (round == 0 || round == Nr) ? w : invMixWord(w);
+    }
+  }
+}
+
+static void EncryptBlock(const struct AES_ctx* ctx, uint8_t* buf)
+{
+  const uint32_t* rk = ctx->EncKey;
+  uint32_t s0 = loadWord(buf) ^ rk[0];
+  uint32_t s1 = loadWord(buf + 4) ^ rk[1];
+  uint32_t s2 = loadWord(buf + 8) ^ rk[2];
+  uint32_t s3 = loadWord(buf + 12) ^ rk[3];
+
+  for (int round = 1; round < Nr; ++round)
+  {
+    rk += Nb;
+    uint32_t t0 = TE(s0, s1, s2, s3) ^ rk[0];
+    uint32_t t1 = TE(s1, s2, s3, s0) ^ rk[1];
+    uint32_t t2 = TE(s2, s3, s0, s1) ^ rk[2];
+    uint32_t t3 = TE(s3, s0, s1, s2) ^ rk[3];
+    s0 = t0; s1 = t1; s2 = t2; s3 = t3;
+  }
+
+  // The last round has no MixColumns.
+  rk += Nb;
+  storeWord(buf, SB(sbox, s0, s1, s2, s3) ^ rk[0]);
+  storeWord(buf + 4, SB(sbox, s1, s2, s3, s0) ^ rk[1]);
+  storeWord(buf + 8, SB(sbox, s2, s3, s0, s1) ^ rk[2]);
+  storeWord(buf + 12, SB(sbox, s3, s0, s1, s2) ^ rk[3]);
+}
+
+static void DecryptBlock(const struct AES_ctx* ctx, uint8_t* buf)
+{
+  const uint32_t* rk = ctx->DecKey;
+  uint32_t s0 = loadWord(buf) ^ rk[0];
+  uint32_t s1 = loadWord(buf + 4) ^ rk[1];
+  uint32_t s2 = loadWord(buf + 8) ^ rk[2];
+  uint32_t s3 = loadWord(buf + 12) ^ rk[3];
+
+  for (int round = 1; round < Nr; ++round)
+  {
+    rk += Nb;
+    uint32_t t0 = TD(s0, s3, s2, s1) ^ rk[0];
+    uint32_t t1 = TD(s1, s0, s3, s2) ^ rk[1];
+    uint32_t t2 = TD(s2, s1, s0, s3) ^ rk[2];
+    uint32_t t3 = TD(s3, s2, s1, s0) ^ rk[3];
+    s0 = t0; s1 = t1; s2 = t2; s3 = t3;
+  }
+
+  // The last round has no InvMixColumns.
+  rk += Nb;
+  storeWord(buf, SB(rsbox, s0, s3, s2, s1) ^ rk[0]);
+  storeWord(buf + 4, SB(rsbox, s1, s0, s3, s2) ^ rk[1]);
+  storeWord(buf + 8, SB(rsbox, s2, s1, s0, s3) ^ rk[2]);
+  storeWord(buf + 12, SB(rsbox, s3, s2, s1, s0) ^ rk[3]);
+}
+
+#else // #if defined(USE_WMBUS_AES_TTABLE)
+
 // This function adds the round key to state.
 // The round key is added to the state by an XOR function.
-static void AddRoundKey(uint8_t round)
+static void AddRoundKey(uint8_t round, state_t* state, const uint8_t* RoundKey)
 {
   uint8_t i,j;
   for (i=0;i<4;++i)
@@ -269,7 +404,7 @@ static void AddRoundKey(uint8_t round)
 
 // The SubBytes Function Substitutes the values in the
 // state matrix with values in an S-box.
-static void SubBytes(void)
+static void SubBytes(state_t* state)
 {
   uint8_t i, j;
   for (i = 0; i < 4; ++i)
@@ -284,7 +419,7 @@ static void SubBytes(void)
 // The ShiftRows() function shifts the rows in the state to the left.
 // Each row is shifted with different offset.
 // Offset = Row number. So the first row is not shifted.
-static void ShiftRows(void)
+static void ShiftRows(state_t* state)
 {
   uint8_t temp;
 
@@ -318,7 +453,7 @@ static uint8_t xtime(uint8_t x)
 }
 
 // MixColumns function mixes the columns of the state matrix
-static void MixColumns(void)
+static void MixColumns(state_t* state)
 {
   uint8_t i;
   uint8_t Tmp,Tm,t;
@@ -356,7 +491,7 @@ static uint8_t Multiply(uint8_t x, uint8_t y)
 // MixColumns function mixes the columns of the state matrix.
 // The method used to multiply may be difficult to understand for the inexperienced.
 // Please use the references to gain more information.
-static void InvMixColumns(void)
+static void InvMixColumns(state_t* state)
 {
   int i;
   uint8_t a, b, c, d;
@@ -377,7 +512,7 @@ static void InvMixColumns(void)
 
 // The SubBytes Function Substitutes the values in the
 // state matrix with values in an S-box.
-static void InvSubBytes(void)
+static void InvSubBytes(state_t* state)
 {
   uint8_t i,j;
   for (i = 0; i < 4; ++i)
@@ -389,7 +524,7 @@ static void InvSubBytes(void)
   }
 }
 
-static void InvShiftRows(void)
+static void InvShiftRows(state_t* state)
 {
   uint8_t temp;
 
@@ -419,87 +554,91 @@ static void InvShiftRows(void)
 
 
 // Cipher is the main function that encrypts the PlainText.
-static void Cipher(void)
+static void Cipher(state_t* state, const uint8_t* RoundKey)
 {
   uint8_t round = 0;
 
   // Add the First round key to the state before starting the rounds.
-  AddRoundKey(0);
+  AddRoundKey(0, state, RoundKey);
 
   // There will be Nr rounds.
   // The first Nr-1 rounds are identical.
   // These Nr-1 rounds are executed in the loop below.
   for (round = 1; round < Nr; ++round)
   {
-    SubBytes();
-    ShiftRows();
-    MixColumns();
-    AddRoundKey(round);
+    SubBytes(state);
+    ShiftRows(state);
+    MixColumns(state);
+    AddRoundKey(round, state, RoundKey);
   }
 
   // The last round is given below.
   // The MixColumns function is not here in the last round.
-  SubBytes();
-  ShiftRows();
-  AddRoundKey(Nr);
+  SubBytes(state);
+  ShiftRows(state);
+  AddRoundKey(Nr, state, RoundKey);
 }
 
-static void InvCipher(void)
+static void InvCipher(state_t* state, const uint8_t* RoundKey)
 {
   uint8_t round=0;
 
   // Add the First round key to the state before starting the rounds.
-  AddRoundKey(Nr);
+  AddRoundKey(Nr, state, RoundKey);
 
   // There will be Nr rounds.
   // The first Nr-1 rounds are identical.
   // These Nr-1 rounds are executed in the loop below.
   for (round = (Nr - 1); round > 0; --round)
   {
-    InvShiftRows();
-    InvSubBytes();
-    AddRoundKey(round);
-    InvMixColumns();
+    InvShiftRows(state);
+    InvSubBytes(state);
+    AddRoundKey(round, state, RoundKey);
+    InvMixColumns(state);
   }
 
   // The last round is given below.
   // The MixColumns function is not here in the last round.
-  InvShiftRows();
-  InvSubBytes();
-  AddRoundKey(0);
+  InvShiftRows(state);
+  InvSubBytes(state);
+  AddRoundKey(0, state, RoundKey);
+}
+
+
+void AES_init_ctx(struct AES_ctx* ctx, const uint8_t* key)
+{
+  KeyExpansion(ctx->RoundKey, key);
+}
+
+static void EncryptBlock(const struct AES_ctx* ctx, uint8_t* buf)
+{
+  Cipher((state_t*)buf, ctx->RoundKey);
+}
+
+static void DecryptBlock(const struct AES_ctx* ctx, uint8_t* buf)
+{
+  InvCipher((state_t*)buf, ctx->RoundKey);
 }
 
+#endif // #if defined(USE_WMBUS_AES_TTABLE)
+
 
 /*****************************************************************************/
 /* Public functions:                                                         */
 /*****************************************************************************/
+
 #if defined(ECB) && (ECB == 1)
 
 
-void AES_ECB_encrypt(const uint8_t* input, const uint8_t* key, uint8_t* output, const uint32_t length)
+void AES_ECB_encrypt(const struct AES_ctx* ctx, uint8_t* buf)
 {
-  // Copy input to output, and work in-memory on output
-  memcpy(output, input, length);
-  state = (state_t*)output;
-
-  Key = key;
-  KeyExpansion();
-
   // The next function call encrypts the PlainText with the Key using AES algorithm.
-  Cipher();
+  EncryptBlock(ctx, buf);
 }
 
-void AES_ECB_decrypt(const uint8_t* input, const uint8_t* key, uint8_t *output, const uint32_t length)
+void AES_ECB_decrypt(const struct AES_ctx* ctx, uint8_t* buf)
 {
-  // Copy input to output, and work in-memory on output
-  memcpy(output, input, length);
-  state = (state_t*)output;
-
-  // The KeyExpansion routine must be called before encryption.
-  Key = key;
-  KeyExpansion();
-
-  InvCipher();
+  DecryptBlock(ctx, buf);
 }
 
 
@@ -512,87 +651,47 @@ void AES_ECB_decrypt(const uint8_t* input, const uint8_t* key, uint8_t *output,
 #if defined(CBC) && (CBC == 1)
 
 
-static void XorWithIv(uint8_t* buf)
+static void XorWithIv(uint8_t* buf, const uint8_t* Iv)
 {
   uint8_t i;
-  for (i = 0; i < BLOCKLEN; ++i) //WAS for(i = 0; i < KEYLEN; ++i) but the block in AES is always 128bit so 16 bytes!
+  for (i = 0; i < AES_BLOCKLEN; ++i) // The block in AES is always 128bit no matter the key size
   {
     buf[i] ^= Iv[i];
   }
 }
 
-void AES_CBC_encrypt_buffer(uint8_t* output, uint8_t* input, uint32_t length, const uint8_t* key, const uint8_t* iv)
+void AES_CBC_encrypt_buffer(const struct AES_ctx* ctx, uint8_t* iv, uint8_t* buf, uint32_t length)
 {
   uintptr_t i;
-//  uint8_t extra = length % BLOCKLEN; /* Remaining bytes in the last non-full block */
-
-  // Skip the key expansion if key is passed as 0
-  if (0 != key)
-  {
-    Key = key;
-    KeyExpansion();
-  }
-
-  if (iv != 0)
+  uint8_t *Iv = iv;
+  for (i = 0; i < length; i += AES_BLOCKLEN)
   {
-    Iv = (uint8_t*)iv;
+    XorWithIv(buf, Iv);
+    EncryptBlock(ctx, buf);
+    Iv = buf;
+    buf += AES_BLOCKLEN;
   }
-
-  for (i = 0; i < length; i += BLOCKLEN)
+  // Store the last cipher block as iv for the next call.
+  if (Iv != iv)
   {
-    XorWithIv(input);
-    memcpy(output, input, BLOCKLEN);
-    state = (state_t*)output;
-    Cipher();
-    Iv = output;
-    input += BLOCKLEN;
-    output += BLOCKLEN;
-    //printf("Step %d - %d", i/16, i);
+    memcpy(iv, Iv, AES_BLOCKLEN);
   }
-
-/*  if (extra)
-  {
-    memcpy(output, input, extra);
-    state = (state_t*)output;
-    Cipher();
-    } */
 }
 
-void AES_CBC_decrypt_buffer(uint8_t* output, uint8_t* input, uint32_t length, const uint8_t* key, const uint8_t* iv)
+void AES_CBC_decrypt_buffer(const struct AES_ctx* ctx, uint8_t* iv, uint8_t* buf, uint32_t length)
 {
   uintptr_t i;
-//  uint8_t extra = length % BLOCKLEN; /* Remaining bytes in the last non-full block */
-
-  // Skip the key expansion if key is passed as 0
-  if (0 != key)
-  {
-    Key = key;
-    KeyExpansion();
-  }
-
-  // If iv is passed as 0, we continue to encrypt without re-setting the Iv
-  if (iv != 0)
+  uint8_t storeNextIv[AES_BLOCKLEN];
+  for (i = 0; i < length; i += AES_BLOCKLEN)
   {
-    Iv = (uint8_t*)iv;
+    memcpy(storeNextIv, buf, AES_BLOCKLEN);
+    DecryptBlock(ctx, buf);
+    XorWithIv(buf, iv);
+    memcpy(iv, storeNextIv, AES_BLOCKLEN);
+    buf += AES_BLOCKLEN;
   }
-
-  for (i = 0; i < length; i += BLOCKLEN)
-  {
-    memcpy(output, input, BLOCKLEN);
-    state = (state_t*)output;
-    InvCipher();
-    XorWithIv(output);
-    Iv = input;
-    input += BLOCKLEN;
-    output += BLOCKLEN;
-  }
-
-/*  if (extra)
-  {
-    memcpy(output, input, extra);
-    state = (state_t*)output;
-    InvCipher();
-    }*/
 }
 
 #endif // #if defined(CBC) && (CBC == 1)
+
+#endif // #if !defined(USE_WMBUS_AES_MBEDTLS)
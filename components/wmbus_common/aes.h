@@ -6,6 +6,8 @@
 
 #include <stdint.h>
 
+#include "esphome/core/defines.h"
+
 
 // #define the macros below to 1/0 to enable/disable the mode of operation.
 //
@@ -25,18 +27,55 @@
 //#define AES192 1
 //#define AES256 1
 
+#define AES_BLOCKLEN 16 // Block length in bytes - AES is 128b block only
+
+#if defined(AES256) && (AES256 == 1)
+    #define AES_KEYLEN 32
+    #define AES_keyExpSize 240
+#elif defined(AES192) && (AES192 == 1)
+    #define AES_KEYLEN 24
+    #define AES_keyExpSize 208
+#else
+    #define AES_KEYLEN 16   // Key length in bytes
+    #define AES_keyExpSize 176
+#endif
+
+// The backend is selected with the aes_backend option of wmbus_common:
+//   default                 byte oriented tiny-AES rounds (smallest).
+//   USE_WMBUS_AES_TTABLE    32-bit T-table rounds, aes.cc.
+//   USE_WMBUS_AES_MBEDTLS   mbedTLS (hardware AES on ESP32), aes_mbedtls.cc.
+
+// The expanded key schedule. All state lives in the context or on the caller's
+// stack, so a context can be expanded once and then shared by several tasks.
+struct AES_ctx
+{
+#if defined(USE_WMBUS_AES_MBEDTLS)
+  uint8_t Key[AES_KEYLEN];
+#elif defined(USE_WMBUS_AES_TTABLE)
+  uint32_t EncKey[AES_keyExpSize / 4];
+  uint32_t DecKey[AES_keyExpSize / 4];
+#else
+  uint8_t RoundKey[AES_keyExpSize];
+#endif
+};
+
+void AES_init_ctx(struct AES_ctx* ctx, const uint8_t* key);
+
 #if defined(ECB) && (ECB == 1)
 
-void AES_ECB_encrypt(const uint8_t* input, const uint8_t* key, uint8_t *output, const uint32_t length);
-void AES_ECB_decrypt(const uint8_t* input, const uint8_t* key, uint8_t *output, const uint32_t length);
+// buffer size is exactly AES_BLOCKLEN bytes, encrypted/decrypted in place.
+void AES_ECB_encrypt(const struct AES_ctx* ctx, uint8_t* buf);
+void AES_ECB_decrypt(const struct AES_ctx* ctx, uint8_t* buf);
 
 #endif // #if defined(ECB) && (ECB == !)
 
 
 #if defined(CBC) && (CBC == 1)
 
-void AES_CBC_encrypt_buffer(uint8_t* output, uint8_t* input, uint32_t length, const uint8_t* key, const uint8_t* iv);
-void AES_CBC_decrypt_buffer(uint8_t* output, uint8_t* input, uint32_t length, const uint8_t* key, const uint8_t* iv);
+// buffer size MUST be a multiple of AES_BLOCKLEN, encrypted/decrypted in place.
+// iv is updated so that consecutive calls continue the chain.
+void AES_CBC_encrypt_buffer(const struct AES_ctx* ctx, uint8_t* iv, uint8_t* buf, uint32_t length);
+void AES_CBC_decrypt_buffer(const struct AES_ctx* ctx, uint8_t* iv, uint8_t* buf, uint32_t length);
 
 #endif // #if defined(CBC) && (CBC == 1)
 
@@ -0,0 +1,72 @@
+// AES backend on top of mbedTLS, selected with aes_backend: mbedtls.
+// On ESP32 mbedTLS uses the hardware AES peripheral, where setting the key is a
+// plain copy. The context therefore only keeps the key and a mbedTLS context is
+// set up per call, which also keeps AES_ctx trivially copyable.
+
+#include "aes.h"
+
+#if defined(USE_WMBUS_AES_MBEDTLS)
+
+#include <string.h>
+
+#include <mbedtls/aes.h>
+
+void AES_init_ctx(struct AES_ctx* ctx, const uint8_t* key)
+{
+  memcpy(ctx->Key, key, AES_KEYLEN);
+}
+
+static void aesCrypt(const struct AES_ctx* ctx, int mode, uint8_t* iv, uint8_t* buf, uint32_t length)
+{
+  mbedtls_aes_context aes;
+  mbedtls_aes_init(&aes);
+  if (mode == MBEDTLS_AES_ENCRYPT)
+  {
+    mbedtls_aes_setkey_enc(&aes, ctx->Key, AES_KEYLEN * 8);
+  }
+  else
+  {
+    mbedtls_aes_setkey_dec(&aes, ctx->Key, AES_KEYLEN * 8);
+  }
+
+  if (iv == NULL)
+  {
+    mbedtls_aes_crypt_ecb(&aes, mode, buf, buf);
+  }
+  else
+  {
+    // mbedTLS reads and writes the same buffer safely and updates iv for chaining.
+    mbedtls_aes_crypt_cbc(&aes, mode, length, iv, buf, buf);
+  }
+  mbedtls_aes_free(&aes);
+}
+
+#if defined(ECB) && (ECB == 1)
+
+void AES_ECB_encrypt(const struct AES_ctx* ctx, uint8_t* buf)
+{
+  aesCrypt(ctx, MBEDTLS_AES_ENCRYPT, NULL, buf, AES_BLOCKLEN);
+}
+
+void AES_ECB_decrypt(const struct AES_ctx* ctx, uint8_t* buf)
+{
+  aesCrypt(ctx, MBEDTLS_AES_DECRYPT, NULL, buf, AES_BLOCKLEN);
+}
+
+#endif // #if defined(ECB) && (ECB == 1)
+
+#if defined(CBC) && (CBC == 1)
+
+void AES_CBC_encrypt_buffer(const struct AES_ctx* ctx, uint8_t* iv, uint8_t* buf, uint32_t length)
+{
+  aesCrypt(ctx, MBEDTLS_AES_ENCRYPT, iv, buf, length);
+}
+
+void AES_CBC_decrypt_buffer(const struct AES_ctx* ctx, uint8_t* iv, uint8_t* buf, uint32_t length)
+{
+  aesCrypt(ctx, MBEDTLS_AES_DECRYPT, iv, buf, length);
+}
+
+#endif // #if defined(CBC) && (CBC == 1)
+
+#endif // #if defined(USE_WMBUS_AES_MBEDTLS)
@@ -15,6 +15,7 @@
  along with this program.  If not, see <http://www.gnu.org/licenses/>.
 */
 
+#include<algorithm>
 #include<stdio.h>
 #include<memory.h>
 #include"aes.h"
@@ -26,15 +27,14 @@ uchar vec87[16] = {
     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x87
 };
 
-void generateSubkeys(uchar *key, uchar *K1, uchar *K2)
+void generateSubkeys(const AES_ctx *ctx, uchar *K1, uchar *K2)
 {
     uchar L[16];
-    uchar Z[16];
     uchar tmp[16];
 
-    memset(Z, 0, 16);
+    memset(L, 0, 16);
 
-    AES_ECB_encrypt(Z, key, L, 16);
+    AES_ECB_encrypt(ctx, L);
 
     if (!(L[0] & 0x80))
     {
@@ -57,66 +57,74 @@ void generateSubkeys(uchar *key, uchar *K1, uchar *K2)
     }
 }
 
-void pad(uchar *in, uchar *out, int len)
+void AES_CMAC_init(AES_CMAC_ctx *ctx, const uchar *key)
 {
-    for (int i = 0; i < 16; i++)
-    {
-        if (i < len)
-        {
-            out[i] = in[i];
-        }
-        else if (i == len)
-        {
-            out[i] = 0x80;
-        }
-        else
-        {
-            out[i] = 0x00;
-        }
-    }
+    AES_init_ctx(&ctx->aes, key);
+    generateSubkeys(&ctx->aes, ctx->K1, ctx->K2);
 }
 
-void AES_CMAC(uchar *key, uchar *input, int len, uchar *mac)
+void AES_CMAC_start(AES_CMAC_state *state)
 {
-    bool len_is_multiple_of_block;
-    uchar X[16], Y[16];
-    uchar K1[16], K2[16];
-    uchar M_last[16], padded[16];
-
-    generateSubkeys(key, K1, K2);
-
-    int num_blocks = (len+15)/16;
+    memset(state->X, 0, 16);
+    state->len = 0;
+}
 
-    if (!num_blocks)
-    {
-        num_blocks = 1;
-        len_is_multiple_of_block = false;
-    }
-    else
+void AES_CMAC_update(const AES_CMAC_ctx *ctx, AES_CMAC_state *state, const uchar *input, int len)
+{
+    while (len > 0)
     {
-        len_is_multiple_of_block = !(len%16);
+        // The last block gets special treatment in finish, so a full block is
+        // only encrypted once more data is known to follow it.
+        if (state->len == 16)
+        {
+            for (int i = 0; i < 16; i++) state->X[i] ^= state->M[i];
+            AES_ECB_encrypt(&ctx->aes, state->X);
+            state->len = 0;
+        }
+        int n = std::min(16 - state->len, len);
+        memcpy(state->M + state->len, input, n);
+        state->len += n;
+        input += n;
+        len -= n;
     }
+}
 
-    if (len_is_multiple_of_block)
+void AES_CMAC_finish(const AES_CMAC_ctx *ctx, AES_CMAC_state *state, uchar *mac)
+{
+    if (state->len == 16)
     {
-        xorit(input+(16*(num_blocks-1)), K1, M_last, 16);
+        for (int i = 0; i < 16; i++) state->X[i] ^= state->M[i] ^ ctx->K1[i];
     }
     else
     {
-        pad(input+(16*(num_blocks-1)), padded, len%16);
-        xorit(padded, K2, M_last, 16);
+        // Pad with 10..0 and use K2 for an empty or incomplete last block.
+        state->M[state->len] = 0x80;
+        memset(state->M + state->len + 1, 0, 15 - state->len);
+        for (int i = 0; i < 16; i++) state->X[i] ^= state->M[i] ^ ctx->K2[i];
     }
+    AES_ECB_encrypt(&ctx->aes, state->X);
+    memcpy(mac, state->X, 16);
+}
 
-    memset(X, 0, 16);
-
-    for (int i=0; i<num_blocks-1; i++)
-    {
-        xorit(X, input+(16*i), Y, 16);
-        AES_ECB_encrypt(Y, key, X, 16);
-    }
+void AES_CMAC(const AES_CMAC_ctx *ctx, const uchar *input, int len, uchar *mac)
+{
+    AES_CMAC_state state;
+    AES_CMAC_start(&state);
+    AES_CMAC_update(ctx, &state, input, len);
+    AES_CMAC_finish(ctx, &state, mac);
+}
 
-    xorit(X,M_last,Y, 16);
-    AES_ECB_encrypt(Y, key, X, 16);
+void AES_CMAC(uchar *key, uchar *input, int len, uchar *mac)
+{
+    AES_CMAC_ctx ctx;
+    AES_CMAC_init(&ctx, key);
+    AES_CMAC(&ctx, input, len, mac);
+}
 
-    memcpy(mac, X, 16);
+bool AES_CMAC_equal(const uchar *a, const uchar *b, int len)
+{
+    // Constant time, the time taken does not depend on where the MACs differ.
+    uchar diff = 0;
+    for (int i = 0; i < len; i++) diff |= a[i] ^ b[i];
+    return diff == 0;
 }
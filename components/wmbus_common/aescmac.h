@@ -18,8 +18,35 @@
 #ifndef _AESCMAC_H_
 #define _AESCMAC_H_
 
+#include"aes.h"
+
 typedef unsigned char uchar;
 
+// Expanded key schedule and K1/K2 subkeys, computed once per key.
+struct AES_CMAC_ctx
+{
+    AES_ctx aes;
+    uchar K1[16];
+    uchar K2[16];
+};
+
+// Running state for a MAC over input given in several pieces.
+struct AES_CMAC_state
+{
+    uchar X[16];
+    uchar M[16];
+    int len;
+};
+
+void AES_CMAC_init(AES_CMAC_ctx *ctx, const uchar *key);
+void AES_CMAC_start(AES_CMAC_state *state);
+void AES_CMAC_update(const AES_CMAC_ctx *ctx, AES_CMAC_state *state, const uchar *input, int length);
+void AES_CMAC_finish(const AES_CMAC_ctx *ctx, AES_CMAC_state *state, uchar *mac);
+
+void AES_CMAC(const AES_CMAC_ctx *ctx, const uchar *input, int length, uchar *mac);
 void AES_CMAC (uchar *key, uchar *input, int length, uchar *mac);
 
+// Compares two MACs in constant time.
+bool AES_CMAC_equal(const uchar *a, const uchar *b, int length);
+
 #endif //_AESCMAC_H_
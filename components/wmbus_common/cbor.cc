@@ -0,0 +1,89 @@
+#include"cbor.h"
+
+#include<math.h>
+#include<string.h>
+
+void cborAppendHead(std::string *out, int major, uint64_t v)
+{
+    char m = major << 5;
+    if (v < 24)
+    {
+        out->push_back(m | v);
+        return;
+    }
+
+    int bytes;
+    if (v <= 0xff) { out->push_back(m | 24); bytes = 1; }
+    else if (v <= 0xffff) { out->push_back(m | 25); bytes = 2; }
+    else if (v <= 0xffffffff) { out->push_back(m | 26); bytes = 4; }
+    else { out->push_back(m | 27); bytes = 8; }
+
+    for (int i = bytes-1; i >= 0; i--)
+    {
+        out->push_back((v >> (8*i)) & 0xff);
+    }
+}
+
+void cborAppendInt(std::string *out, int64_t v)
+{
+    if (v >= 0) cborAppendHead(out, CBOR_UNSIGNED, v);
+    else cborAppendHead(out, CBOR_NEGATIVE, -1-v);
+}
+
+void cborAppendText(std::string *out, const std::string &s)
+{
+    cborAppendHead(out, CBOR_TEXT, s.length());
+    out->append(s);
+}
+
+void cborAppendText(std::string *out, const char *s)
+{
+    size_t len = strlen(s);
+    cborAppendHead(out, CBOR_TEXT, len);
+    out->append(s, len);
+}
+
+void cborAppendNumber(std::string *out, double v)
+{
+    if (isnan(v))
+    {
+        cborAppendNull(out);
+        return;
+    }
+    // Doubles hold all integers up to 2^53 exactly.
+    if (v == floor(v) && fabs(v) < 9007199254740992.0)
+    {
+        cborAppendInt(out, (int64_t)v);
+        return;
+    }
+
+    float f = v;
+    if ((double)f == v)
+    {
+        uint32_t bits;
+        memcpy(&bits, &f, sizeof(bits));
+        out->push_back(0xfa);
+        for (int i = 3; i >= 0; i--) out->push_back((bits >> (8*i)) & 0xff);
+        return;
+    }
+
+    uint64_t bits;
+    memcpy(&bits, &v, sizeof(bits));
+    out->push_back(0xfb);
+    for (int i = 7; i >= 0; i--) out->push_back((bits >> (8*i)) & 0xff);
+}
+
+void cborAppendNull(std::string *out)
+{
+    out->push_back(0xf6);
+}
+
+void cborAppendIndefiniteMap(std::string *out)
+{
+    out->push_back(0xbf);
+}
+
+void cborAppendBreak(std::string *out)
+{
+    out->push_back(0xff);
+}
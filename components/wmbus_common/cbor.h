@@ -0,0 +1,31 @@
+// Minimal CBOR (RFC 8949) encoder for the binary telegram output of printMeterCbor.
+// Everything is appended to a std::string, which is used as a byte buffer just like
+// the json output, so both can be sent with mqtt.publish or socket_transmitter.send.
+
+#ifndef CBOR_H
+#define CBOR_H
+
+#include<stdint.h>
+#include<string>
+
+#define CBOR_UNSIGNED 0
+#define CBOR_NEGATIVE 1
+#define CBOR_TEXT 3
+#define CBOR_ARRAY 4
+#define CBOR_MAP 5
+#define CBOR_TAG 6
+
+// Append the initial byte(s) of a data item with the shortest argument encoding.
+void cborAppendHead(std::string *out, int major, uint64_t v);
+void cborAppendInt(std::string *out, int64_t v);
+void cborAppendText(std::string *out, const std::string &s);
+void cborAppendText(std::string *out, const char *s);
+// Integral values become integers, other values the smallest float that holds them exactly.
+// Nan becomes null, the same as in the json.
+void cborAppendNumber(std::string *out, double v);
+void cborAppendNull(std::string *out);
+// A map of unknown size, closed by cborAppendBreak.
+void cborAppendIndefiniteMap(std::string *out);
+void cborAppendBreak(std::string *out);
+
+#endif
@@ -1,8 +1,13 @@
 #include "component.h"
 
+#include <memory>
+
+#include "dvparser.h"
 #include "meters.h"
 
 #include "esphome/core/defines.h"
+#include "esphome/core/hal.h"
+#include "esphome/core/helpers.h"
 #include "esphome/core/log.h"
 
 namespace esphome
@@ -11,26 +16,60 @@ namespace esphome
     {
         static const char *TAG = "wmbus_common";
 
-        std::vector<std::string> sorted_driver_names()
-        {
-            std::vector<std::string> driver_names;
-            driver_names.reserve(allDrivers().size());
-            for (auto &driver : allDrivers())
-                driver_names.push_back(driver->name().str());
-            std::sort(driver_names.begin(), driver_names.end());
-            return driver_names;
-        }
-
-        const std::vector<std::string> driver_names = std::move(sorted_driver_names());
+#ifdef USE_WMBUS_PERSIST_FORMAT_SIGNATURES
+        // After the first save, the formats are saved at most this often.
+        static const uint32_t FORMAT_SIGNATURES_SAVE_INTERVAL_MS = 60 * 60 * 1000;
+#endif
 
         void WMBusCommon::dump_config()
         {
             ESP_LOGCONFIG(TAG, "wM-Bus Component:");
             ESP_LOGCONFIG(TAG, "  wmbusmeters version: %s", WMBUSMETERS_TAG);
             ESP_LOGCONFIG(TAG, "  Loaded drivers:");
-            for (auto &driver : driver_names)
-                ESP_LOGCONFIG(TAG, ("    - " + driver).c_str());
+            // The driver table is generated in sorted order.
+            for (auto driver : allDrivers())
+                ESP_LOGCONFIG(TAG, "    - %s", driver->nameCStr());
+#ifdef USE_WMBUS_PERSIST_FORMAT_SIGNATURES
+            ESP_LOGCONFIG(TAG, "  Persisting compact frame formats: YES");
+#endif
+        }
+
+#ifdef USE_WMBUS_PERSIST_FORMAT_SIGNATURES
+        void WMBusCommon::setup()
+        {
+            this->format_signatures_pref_ =
+                global_preferences->make_preference<FormatSignatureCache>(fnv1_hash("wmbus_format_signatures"));
+
+            // On the heap, it is too large for the loop task stack.
+            auto cache = std::make_unique<FormatSignatureCache>();
+            if (this->format_signatures_pref_.load(cache.get()))
+            {
+                restoreFormatSignatureCache(*cache);
+                ESP_LOGD(TAG, "Restored compact frame formats");
+            }
+            this->saved_format_signatures_generation_ = formatSignatureCacheGeneration();
+        }
+
+        void WMBusCommon::loop()
+        {
+            // Only formats not seen before since boot are written, the usage stamps and formats
+            // learned again after an eviction are not worth a flash write.
+            auto generation = formatSignatureCacheGeneration();
+            if (generation == this->saved_format_signatures_generation_)
+                return;
+            if (this->format_signatures_saved_ &&
+                millis() - this->last_format_signatures_save_ < FORMAT_SIGNATURES_SAVE_INTERVAL_MS)
+                return;
+
+            if (this->format_signatures_pref_.save(&formatSignatureCache()))
+            {
+                this->saved_format_signatures_generation_ = generation;
+                this->last_format_signatures_save_ = millis();
+                this->format_signatures_saved_ = true;
+                ESP_LOGD(TAG, "Saved compact frame formats");
+            }
         }
+#endif
 
     }
 }
\ No newline at end of file
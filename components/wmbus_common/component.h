@@ -1,16 +1,30 @@
 #pragma once
 #include "esphome/core/component.h"
+#include "esphome/core/defines.h"
+
+#ifdef USE_WMBUS_PERSIST_FORMAT_SIGNATURES
+#include "esphome/core/preferences.h"
+#endif
 
 namespace esphome
 {
     namespace wmbus_common
     {
-        extern const std::vector<std::string> driver_names;
-        
         class WMBusCommon : public Component
         {
         public:
             void dump_config() override;
+#ifdef USE_WMBUS_PERSIST_FORMAT_SIGNATURES
+            void setup() override;
+            void loop() override;
+
+        protected:
+            // Compact frame formats learned from full frames, kept across reboots.
+            ESPPreferenceObject format_signatures_pref_;
+            uint32_t saved_format_signatures_generation_ = 0;
+            uint32_t last_format_signatures_save_ = 0;
+            bool format_signatures_saved_ = false;
+#endif
         };
     } // namespace wmbus_common
 } // namespace esphome
\ No newline at end of file
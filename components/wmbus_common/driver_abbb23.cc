@@ -21,20 +21,29 @@ namespace
 {
     struct Driver : public virtual MeterCommonImplementation
     {
-        Driver(MeterInfo &mi, DriverInfo &di);
+        Driver(MeterInfo &mi, const DriverInfo &di);
     };
 
-    static bool ok = registerDriver([](DriverInfo&di)
+    constexpr DriverDetect detection[] =
     {
-        di.setName("abbb23");
-        di.setDefaultFields("name,id,total_energy_consumption_kwh,timestamp");
-        di.setMeterType(MeterType::ElectricityMeter);
-        di.addLinkMode(LinkMode::T1);
-        di.addDetection(MANUFACTURER_ABB,  0x02,  0x20);
-        di.setConstructor([](MeterInfo& mi, DriverInfo& di){ return shared_ptr<Meter>(new Driver(mi, di)); });
-    });
-
-    Driver::Driver(MeterInfo &mi, DriverInfo &di) : MeterCommonImplementation(mi, di)
+        { MANUFACTURER_ABB,  0x02,  0x20 },
+    };
+}
+
+extern constexpr DriverInfo driver_info_abbb23 = []
+{
+    DriverInfo di("abbb23");
+    di.setDefaultFields("name,id,total_energy_consumption_kwh,timestamp");
+    di.setMeterType(MeterType::ElectricityMeter);
+    di.addLinkMode(LinkMode::T1);
+    di.setDetection(detection);
+    di.setConstructor([](MeterInfo& mi, const DriverInfo& di){ return shared_ptr<Meter>(new Driver(mi, di)); });
+    return di;
+}();
+
+namespace
+{
+    Driver::Driver(MeterInfo &mi, const DriverInfo &di) : MeterCommonImplementation(mi, di)
     {
       addStringField(
             "status",
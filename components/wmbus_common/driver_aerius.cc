@@ -21,20 +21,29 @@ namespace
 {
     struct Driver : public virtual MeterCommonImplementation
     {
-        Driver(MeterInfo &mi, DriverInfo &di);
+        Driver(MeterInfo &mi, const DriverInfo &di);
     };
 
-    static bool ok = registerDriver([](DriverInfo&di)
+    constexpr DriverDetect detection[] =
     {
-        di.setName("aerius");
-        di.setDefaultFields("name,id,total_m3,timestamp");
-        di.setMeterType(MeterType::GasMeter);
-        di.addLinkMode(LinkMode::T1);
-        di.addDetection(MANUFACTURER_DME, 0x03, 0x30);
-        di.setConstructor([](MeterInfo& mi, DriverInfo& di){ return shared_ptr<Meter>(new Driver(mi, di)); });
-    });
+        { MANUFACTURER_DME, 0x03, 0x30 },
+    };
+}
+
+extern constexpr DriverInfo driver_info_aerius = []
+{
+    DriverInfo di("aerius");
+    di.setDefaultFields("name,id,total_m3,timestamp");
+    di.setMeterType(MeterType::GasMeter);
+    di.addLinkMode(LinkMode::T1);
+    di.setDetection(detection);
+    di.setConstructor([](MeterInfo& mi, const DriverInfo& di){ return shared_ptr<Meter>(new Driver(mi, di)); });
+    return di;
+}();
 
-    Driver::Driver(MeterInfo &mi, DriverInfo &di) : MeterCommonImplementation(mi, di)
+namespace
+{
+    Driver::Driver(MeterInfo &mi, const DriverInfo &di) : MeterCommonImplementation(mi, di)
     {
         addNumericFieldWithExtractor(
             "total",
@@ -21,28 +21,37 @@ namespace
 {
     struct Driver : public virtual MeterCommonImplementation
     {
-        Driver(MeterInfo &mi, DriverInfo &di);
+        Driver(MeterInfo &mi, const DriverInfo &di);
     };
 
-    static bool ok = registerDriver([](DriverInfo&di)
+    constexpr DriverDetect detection[] =
     {
-        di.setName("amiplus");
-        di.setDefaultFields("name,id,total_energy_consumption_kwh,current_power_consumption_kw,total_energy_production_kwh,current_power_production_kw,voltage_at_phase_1_v,voltage_at_phase_2_v,voltage_at_phase_3_v,total_energy_consumption_tariff_1_kwh,total_energy_consumption_tariff_2_kwh,total_energy_consumption_tariff_3_kwh,total_energy_production_tariff_1_kwh,total_energy_production_tariff_2_kwh,total_energy_production_tariff_3_kwh,timestamp");
-        di.setMeterType(MeterType::ElectricityMeter);
-        di.addLinkMode(LinkMode::T1);
-        di.addDetection(MANUFACTURER_APA,  0x02,  0x02);
-        di.addDetection(MANUFACTURER_DEV,  0x37,  0x02);
-        di.addDetection(MANUFACTURER_DEV,  0x02,  0x00);
-        di.addDetection(MANUFACTURER_DEV,  0x02,  0x01);
+        { MANUFACTURER_APA,  0x02,  0x02 },
+        { MANUFACTURER_DEV,  0x37,  0x02 },
+        { MANUFACTURER_DEV,  0x02,  0x00 },
+        { MANUFACTURER_DEV,  0x02,  0x01 },
         // Apator Otus 1/3 seems to use both, depending on a frame.
         // Frames with APA are successfully decoded by this driver
         // Frames with APT are not - and their content is unknown - perhaps it broadcasts two data formats?
-        di.addDetection(MANUFACTURER_APA,  0x02,  0x01);
-        //di.addDetection(MANUFACTURER_APT,  0x02,  0x01);
-        di.setConstructor([](MeterInfo& mi, DriverInfo& di){ return shared_ptr<Meter>(new Driver(mi, di)); });
-    });
+        { MANUFACTURER_APA,  0x02,  0x01 },
+    };
+}
+
+extern constexpr DriverInfo driver_info_amiplus = []
+{
+    DriverInfo di("amiplus");
+    di.setDefaultFields("name,id,total_energy_consumption_kwh,current_power_consumption_kw,total_energy_production_kwh,current_power_production_kw,voltage_at_phase_1_v,voltage_at_phase_2_v,voltage_at_phase_3_v,total_energy_consumption_tariff_1_kwh,total_energy_consumption_tariff_2_kwh,total_energy_consumption_tariff_3_kwh,total_energy_production_tariff_1_kwh,total_energy_production_tariff_2_kwh,total_energy_production_tariff_3_kwh,timestamp");
+    di.setMeterType(MeterType::ElectricityMeter);
+    di.addLinkMode(LinkMode::T1);
+    di.setDetection(detection);
+    //di.addDetection(MANUFACTURER_APT,  0x02,  0x01);
+    di.setConstructor([](MeterInfo& mi, const DriverInfo& di){ return shared_ptr<Meter>(new Driver(mi, di)); });
+    return di;
+}();
 
-    Driver::Driver(MeterInfo &mi, DriverInfo &di) : MeterCommonImplementation(mi, di)
+namespace
+{
+    Driver::Driver(MeterInfo &mi, const DriverInfo &di) : MeterCommonImplementation(mi, di)
     {
         addNumericFieldWithExtractor(
             "total_energy_consumption",
@@ -21,26 +21,37 @@ namespace
 {
     struct Driver : public virtual MeterCommonImplementation
     {
-        Driver(MeterInfo &mi, DriverInfo &di);
+        Driver(MeterInfo &mi, const DriverInfo &di);
 
     private:
 
         void processContent(Telegram *t);
     };
 
-    static bool ok = registerDriver([](DriverInfo&di)
+    constexpr DriverDetect detection[] =
     {
-        di.setName("apator08");
-        di.setDefaultFields("name,id,total_m3,timestamp");
-        di.setMeterType(MeterType::WaterMeter);
-        di.addLinkMode(LinkMode::T1);
-        di.addDetection(MANUFACTURER_APT, 0x03,  0x03);
-        di.addDetection(MANUFACTURER_APT, 0x0F, 0x0F);
-        di.usesProcessContent();
-        di.setConstructor([](MeterInfo& mi, DriverInfo& di){ return shared_ptr<Meter>(new Driver(mi, di)); });
-    });
-
-    Driver::Driver(MeterInfo &mi, DriverInfo &di) : MeterCommonImplementation(mi, di)
+        { MANUFACTURER_APT, 0x03,  0x03 },
+        { MANUFACTURER_APT, 0x0F, 0x0F },
+    };
+}
+
+extern constexpr DriverInfo driver_info_apator08 = []
+{
+    DriverInfo di("apator08");
+    di.setDefaultFields("name,id,total_m3,timestamp");
+    di.setMeterType(MeterType::WaterMeter);
+    di.addLinkMode(LinkMode::T1);
+    di.setDetection(detection);
+    di.usesProcessContent();
+    // processContent patches the telegram header, so it must run for every telegram.
+    di.extractUnchangedPayloads();
+    di.setConstructor([](MeterInfo& mi, const DriverInfo& di){ return shared_ptr<Meter>(new Driver(mi, di)); });
+    return di;
+}();
+
+namespace
+{
+    Driver::Driver(MeterInfo &mi, const DriverInfo &di) : MeterCommonImplementation(mi, di)
     {
         addNumericField(
             "total",
@@ -21,28 +21,37 @@ namespace
 {
     struct Driver : public virtual MeterCommonImplementation
     {
-        Driver(MeterInfo &mi, DriverInfo &di);
+        Driver(MeterInfo &mi, const DriverInfo &di);
 
         void processContent(Telegram *t);
         void processExtras(std::string miExtras);
         int registerSize(int c);
     };
 
-    static bool ok = registerDriver([](DriverInfo&di)
+    constexpr DriverDetect detection[] =
     {
-        di.setName("apator162");
-        di.setDefaultFields("name,id,total_m3,timestamp");
-        di.setMeterType(MeterType::WaterMeter);
-        di.addLinkMode(LinkMode::T1);
-        di.addLinkMode(LinkMode::C1);
-        di.addDetection(MANUFACTURER_APA,  0x06,  0x05);
-        di.addDetection(MANUFACTURER_APA,  0x07,  0x05);
-        di.addDetection(0x8614 /*APT?*/, 0x07,  0x05); // Older version of telegram that is not understood!
-        di.usesProcessContent();
-        di.setConstructor([](MeterInfo& mi, DriverInfo& di){ return shared_ptr<Meter>(new Driver(mi, di)); });
-    });
-
-    Driver::Driver(MeterInfo &mi, DriverInfo &di) : MeterCommonImplementation(mi, di)
+        { MANUFACTURER_APA,  0x06,  0x05 },
+        { MANUFACTURER_APA,  0x07,  0x05 },
+        { 0x8614 /*APT?*/, 0x07,  0x05 }, // Older version of telegram that is not understood!
+    };
+}
+
+extern constexpr DriverInfo driver_info_apator162 = []
+{
+    DriverInfo di("apator162");
+    di.setDefaultFields("name,id,total_m3,timestamp");
+    di.setMeterType(MeterType::WaterMeter);
+    di.addLinkMode(LinkMode::T1);
+    di.addLinkMode(LinkMode::C1);
+    di.setDetection(detection);
+    di.usesProcessContent();
+    di.setConstructor([](MeterInfo& mi, const DriverInfo& di){ return shared_ptr<Meter>(new Driver(mi, di)); });
+    return di;
+}();
+
+namespace
+{
+    Driver::Driver(MeterInfo &mi, const DriverInfo &di) : MeterCommonImplementation(mi, di)
     {
         processExtras(mi.extras);
 
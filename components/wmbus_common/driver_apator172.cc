@@ -23,22 +23,33 @@ namespace
 {
     struct Driver : public virtual MeterCommonImplementation
     {
-        Driver(MeterInfo &mi, DriverInfo &di);
+        Driver(MeterInfo &mi, const DriverInfo &di);
 
         void processContent(Telegram *t);
     };
 
-    static bool ok = registerDriver([](DriverInfo&di)
+    constexpr DriverDetect detection[] =
     {
-        di.setName("apator172");
-        di.setDefaultFields("name,id,total_m3,timestamp");
-        di.setMeterType(MeterType::WaterMeter);
-        di.addDetection(0x8614 /*APT?*/,  0x11,  0x04);
-        di.usesProcessContent();
-        di.setConstructor([](MeterInfo& mi, DriverInfo& di){ return shared_ptr<Meter>(new Driver(mi, di)); });
-    });
-
-    Driver::Driver(MeterInfo &mi, DriverInfo &di) : MeterCommonImplementation(mi, di)
+        { 0x8614 /*APT?*/,  0x11,  0x04 },
+    };
+}
+
+extern constexpr DriverInfo driver_info_apator172 = []
+{
+    DriverInfo di("apator172");
+    di.setDefaultFields("name,id,total_m3,timestamp");
+    di.setMeterType(MeterType::WaterMeter);
+    di.setDetection(detection);
+    di.usesProcessContent();
+    // processContent patches the telegram header, so it must run for every telegram.
+    di.extractUnchangedPayloads();
+    di.setConstructor([](MeterInfo& mi, const DriverInfo& di){ return shared_ptr<Meter>(new Driver(mi, di)); });
+    return di;
+}();
+
+namespace
+{
+    Driver::Driver(MeterInfo &mi, const DriverInfo &di) : MeterCommonImplementation(mi, di)
     {
         addNumericField(
             "total",
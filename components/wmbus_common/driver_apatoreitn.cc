@@ -22,27 +22,36 @@ namespace
 {
     struct Driver : public virtual MeterCommonImplementation
     {
-        Driver(MeterInfo &mi, DriverInfo &di);
+        Driver(MeterInfo &mi, const DriverInfo &di);
 
         void processContent(Telegram *t);
         std::string dateToString(uchar date_lo, uchar date_hi);
     };
 
-    static bool ok = registerDriver([](DriverInfo&di)
+    constexpr DriverDetect detection[] =
     {
-        // Note: this supports only E.ITN 30.51 at the moment.
-        // E.ITN 30.60 should be similar, as it is covered via the same datasheet
-        // http://www.apator.com/uploads/files/Produkty/Podzielnik_kosztow_ogrzewania/i-pl-021-2016-e-itn-30-51-30-6.pdf
-        di.setName("apatoreitn");
-        di.setDefaultFields("name,id,current_hca,previous_hca,current_date,season_start_date,esb_date,temp_room_avg_c,temp_room_prev_avg_c,timestamp");
-        di.setMeterType(MeterType::HeatCostAllocationMeter);
-        di.addDetection(MANUFACTURER_APA, 0x08,  0x04);
-        di.addDetection(MANUFACTURER_APT, 0x08,  0x04);
-        di.usesProcessContent();
-        di.setConstructor([](MeterInfo& mi, DriverInfo& di){ return shared_ptr<Meter>(new Driver(mi, di)); });
-    });
-
-    Driver::Driver(MeterInfo &mi, DriverInfo &di) : MeterCommonImplementation(mi, di)
+        { MANUFACTURER_APA, 0x08,  0x04 },
+        { MANUFACTURER_APT, 0x08,  0x04 },
+    };
+}
+
+extern constexpr DriverInfo driver_info_apatoreitn = []
+{
+    DriverInfo di("apatoreitn");
+    // Note: this supports only E.ITN 30.51 at the moment.
+    // E.ITN 30.60 should be similar, as it is covered via the same datasheet
+    // http://www.apator.com/uploads/files/Produkty/Podzielnik_kosztow_ogrzewania/i-pl-021-2016-e-itn-30-51-30-6.pdf
+    di.setDefaultFields("name,id,current_hca,previous_hca,current_date,season_start_date,esb_date,temp_room_avg_c,temp_room_prev_avg_c,timestamp");
+    di.setMeterType(MeterType::HeatCostAllocationMeter);
+    di.setDetection(detection);
+    di.usesProcessContent();
+    di.setConstructor([](MeterInfo& mi, const DriverInfo& di){ return shared_ptr<Meter>(new Driver(mi, di)); });
+    return di;
+}();
+
+namespace
+{
+    Driver::Driver(MeterInfo &mi, const DriverInfo &di) : MeterCommonImplementation(mi, di)
     {
         addNumericField("current",
                  Quantity::HCA,
@@ -23,22 +23,33 @@ namespace
 {
     struct Driver : public virtual MeterCommonImplementation
     {
-        Driver(MeterInfo &mi, DriverInfo &di);
+        Driver(MeterInfo &mi, const DriverInfo &di);
 
         void processContent(Telegram *t);
     };
 
-    static bool ok = registerDriver([](DriverInfo&di)
+    constexpr DriverDetect detection[] =
     {
-        di.setName("apatorna1");
-        di.setDefaultFields("name,id,total_m3,timestamp");
-        di.setMeterType(MeterType::WaterMeter);
-        di.addDetection(MANUFACTURER_APA,  0x07,  0x14);
-        di.usesProcessContent();
-        di.setConstructor([](MeterInfo& mi, DriverInfo& di){ return shared_ptr<Meter>(new Driver(mi, di)); });
-    });
-
-    Driver::Driver(MeterInfo &mi, DriverInfo &di) : MeterCommonImplementation(mi, di)
+        { MANUFACTURER_APA,  0x07,  0x14 },
+    };
+}
+
+extern constexpr DriverInfo driver_info_apatorna1 = []
+{
+    DriverInfo di("apatorna1");
+    di.setDefaultFields("name,id,total_m3,timestamp");
+    di.setMeterType(MeterType::WaterMeter);
+    di.setDetection(detection);
+    di.usesProcessContent();
+    // processContent patches the telegram header, so it must run for every telegram.
+    di.extractUnchangedPayloads();
+    di.setConstructor([](MeterInfo& mi, const DriverInfo& di){ return shared_ptr<Meter>(new Driver(mi, di)); });
+    return di;
+}();
+
+namespace
+{
+    Driver::Driver(MeterInfo &mi, const DriverInfo &di) : MeterCommonImplementation(mi, di)
     {
         addNumericField(
             "total",
@@ -58,14 +69,20 @@ namespace
         std::vector<uchar>::iterator pos = frame.begin();
 
         // TODO: read specified key from input
-        std::vector<uchar> aes_key(16, 0);
+        static const AES_ctx aes_ctx = []
+        {
+            AES_ctx ctx;
+            uchar aes_key[AES_KEYLEN] {};
+            AES_init_ctx(&ctx, aes_key);
+            return ctx;
+        }();
 
         int num_encrypted_bytes = 0;
         int num_not_encrypted_at_end = 0;
 
         t->tpl_acc = content[0]; //0xBB;
 
-        decrypt_TPL_AES_CBC_IV(t, frame, pos, aes_key, &num_encrypted_bytes, &num_not_encrypted_at_end);
+        decrypt_TPL_AES_CBC_IV(t, frame, pos, &aes_ctx, &num_encrypted_bytes, &num_not_encrypted_at_end);
 
         const int multiplier = pow(10, (frame.at(1) & 0b00110000) >> 4);
 
@@ -19,24 +19,23 @@
 
 struct MeterAuto : public virtual MeterCommonImplementation
 {
-    MeterAuto(MeterInfo &mi, DriverInfo &di);
+    MeterAuto(MeterInfo &mi, const DriverInfo &di);
 };
 
-bool ok = registerDriver([](DriverInfo&di)
+extern constexpr DriverInfo driver_info_auto = []
 {
-    di.setName("auto");
+    DriverInfo di("auto");
     di.setDefaultFields("name,id,timestamp");
     di.setMeterType(MeterType::AutoMeter);
-    di.setConstructor([](MeterInfo& mi, DriverInfo& di){ return shared_ptr<Meter>(new MeterAuto(mi, di)); });
-});
+    di.setConstructor([](MeterInfo& mi, const DriverInfo& di){ return shared_ptr<Meter>(new MeterAuto(mi, di)); });
+    return di;
+}();
 
-MeterAuto::MeterAuto(MeterInfo &mi, DriverInfo &di) : MeterCommonImplementation(mi, di)
+MeterAuto::MeterAuto(MeterInfo &mi, const DriverInfo &di) : MeterCommonImplementation(mi, di)
 {
 }
 
 shared_ptr<Meter> createAuto(MeterInfo &mi)
 {
-    DriverInfo di;
-    di.setName("auto");
-    return shared_ptr<Meter>(new MeterAuto(mi, di));
+    return shared_ptr<Meter>(new MeterAuto(mi, driver_info_auto));
 }
@@ -21,20 +21,29 @@ namespace
 {
     struct Driver : public virtual MeterCommonImplementation
     {
-        Driver(MeterInfo &mi, DriverInfo &di);
+        Driver(MeterInfo &mi, const DriverInfo &di);
     };
 
-    static bool ok = registerDriver([](DriverInfo&di)
+    constexpr DriverDetect detection[] =
     {
-        di.setName("aventieshca");
-        di.setDefaultFields("name,id,current_consumption_hca,error_flags,timestamp");
-        di.setMeterType(MeterType::HeatCostAllocationMeter);
-        di.addLinkMode(LinkMode::T1);
-        di.addDetection(MANUFACTURER_AAA, 0x08,  0x55);
-        di.setConstructor([](MeterInfo& mi, DriverInfo& di){ return shared_ptr<Meter>(new Driver(mi, di)); });
-    });
+        { MANUFACTURER_AAA, 0x08,  0x55 },
+    };
+}
+
+extern constexpr DriverInfo driver_info_aventieshca = []
+{
+    DriverInfo di("aventieshca");
+    di.setDefaultFields("name,id,current_consumption_hca,error_flags,timestamp");
+    di.setMeterType(MeterType::HeatCostAllocationMeter);
+    di.addLinkMode(LinkMode::T1);
+    di.setDetection(detection);
+    di.setConstructor([](MeterInfo& mi, const DriverInfo& di){ return shared_ptr<Meter>(new Driver(mi, di)); });
+    return di;
+}();
 
-    Driver::Driver(MeterInfo &mi, DriverInfo &di) : MeterCommonImplementation(mi, di)
+namespace
+{
+    Driver::Driver(MeterInfo &mi, const DriverInfo &di) : MeterCommonImplementation(mi, di)
     {
         addStringFieldWithExtractorAndLookup(
             "status",
@@ -21,20 +21,29 @@ namespace
 {
     struct Driver : public virtual MeterCommonImplementation
     {
-        Driver(MeterInfo &mi, DriverInfo &di);
+        Driver(MeterInfo &mi, const DriverInfo &di);
     };
 
-    static bool ok = registerDriver([](DriverInfo&di)
+    constexpr DriverDetect detection[] =
     {
-        di.setName("aventieswm");
-        di.setDefaultFields("name,id,total_m3,error_flags,timestamp");
-        di.setMeterType(MeterType::WaterMeter);
-        di.addLinkMode(LinkMode::T1);
-        di.addDetection(MANUFACTURER_AAA,  0x07,  0x25);
-        di.setConstructor([](MeterInfo& mi, DriverInfo& di){ return shared_ptr<Meter>(new Driver(mi, di)); });
-    });
+        { MANUFACTURER_AAA,  0x07,  0x25 },
+    };
+}
+
+extern constexpr DriverInfo driver_info_aventieswm = []
+{
+    DriverInfo di("aventieswm");
+    di.setDefaultFields("name,id,total_m3,error_flags,timestamp");
+    di.setMeterType(MeterType::WaterMeter);
+    di.addLinkMode(LinkMode::T1);
+    di.setDetection(detection);
+    di.setConstructor([](MeterInfo& mi, const DriverInfo& di){ return shared_ptr<Meter>(new Driver(mi, di)); });
+    return di;
+}();
 
-    Driver::Driver(MeterInfo &mi, DriverInfo &di) :
+namespace
+{
+    Driver::Driver(MeterInfo &mi, const DriverInfo &di) :
         MeterCommonImplementation(mi, di)
     {
         addStringFieldWithExtractorAndLookup(
@@ -21,24 +21,33 @@ namespace
 {
     struct Driver : public virtual MeterCommonImplementation
     {
-        Driver(MeterInfo &mi, DriverInfo &di);
+        Driver(MeterInfo &mi, const DriverInfo &di);
 
         void processContent(Telegram *t);
     };
 
-    static bool ok = registerDriver([](DriverInfo&di)
+    constexpr DriverDetect detection[] =
     {
-        di.setName("bfw240radio");
-        di.setDefaultFields("name,id,current_hca,prev_hca,timestamp");
-        di.addLinkMode(LinkMode::T1);
-        di.setMeterType(MeterType::HeatCostAllocationMeter);
-        di.addDetection(MANUFACTURER_BFW,0x08,  0x02);
-        di.forceMfctIndex(2); // First two bytes are 2f2f after that its completely mfct specific.
-        di.usesProcessContent();
-        di.setConstructor([](MeterInfo& mi, DriverInfo& di){ return shared_ptr<Meter>(new Driver(mi, di)); });
-    });
-
-    Driver::Driver(MeterInfo &mi, DriverInfo &di) : MeterCommonImplementation(mi, di)
+        { MANUFACTURER_BFW,0x08,  0x02 },
+    };
+}
+
+extern constexpr DriverInfo driver_info_bfw240radio = []
+{
+    DriverInfo di("bfw240radio");
+    di.setDefaultFields("name,id,current_hca,prev_hca,timestamp");
+    di.addLinkMode(LinkMode::T1);
+    di.setMeterType(MeterType::HeatCostAllocationMeter);
+    di.setDetection(detection);
+    di.forceMfctIndex(2); // First two bytes are 2f2f after that its completely mfct specific.
+    di.usesProcessContent();
+    di.setConstructor([](MeterInfo& mi, const DriverInfo& di){ return shared_ptr<Meter>(new Driver(mi, di)); });
+    return di;
+}();
+
+namespace
+{
+    Driver::Driver(MeterInfo &mi, const DriverInfo &di) : MeterCommonImplementation(mi, di)
     {
         addNumericField("current",
                         Quantity::HCA,
@@ -22,7 +22,7 @@ namespace
 {
     struct Driver : public virtual MeterCommonImplementation
     {
-        Driver(MeterInfo &mi, DriverInfo &di);
+        Driver(MeterInfo &mi, const DriverInfo &di);
 
         // Three types of telegrams (T1A1 T1A2 T1B) they all share total_energy_kwh and total_volume_m3.
         // The T1A1 and T1B also contains a status.
@@ -50,20 +50,29 @@ namespace
         // return_temperature_c
     };
 
-    static bool ok = registerDriver([](DriverInfo&di)
+    constexpr DriverDetect detection[] =
     {
-        di.setName("c5isf");
-        di.setDefaultFields("name,id,total_energy_consumption_kwh,total_volume_m3,status,timestamp");
-
-        di.setMeterType(MeterType::HeatMeter);
-        di.addLinkMode(LinkMode::T1);
-        di.addDetection(MANUFACTURER_ZRI, 0x0d, 0x88); // Telegram type T1A1
-        di.addDetection(MANUFACTURER_ZRI, 0x07, 0x88); // Telegram type T1A2
-        di.addDetection(MANUFACTURER_ZRI, 0x04, 0x88); // Telegram type T1B
-        di.setConstructor([](MeterInfo& mi, DriverInfo& di){ return shared_ptr<Meter>(new Driver(mi, di)); });
-    });
-
-    Driver::Driver(MeterInfo &mi, DriverInfo &di) : MeterCommonImplementation(mi, di)
+        { MANUFACTURER_ZRI, 0x0d, 0x88 }, // Telegram type T1A1
+        { MANUFACTURER_ZRI, 0x07, 0x88 }, // Telegram type T1A2
+        { MANUFACTURER_ZRI, 0x04, 0x88 }, // Telegram type T1B
+    };
+}
+
+extern constexpr DriverInfo driver_info_c5isf = []
+{
+    DriverInfo di("c5isf");
+    di.setDefaultFields("name,id,total_energy_consumption_kwh,total_volume_m3,status,timestamp");
+
+    di.setMeterType(MeterType::HeatMeter);
+    di.addLinkMode(LinkMode::T1);
+    di.setDetection(detection);
+    di.setConstructor([](MeterInfo& mi, const DriverInfo& di){ return shared_ptr<Meter>(new Driver(mi, di)); });
+    return di;
+}();
+
+namespace
+{
+    Driver::Driver(MeterInfo &mi, const DriverInfo &di) : MeterCommonImplementation(mi, di)
     {
         // Fields common for T1A1, T1A2, T1B...........
 
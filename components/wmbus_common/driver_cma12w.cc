@@ -21,23 +21,31 @@ namespace
 {
     struct Driver : public virtual MeterCommonImplementation
     {
-        Driver(MeterInfo &mi, DriverInfo &di);
+        Driver(MeterInfo &mi, const DriverInfo &di);
     };
 
-    static bool ok = registerDriver([](DriverInfo&di)
+    constexpr DriverDetect detection[] =
     {
-        di.setName("cma12w");
-        di.setDefaultFields("name,id,current_temperature_c,timestamp");
-        di.setMeterType(MeterType::TempHygroMeter);
-        di.addLinkMode(LinkMode::C1);
-        di.addLinkMode(LinkMode::T1);
-        di.addDetection(MANUFACTURER_ELV,  0x1b,  0x20);
+        { MANUFACTURER_ELV,  0x1b,  0x20 },
+    };
+}
 
-        di.setConstructor([](MeterInfo& mi, DriverInfo& di){ return shared_ptr<Meter>(new Driver(mi, di)); });
+extern constexpr DriverInfo driver_info_cma12w = []
+{
+    DriverInfo di("cma12w");
+    di.setDefaultFields("name,id,current_temperature_c,timestamp");
+    di.setMeterType(MeterType::TempHygroMeter);
+    di.addLinkMode(LinkMode::C1);
+    di.addLinkMode(LinkMode::T1);
+    di.setDetection(detection);
 
-    });
+    di.setConstructor([](MeterInfo& mi, const DriverInfo& di){ return shared_ptr<Meter>(new Driver(mi, di)); });
+    return di;
+}();
 
-    Driver::Driver(MeterInfo &mi, DriverInfo &di) : MeterCommonImplementation(mi, di)
+namespace
+{
+    Driver::Driver(MeterInfo &mi, const DriverInfo &di) : MeterCommonImplementation(mi, di)
     {
         addOptionalLibraryFields("software_version");
 
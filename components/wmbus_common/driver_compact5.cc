@@ -21,28 +21,37 @@ namespace
 {
     struct Driver : public virtual MeterCommonImplementation
     {
-        Driver(MeterInfo &mi, DriverInfo &di);
+        Driver(MeterInfo &mi, const DriverInfo &di);
 
         void processContent(Telegram *t);
     };
 
-    static bool ok = registerDriver([](DriverInfo&di)
+    constexpr DriverDetect detection[] =
     {
-        di.setName("compact5");
-        di.setDefaultFields("name,id,total_kwh,current_kwh,previous_kwh,timestamp");
-        di.setMeterType(MeterType::WaterMeter);
-        di.addLinkMode(LinkMode::T1);
-        di.addLinkMode(LinkMode::C1);
-        di.addDetection(MANUFACTURER_TCH,  0x04,  0x45);
-        di.addDetection(MANUFACTURER_TCH,  0xc3,  0x45);
-        di.addDetection(MANUFACTURER_TCH,  0x43,  0x22);
-        di.addDetection(MANUFACTURER_TCH,  0x43,  0x45);
-        di.addDetection(MANUFACTURER_TCH,  0x43,  0x39);
-        di.usesProcessContent();
-        di.setConstructor([](MeterInfo& mi, DriverInfo& di){ return shared_ptr<Meter>(new Driver(mi, di)); });
-    });
-
-    Driver::Driver(MeterInfo &mi, DriverInfo &di) : MeterCommonImplementation(mi, di)
+        { MANUFACTURER_TCH,  0x04,  0x45 },
+        { MANUFACTURER_TCH,  0xc3,  0x45 },
+        { MANUFACTURER_TCH,  0x43,  0x22 },
+        { MANUFACTURER_TCH,  0x43,  0x45 },
+        { MANUFACTURER_TCH,  0x43,  0x39 },
+    };
+}
+
+extern constexpr DriverInfo driver_info_compact5 = []
+{
+    DriverInfo di("compact5");
+    di.setDefaultFields("name,id,total_kwh,current_kwh,previous_kwh,timestamp");
+    di.setMeterType(MeterType::WaterMeter);
+    di.addLinkMode(LinkMode::T1);
+    di.addLinkMode(LinkMode::C1);
+    di.setDetection(detection);
+    di.usesProcessContent();
+    di.setConstructor([](MeterInfo& mi, const DriverInfo& di){ return shared_ptr<Meter>(new Driver(mi, di)); });
+    return di;
+}();
+
+namespace
+{
+    Driver::Driver(MeterInfo &mi, const DriverInfo &di) : MeterCommonImplementation(mi, di)
     {
         addNumericField("total",
                         Quantity::Energy,
@@ -20,21 +20,30 @@
 namespace
 {
     struct Driver : public virtual MeterCommonImplementation {
-        Driver(MeterInfo &mi, DriverInfo &di);
+        Driver(MeterInfo &mi, const DriverInfo &di);
     };
 
-    static bool ok = registerDriver([](DriverInfo&di)
+    constexpr DriverDetect detection[] =
     {
-        di.setName("dme_07");
-        di.setDefaultFields("name,id,total_m3,status,timestamp");
-        di.setMeterType(MeterType::WaterMeter);
-        di.addLinkMode(LinkMode::T1);
-        di.addDetection(MANUFACTURER_DME,  0x07,  0x7b);
+        { MANUFACTURER_DME,  0x07,  0x7b },
+    };
+}
+
+extern constexpr DriverInfo driver_info_dme_07 = []
+{
+    DriverInfo di("dme_07");
+    di.setDefaultFields("name,id,total_m3,status,timestamp");
+    di.setMeterType(MeterType::WaterMeter);
+    di.addLinkMode(LinkMode::T1);
+    di.setDetection(detection);
 
-        di.setConstructor([](MeterInfo& mi, DriverInfo& di){ return shared_ptr<Meter>(new Driver(mi, di)); });
-    });
+    di.setConstructor([](MeterInfo& mi, const DriverInfo& di){ return shared_ptr<Meter>(new Driver(mi, di)); });
+    return di;
+}();
 
-    Driver::Driver(MeterInfo &mi, DriverInfo &di) : MeterCommonImplementation(mi, di)
+namespace
+{
+    Driver::Driver(MeterInfo &mi, const DriverInfo &di) : MeterCommonImplementation(mi, di)
     {
         addStringFieldWithExtractorAndLookup(
             "status",
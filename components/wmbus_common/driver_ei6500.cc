@@ -21,20 +21,29 @@ namespace
 {
     struct Driver : public virtual MeterCommonImplementation
     {
-        Driver(MeterInfo &mi, DriverInfo &di);
+        Driver(MeterInfo &mi, const DriverInfo &di);
     };
 
-    static bool ok = registerDriver([](DriverInfo&di)
+    constexpr DriverDetect detection[] =
     {
-        di.setName("ei6500");
-        di.setDefaultFields("name,id,status,last_alarm_date,alarm_counter,timestamp");
-        di.setMeterType(MeterType::SmokeDetector);
-        di.addLinkMode(LinkMode::T1);
-        di.addDetection(MANUFACTURER_EIE, 0x1a, 0x0c);
-        di.setConstructor([](MeterInfo& mi, DriverInfo& di){ return shared_ptr<Meter>(new Driver(mi, di)); });
-    });
-
-    Driver::Driver(MeterInfo &mi, DriverInfo &di) : MeterCommonImplementation(mi, di)
+        { MANUFACTURER_EIE, 0x1a, 0x0c },
+    };
+}
+
+extern constexpr DriverInfo driver_info_ei6500 = []
+{
+    DriverInfo di("ei6500");
+    di.setDefaultFields("name,id,status,last_alarm_date,alarm_counter,timestamp");
+    di.setMeterType(MeterType::SmokeDetector);
+    di.addLinkMode(LinkMode::T1);
+    di.setDetection(detection);
+    di.setConstructor([](MeterInfo& mi, const DriverInfo& di){ return shared_ptr<Meter>(new Driver(mi, di)); });
+    return di;
+}();
+
+namespace
+{
+    Driver::Driver(MeterInfo &mi, const DriverInfo &di) : MeterCommonImplementation(mi, di)
     {
         setMfctTPLStatusBits(
             Translate::Lookup()
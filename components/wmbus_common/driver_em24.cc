@@ -21,26 +21,35 @@ namespace
 {
     struct Driver : public virtual MeterCommonImplementation
     {
-        Driver(MeterInfo &mi, DriverInfo &di);
+        Driver(MeterInfo &mi, const DriverInfo &di);
     };
 
-    static bool ok = registerDriver([](DriverInfo&di)
+    constexpr DriverDetect detection[] =
     {
-        di.setName("em24");
-        di.setDefaultFields(
-            "name,id,"
-            "total_energy_consumption_kwh,total_energy_production_kwh,"
-            "total_reactive_energy_consumption_kvarh,total_reactive_energy_production_kvarh,"
-            "total_apparent_energy_consumption_kvah,total_apparent_energy_production_kvah,"
-            "timestamp");
-        di.setMeterType(MeterType::ElectricityMeter);
-        di.addLinkMode(LinkMode::C1);
-        di.addDetection(MANUFACTURER_KAM,  0x02,  0x33);
-        di.addDetection(MANUFACTURER_GAV,  0x02,  0x00);
-        di.setConstructor([](MeterInfo& mi, DriverInfo& di){ return shared_ptr<Meter>(new Driver(mi, di)); });
-    });
+        { MANUFACTURER_KAM,  0x02,  0x33 },
+        { MANUFACTURER_GAV,  0x02,  0x00 },
+    };
+}
+
+extern constexpr DriverInfo driver_info_em24 = []
+{
+    DriverInfo di("em24");
+    di.setDefaultFields(
+        "name,id,"
+        "total_energy_consumption_kwh,total_energy_production_kwh,"
+        "total_reactive_energy_consumption_kvarh,total_reactive_energy_production_kvarh,"
+        "total_apparent_energy_consumption_kvah,total_apparent_energy_production_kvah,"
+        "timestamp");
+    di.setMeterType(MeterType::ElectricityMeter);
+    di.addLinkMode(LinkMode::C1);
+    di.setDetection(detection);
+    di.setConstructor([](MeterInfo& mi, const DriverInfo& di){ return shared_ptr<Meter>(new Driver(mi, di)); });
+    return di;
+}();
 
-    Driver::Driver(MeterInfo &mi, DriverInfo &di) : MeterCommonImplementation(mi, di)
+namespace
+{
+    Driver::Driver(MeterInfo &mi, const DriverInfo &di) : MeterCommonImplementation(mi, di)
     {
         addStringFieldWithExtractorAndLookup(
             "status",
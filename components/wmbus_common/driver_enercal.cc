@@ -20,20 +20,29 @@
 namespace
 {
     struct Driver : public virtual MeterCommonImplementation {
-        Driver(MeterInfo &mi, DriverInfo &di);
+        Driver(MeterInfo &mi, const DriverInfo &di);
     };
 
-    static bool ok = registerDriver([](DriverInfo&di)
+    constexpr DriverDetect detection[] =
     {
-        di.setName("enercal");
-        di.setDefaultFields("name,id,status,total_kwh,target_kwh,total_m3,target_m3,timestamp");
-        di.setMeterType(MeterType::HeatMeter);
-        di.addLinkMode(LinkMode::MBUS);
-        di.addDetection(MANUFACTURER_GWF, 0x04,  0x08);
-        di.setConstructor([](MeterInfo& mi, DriverInfo& di){ return shared_ptr<Meter>(new Driver(mi, di)); });
-    });
-
-    Driver::Driver(MeterInfo &mi, DriverInfo &di) : MeterCommonImplementation(mi, di)
+        { MANUFACTURER_GWF, 0x04,  0x08 },
+    };
+}
+
+extern constexpr DriverInfo driver_info_enercal = []
+{
+    DriverInfo di("enercal");
+    di.setDefaultFields("name,id,status,total_kwh,target_kwh,total_m3,target_m3,timestamp");
+    di.setMeterType(MeterType::HeatMeter);
+    di.addLinkMode(LinkMode::MBUS);
+    di.setDetection(detection);
+    di.setConstructor([](MeterInfo& mi, const DriverInfo& di){ return shared_ptr<Meter>(new Driver(mi, di)); });
+    return di;
+}();
+
+namespace
+{
+    Driver::Driver(MeterInfo &mi, const DriverInfo &di) : MeterCommonImplementation(mi, di)
     {
         addStringField(
             "status",
@@ -21,19 +21,28 @@ namespace
 {
     struct Driver : public virtual MeterCommonImplementation
     {
-        Driver(MeterInfo &mi, DriverInfo &di);
+        Driver(MeterInfo &mi, const DriverInfo &di);
     };
 
-    static bool ok = registerDriver([](DriverInfo&di)
+    constexpr DriverDetect detection[] =
     {
-        di.setName("engelmann-faw");
-        di.setDefaultFields("name,id,status,reporting_date,consumption_at_reporting_date_m3,timestamp");
-        di.addLinkMode(LinkMode::T1);
-        di.addDetection(MANUFACTURER_EFE,  0x07,  0x00);
-        di.setConstructor([](MeterInfo& mi, DriverInfo& di){ return shared_ptr<Meter>(new Driver(mi, di)); });
-    });
+        { MANUFACTURER_EFE,  0x07,  0x00 },
+    };
+}
+
+extern constexpr DriverInfo driver_info_engelmann_faw = []
+{
+    DriverInfo di("engelmann-faw");
+    di.setDefaultFields("name,id,status,reporting_date,consumption_at_reporting_date_m3,timestamp");
+    di.addLinkMode(LinkMode::T1);
+    di.setDetection(detection);
+    di.setConstructor([](MeterInfo& mi, const DriverInfo& di){ return shared_ptr<Meter>(new Driver(mi, di)); });
+    return di;
+}();
 
-    Driver::Driver(MeterInfo &mi, DriverInfo &di) :
+namespace
+{
+    Driver::Driver(MeterInfo &mi, const DriverInfo &di) :
         MeterCommonImplementation(mi, di)
     {
         addStringFieldWithExtractorAndLookup(
@@ -21,21 +21,30 @@ namespace
 {
     struct Driver : public virtual MeterCommonImplementation
     {
-        Driver(MeterInfo &mi, DriverInfo &di);
+        Driver(MeterInfo &mi, const DriverInfo &di);
     };
 
-    static bool ok = registerDriver([](DriverInfo&di)
+    constexpr DriverDetect detection[] =
     {
-        di.setName("eurisii");
-        di.setDefaultFields("name,id,current_consumption_hca,status,timestamp");
-        di.setMeterType(MeterType::HeatCostAllocationMeter);
-        di.addLinkMode(LinkMode::T1);
-        di.addDetection(MANUFACTURER_INE,  0x08,  0x55);
-        di.addDetection(MANUFACTURER_RAM,  0x08,  0x55);
-        di.setConstructor([](MeterInfo& mi, DriverInfo& di){ return shared_ptr<Meter>(new Driver(mi, di)); });
-    });
-
-    Driver::Driver(MeterInfo &mi, DriverInfo &di) : MeterCommonImplementation(mi, di)
+        { MANUFACTURER_INE,  0x08,  0x55 },
+        { MANUFACTURER_RAM,  0x08,  0x55 },
+    };
+}
+
+extern constexpr DriverInfo driver_info_eurisii = []
+{
+    DriverInfo di("eurisii");
+    di.setDefaultFields("name,id,current_consumption_hca,status,timestamp");
+    di.setMeterType(MeterType::HeatCostAllocationMeter);
+    di.addLinkMode(LinkMode::T1);
+    di.setDetection(detection);
+    di.setConstructor([](MeterInfo& mi, const DriverInfo& di){ return shared_ptr<Meter>(new Driver(mi, di)); });
+    return di;
+}();
+
+namespace
+{
+    Driver::Driver(MeterInfo &mi, const DriverInfo &di) : MeterCommonImplementation(mi, di)
     {
         addStringFieldWithExtractorAndLookup(
             "status",
@@ -21,7 +21,7 @@ namespace
 {
     struct Driver : public virtual MeterCommonImplementation
     {
-        Driver(MeterInfo &mi, DriverInfo &di);
+        Driver(MeterInfo &mi, const DriverInfo &di);
 
     private:
 
@@ -29,19 +29,28 @@ namespace
         std::string leadingZeroString(int num);
     };
 
-    static bool ok = registerDriver([](DriverInfo&di)
+    constexpr DriverDetect detection[] =
     {
-        di.setName("fhkvdataiii");
-        di.setDefaultFields("name,id,current_hca,current_date,previous_hca,previous_date,temp_room_c,temp_radiator_c,timestamp");
-        di.setMeterType(MeterType::HeatCostAllocationMeter);
-        di.addLinkMode(LinkMode::T1);
-        di.addDetection(MANUFACTURER_TCH, 0x80,  0x69);
-        di.addDetection(MANUFACTURER_TCH, 0x80,  0x94);
-        di.usesProcessContent();
-        di.setConstructor([](MeterInfo& mi, DriverInfo& di){ return shared_ptr<Meter>(new Driver(mi, di)); });
-    });
-
-    Driver::Driver(MeterInfo &mi, DriverInfo &di) : MeterCommonImplementation(mi, di)
+        { MANUFACTURER_TCH, 0x80,  0x69 },
+        { MANUFACTURER_TCH, 0x80,  0x94 },
+    };
+}
+
+extern constexpr DriverInfo driver_info_fhkvdataiii = []
+{
+    DriverInfo di("fhkvdataiii");
+    di.setDefaultFields("name,id,current_hca,current_date,previous_hca,previous_date,temp_room_c,temp_radiator_c,timestamp");
+    di.setMeterType(MeterType::HeatCostAllocationMeter);
+    di.addLinkMode(LinkMode::T1);
+    di.setDetection(detection);
+    di.usesProcessContent();
+    di.setConstructor([](MeterInfo& mi, const DriverInfo& di){ return shared_ptr<Meter>(new Driver(mi, di)); });
+    return di;
+}();
+
+namespace
+{
+    Driver::Driver(MeterInfo &mi, const DriverInfo &di) : MeterCommonImplementation(mi, di)
     {
         addNumericField("current",
                         Quantity::HCA,
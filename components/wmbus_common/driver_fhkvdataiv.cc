@@ -22,22 +22,31 @@ namespace
 {
     struct Driver : public virtual MeterCommonImplementation
     {
-        Driver(MeterInfo &mi, DriverInfo &di);
+        Driver(MeterInfo &mi, const DriverInfo &di);
     };
 
-    static bool ok = registerDriver([](DriverInfo&di)
+    constexpr DriverDetect detection[] =
     {
-        di.setName("fhkvdataiv");
-        di.setDefaultFields("name,id,current_consumption_hca,set_date,consumption_at_set_date_hca,timestamp");
-        di.setMeterType(MeterType::HeatCostAllocationMeter);
-        di.addLinkMode(LinkMode::T1);
-        di.addDetection(MANUFACTURER_TCH,  0x08,  0x69);
-        di.addDetection(MANUFACTURER_TCH,  0x08,  0x94);
+        { MANUFACTURER_TCH,  0x08,  0x69 },
+        { MANUFACTURER_TCH,  0x08,  0x94 },
+    };
+}
+
+extern constexpr DriverInfo driver_info_fhkvdataiv = []
+{
+    DriverInfo di("fhkvdataiv");
+    di.setDefaultFields("name,id,current_consumption_hca,set_date,consumption_at_set_date_hca,timestamp");
+    di.setMeterType(MeterType::HeatCostAllocationMeter);
+    di.addLinkMode(LinkMode::T1);
+    di.setDetection(detection);
 
-        di.setConstructor([](MeterInfo& mi, DriverInfo& di){ return shared_ptr<Meter>(new Driver(mi, di)); });
-    });
+    di.setConstructor([](MeterInfo& mi, const DriverInfo& di){ return shared_ptr<Meter>(new Driver(mi, di)); });
+    return di;
+}();
 
-    Driver::Driver(MeterInfo &mi, DriverInfo &di) : MeterCommonImplementation(mi, di)
+namespace
+{
+    Driver::Driver(MeterInfo &mi, const DriverInfo &di) : MeterCommonImplementation(mi, di)
     {
         addStringField(
             "status",
@@ -20,26 +20,35 @@
 namespace
 {
     struct Driver : public virtual MeterCommonImplementation {
-        Driver(MeterInfo &mi, DriverInfo &di);
+        Driver(MeterInfo &mi, const DriverInfo &di);
     };
 
-    static bool ok = registerDriver([](DriverInfo&di)
+    constexpr DriverDetect detection[] =
     {
-        di.setName("flowiq2200");
-        di.setDefaultFields("name,id,status,total_m3,target_m3,timestamp");
-
-        di.setMeterType(MeterType::WaterMeter);
-        di.addLinkMode(LinkMode::C1);
         // FlowIQ2200
-        di.addDetection(MANUFACTURER_KAW,  0x16,  0x3a);
-	di.addDetection(MANUFACTURER_KAW,  0x16,  0x3c);
+        { MANUFACTURER_KAW,  0x16,  0x3a },
+        { MANUFACTURER_KAW,  0x16,  0x3c },
         // FlowIQ3100
-        di.addDetection(MANUFACTURER_KAM,  0x16,  0x1d);
+        { MANUFACTURER_KAM,  0x16,  0x1d },
+    };
+}
+
+extern constexpr DriverInfo driver_info_flowiq2200 = []
+{
+    DriverInfo di("flowiq2200");
+    di.setDefaultFields("name,id,status,total_m3,target_m3,timestamp");
+
+    di.setMeterType(MeterType::WaterMeter);
+    di.addLinkMode(LinkMode::C1);
+    di.setDetection(detection);
 
-        di.setConstructor([](MeterInfo& mi, DriverInfo& di){ return shared_ptr<Meter>(new Driver(mi, di)); });
-    });
+    di.setConstructor([](MeterInfo& mi, const DriverInfo& di){ return shared_ptr<Meter>(new Driver(mi, di)); });
+    return di;
+}();
 
-    Driver::Driver(MeterInfo &mi, DriverInfo &di) : MeterCommonImplementation(mi, di)
+namespace
+{
+    Driver::Driver(MeterInfo &mi, const DriverInfo &di) : MeterCommonImplementation(mi, di)
     {
         addStringFieldWithExtractorAndLookup(
             "status",
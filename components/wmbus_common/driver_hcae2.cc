@@ -21,20 +21,29 @@ namespace
 {
     struct Driver : public virtual MeterCommonImplementation
     {
-        Driver(MeterInfo &mi, DriverInfo &di);
+        Driver(MeterInfo &mi, const DriverInfo &di);
     };
 
-    static bool ok = registerDriver([](DriverInfo&di)
+    constexpr DriverDetect detection[] =
     {
-        di.setName("hcae2");
-        di.setDefaultFields("name,id,current_consumption_hca,status,timestamp");
-        di.setMeterType(MeterType::HeatCostAllocationMeter);
-        di.addLinkMode(LinkMode::T1);
-        di.addDetection(MANUFACTURER_EFE, 0x08, 0x31);
-        di.setConstructor([](MeterInfo& mi, DriverInfo& di){ return shared_ptr<Meter>(new Driver(mi, di)); });
-    });
-
-    Driver::Driver(MeterInfo &mi, DriverInfo &di) : MeterCommonImplementation(mi, di)
+        { MANUFACTURER_EFE, 0x08, 0x31 },
+    };
+}
+
+extern constexpr DriverInfo driver_info_hcae2 = []
+{
+    DriverInfo di("hcae2");
+    di.setDefaultFields("name,id,current_consumption_hca,status,timestamp");
+    di.setMeterType(MeterType::HeatCostAllocationMeter);
+    di.addLinkMode(LinkMode::T1);
+    di.setDetection(detection);
+    di.setConstructor([](MeterInfo& mi, const DriverInfo& di){ return shared_ptr<Meter>(new Driver(mi, di)); });
+    return di;
+}();
+
+namespace
+{
+    Driver::Driver(MeterInfo &mi, const DriverInfo &di) : MeterCommonImplementation(mi, di)
     {
         addStringFieldWithExtractorAndLookup(
             "status",
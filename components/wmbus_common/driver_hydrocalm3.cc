@@ -21,20 +21,29 @@ namespace
 {
     struct Driver : public virtual MeterCommonImplementation
     {
-        Driver(MeterInfo &mi, DriverInfo &di);
+        Driver(MeterInfo &mi, const DriverInfo &di);
     };
 
-    static bool ok = registerDriver([](DriverInfo&di)
+    constexpr DriverDetect detection[] =
     {
-        di.setName("hydrocalm3");
-        di.setDefaultFields("name,id,total_heating_kwh,total_cooling_kwh,timestamp");
-        di.setMeterType(MeterType::HeatMeter);
-        di.addLinkMode(LinkMode::T1);
-        di.addDetection(MANUFACTURER_BMT, 0x0d,  0x0b);
-        di.setConstructor([](MeterInfo& mi, DriverInfo& di){ return shared_ptr<Meter>(new Driver(mi, di)); });
-    });
-
-    Driver::Driver(MeterInfo &mi, DriverInfo &di) :  MeterCommonImplementation(mi, di)
+        { MANUFACTURER_BMT, 0x0d,  0x0b },
+    };
+}
+
+extern constexpr DriverInfo driver_info_hydrocalm3 = []
+{
+    DriverInfo di("hydrocalm3");
+    di.setDefaultFields("name,id,total_heating_kwh,total_cooling_kwh,timestamp");
+    di.setMeterType(MeterType::HeatMeter);
+    di.addLinkMode(LinkMode::T1);
+    di.setDetection(detection);
+    di.setConstructor([](MeterInfo& mi, const DriverInfo& di){ return shared_ptr<Meter>(new Driver(mi, di)); });
+    return di;
+}();
+
+namespace
+{
+    Driver::Driver(MeterInfo &mi, const DriverInfo &di) :  MeterCommonImplementation(mi, di)
     {
         setMfctTPLStatusBits(
             Translate::Lookup()
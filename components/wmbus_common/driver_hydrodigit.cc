@@ -21,26 +21,35 @@
 
 namespace {
     struct Driver: public virtual MeterCommonImplementation {
-            Driver(MeterInfo &mi, DriverInfo &di);
+            Driver(MeterInfo &mi, const DriverInfo &di);
             void processContent(Telegram *t);
     };
 
-    static bool ok = registerDriver([](DriverInfo &di) {
-        di.setName("hydrodigit");
-        di.setDefaultFields("name,id,total_m3,meter_datetime,timestamp");
-        di.setMeterType(MeterType::WaterMeter);
-        di.addLinkMode(LinkMode::T1);
-        di.addDetection(MANUFACTURER_BMT, 0x06, 0x13);
-        di.addDetection(MANUFACTURER_BMT, 0x06, 0x17);
-        di.addDetection(MANUFACTURER_BMT, 0x07, 0x13);
-        di.addDetection(MANUFACTURER_BMT, 0x07, 0x15);
-        di.usesProcessContent();
-        di.setConstructor([](MeterInfo &mi, DriverInfo &di) {
-            return shared_ptr<Meter>(new Driver(mi, di));
-        });
+    constexpr DriverDetect detection[] =
+    {
+        { MANUFACTURER_BMT, 0x06, 0x13 },
+        { MANUFACTURER_BMT, 0x06, 0x17 },
+        { MANUFACTURER_BMT, 0x07, 0x13 },
+        { MANUFACTURER_BMT, 0x07, 0x15 },
+    };
+}
+
+extern constexpr DriverInfo driver_info_hydrodigit = []
+{
+    DriverInfo di("hydrodigit");
+    di.setDefaultFields("name,id,total_m3,meter_datetime,timestamp");
+    di.setMeterType(MeterType::WaterMeter);
+    di.addLinkMode(LinkMode::T1);
+    di.setDetection(detection);
+    di.usesProcessContent();
+    di.setConstructor([](MeterInfo &mi, const DriverInfo &di) {
+        return shared_ptr<Meter>(new Driver(mi, di));
     });
+    return di;
+}();
 
-    Driver::Driver(MeterInfo &mi, DriverInfo &di) : MeterCommonImplementation(
+namespace {
+    Driver::Driver(MeterInfo &mi, const DriverInfo &di) : MeterCommonImplementation(
             mi, di) {
         addNumericFieldWithExtractor("total",
                 "The total water consumption recorded by this meter.",
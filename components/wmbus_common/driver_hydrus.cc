@@ -22,27 +22,36 @@ namespace
 {
     struct Driver : public virtual MeterCommonImplementation
     {
-        Driver(MeterInfo &mi, DriverInfo &di);
+        Driver(MeterInfo &mi, const DriverInfo &di);
     };
 
-    static bool ok = registerDriver([](DriverInfo&di)
+    constexpr DriverDetect detection[] =
     {
-        di.setName("hydrus");
-        di.setDefaultFields("name,id,total_m3,total_at_date_m3,status,timestamp");
-        di.setMeterType(MeterType::WaterMeter);
-        di.addLinkMode(LinkMode::T1);
-        di.addDetection(MANUFACTURER_DME,  0x07,  0x70);
-        di.addDetection(MANUFACTURER_DME,  0x07,  0x76);
-        di.addDetection(MANUFACTURER_HYD,  0x07,  0x24);
-        di.addDetection(MANUFACTURER_HYD,  0x07,  0x8b);
-        di.addDetection(MANUFACTURER_HYD,  0x06,  0x8b);
-        di.addDetection(MANUFACTURER_DME,  0x06,  0x70);
-        di.addDetection(MANUFACTURER_DME,  0x16,  0x70);
-
-        di.setConstructor([](MeterInfo& mi, DriverInfo& di){ return shared_ptr<Meter>(new Driver(mi, di)); });
-    });
-
-    Driver::Driver(MeterInfo &mi, DriverInfo &di) : MeterCommonImplementation(mi, di)
+        { MANUFACTURER_DME,  0x07,  0x70 },
+        { MANUFACTURER_DME,  0x07,  0x76 },
+        { MANUFACTURER_HYD,  0x07,  0x24 },
+        { MANUFACTURER_HYD,  0x07,  0x8b },
+        { MANUFACTURER_HYD,  0x06,  0x8b },
+        { MANUFACTURER_DME,  0x06,  0x70 },
+        { MANUFACTURER_DME,  0x16,  0x70 },
+    };
+}
+
+extern constexpr DriverInfo driver_info_hydrus = []
+{
+    DriverInfo di("hydrus");
+    di.setDefaultFields("name,id,total_m3,total_at_date_m3,status,timestamp");
+    di.setMeterType(MeterType::WaterMeter);
+    di.addLinkMode(LinkMode::T1);
+    di.setDetection(detection);
+
+    di.setConstructor([](MeterInfo& mi, const DriverInfo& di){ return shared_ptr<Meter>(new Driver(mi, di)); });
+    return di;
+}();
+
+namespace
+{
+    Driver::Driver(MeterInfo &mi, const DriverInfo &di) : MeterCommonImplementation(mi, di)
     {
         addOptionalLibraryFields("operating_time_h,actuality_duration_s,meter_datetime,customer");
         addOptionalLibraryFields("flow_temperature_c,external_temperature_c");
@@ -21,22 +21,31 @@ namespace
 {
     struct Driver : public virtual MeterCommonImplementation
     {
-        Driver(MeterInfo &mi, DriverInfo &di);
+        Driver(MeterInfo &mi, const DriverInfo &di);
     };
 
-    static bool ok = registerDriver([](DriverInfo&di)
+    constexpr DriverDetect detection[] =
     {
-        di.setName("iem3000");
-        di.setDefaultFields("name,id,total_energy_consumption_kwh,timestamp");
-        di.setMeterType(MeterType::ElectricityMeter);
-        di.addLinkMode(LinkMode::T1);
-        di.addDetection(MANUFACTURER_SEC,  0x02,  0x13);
-        di.addDetection(MANUFACTURER_SEC,  0x02,  0x15);
-        di.addDetection(MANUFACTURER_SEC,  0x02,  0x18);
-        di.setConstructor([](MeterInfo& mi, DriverInfo& di){ return shared_ptr<Meter>(new Driver(mi, di)); });
-    });
-
-    Driver::Driver(MeterInfo &mi, DriverInfo &di) : MeterCommonImplementation(mi, di)
+        { MANUFACTURER_SEC,  0x02,  0x13 },
+        { MANUFACTURER_SEC,  0x02,  0x15 },
+        { MANUFACTURER_SEC,  0x02,  0x18 },
+    };
+}
+
+extern constexpr DriverInfo driver_info_iem3000 = []
+{
+    DriverInfo di("iem3000");
+    di.setDefaultFields("name,id,total_energy_consumption_kwh,timestamp");
+    di.setMeterType(MeterType::ElectricityMeter);
+    di.addLinkMode(LinkMode::T1);
+    di.setDetection(detection);
+    di.setConstructor([](MeterInfo& mi, const DriverInfo& di){ return shared_ptr<Meter>(new Driver(mi, di)); });
+    return di;
+}();
+
+namespace
+{
+    Driver::Driver(MeterInfo &mi, const DriverInfo &di) : MeterCommonImplementation(mi, di)
     {
         addOptionalLibraryFields("firmware_version,manufacturer,meter_datetime,model_version");
 
@@ -21,23 +21,32 @@ namespace
 {
     struct Driver : public virtual MeterCommonImplementation
     {
-        Driver(MeterInfo &mi, DriverInfo &di);
+        Driver(MeterInfo &mi, const DriverInfo &di);
     };
 
-    static bool ok = registerDriver([](DriverInfo&di)
+    constexpr DriverDetect detection[] =
     {
-        di.setName("itron");
-        di.setDefaultFields("name,id,total_m3,target_m3,timestamp");
-        di.setMeterType(MeterType::WaterMeter);
-        di.addLinkMode(LinkMode::T1);
-        di.addDetection(MANUFACTURER_ITW,  0x07,  0x00);
-        di.addDetection(MANUFACTURER_ITW,  0x07,  0x03);
-        di.addDetection(MANUFACTURER_ITW,  0x07,  0x33);
-        di.addDetection(MANUFACTURER_ITW,  0x16,  0x00);
-        di.setConstructor([](MeterInfo& mi, DriverInfo& di){ return shared_ptr<Meter>(new Driver(mi, di)); });
-    });
-
-    Driver::Driver(MeterInfo &mi, DriverInfo &di) : MeterCommonImplementation(mi, di)
+        { MANUFACTURER_ITW,  0x07,  0x00 },
+        { MANUFACTURER_ITW,  0x07,  0x03 },
+        { MANUFACTURER_ITW,  0x07,  0x33 },
+        { MANUFACTURER_ITW,  0x16,  0x00 },
+    };
+}
+
+extern constexpr DriverInfo driver_info_itron = []
+{
+    DriverInfo di("itron");
+    di.setDefaultFields("name,id,total_m3,target_m3,timestamp");
+    di.setMeterType(MeterType::WaterMeter);
+    di.addLinkMode(LinkMode::T1);
+    di.setDetection(detection);
+    di.setConstructor([](MeterInfo& mi, const DriverInfo& di){ return shared_ptr<Meter>(new Driver(mi, di)); });
+    return di;
+}();
+
+namespace
+{
+    Driver::Driver(MeterInfo &mi, const DriverInfo &di) : MeterCommonImplementation(mi, di)
     {
         setMeterType(MeterType::WaterMeter);
 
@@ -21,22 +21,31 @@ namespace
 {
     struct Driver : public virtual MeterCommonImplementation
     {
-        Driver(MeterInfo &mi, DriverInfo &di);
+        Driver(MeterInfo &mi, const DriverInfo &di);
     };
 
-    static bool ok = registerDriver([](DriverInfo&di)
+    constexpr DriverDetect detection[] =
     {
-        di.setName("iwmtx5");
-        di.setDefaultFields("name,id,status,total_m3,timestamp");
+        { MANUFACTURER_BMT, 0x07, 0x18 },
+        { MANUFACTURER_BMT, 0x06, 0x18 },
+    };
+}
+
+extern constexpr DriverInfo driver_info_iwmtx5 = []
+{
+    DriverInfo di("iwmtx5");
+    di.setDefaultFields("name,id,status,total_m3,timestamp");
 
-        di.setMeterType(MeterType::WaterMeter);
-        di.addLinkMode(LinkMode::T1);
-        di.addDetection(MANUFACTURER_BMT, 0x07, 0x18);
-        di.addDetection(MANUFACTURER_BMT, 0x06, 0x18);
-        di.setConstructor([](MeterInfo& mi, DriverInfo& di){ return shared_ptr<Meter>(new Driver(mi, di)); });
-    });
+    di.setMeterType(MeterType::WaterMeter);
+    di.addLinkMode(LinkMode::T1);
+    di.setDetection(detection);
+    di.setConstructor([](MeterInfo& mi, const DriverInfo& di){ return shared_ptr<Meter>(new Driver(mi, di)); });
+    return di;
+}();
 
-    Driver::Driver(MeterInfo &mi, DriverInfo &di) : MeterCommonImplementation(mi, di)
+namespace
+{
+    Driver::Driver(MeterInfo &mi, const DriverInfo &di) : MeterCommonImplementation(mi, di)
     {
         addOptionalLibraryFields("meter_datetime");
         addOptionalLibraryFields("total_m3");
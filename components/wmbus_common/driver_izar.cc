@@ -41,7 +41,7 @@ namespace
 
     struct Driver : public virtual MeterCommonImplementation
     {
-        Driver(MeterInfo &mi, DriverInfo &di);
+        Driver(MeterInfo &mi, const DriverInfo &di);
 
         void processContent(Telegram *t);
 
@@ -50,36 +50,49 @@ namespace
         std::string currentAlarmsText(IzarAlarms &alarms);
         std::string previousAlarmsText(IzarAlarms &alarms);
 
-        std::vector<uchar> decodePrios(const std::vector<uchar> &origin, const std::vector<uchar> &payload, uint32_t key);
+        bool decodePrios(const std::vector<uchar> &origin, const std::vector<uchar> &payload, uint32_t key, uchar *out);
 
         std::vector<uint32_t> keys;
+        // The key that decoded the last telegram, it is tried first.
+        size_t last_key_index = 0;
     };
 
-    static bool ok = registerDriver([](DriverInfo&di)
+    constexpr DriverDetect detection[] =
     {
-        di.setName("izar");
-        di.setDefaultFields("name,id,prefix,serial_number,total_m3,last_month_total_m3,"
-                            "last_month_measure_date,"
-                            "remaining_battery_life_y,"
-                            "current_alarms,"
-                            "previous_alarms,"
-                            "transmit_period_s,"
-                            "manufacture_year,timestamp");
-        di.setMeterType(MeterType::WaterMeter);
-        di.addLinkMode(LinkMode::T1);
-        di.addDetection(MANUFACTURER_HYD,  0x07,  0x85);
-        di.addDetection(MANUFACTURER_SAP,  0x15,    -1);
-        di.addDetection(MANUFACTURER_SAP,  0x04,    -1);
-        di.addDetection(MANUFACTURER_SAP,  0x07,  0x00);
-        di.addDetection(MANUFACTURER_DME,  0x07,  0x78);
-        di.addDetection(MANUFACTURER_DME,  0x06,  0x78);
-        di.addDetection(MANUFACTURER_HYD,  0x07,  0x86);
-        di.usesProcessContent();
-
-        di.setConstructor([](MeterInfo& mi, DriverInfo& di){ return shared_ptr<Meter>(new Driver(mi, di)); });
-    });
-
-    Driver::Driver(MeterInfo &mi, DriverInfo &di) : MeterCommonImplementation(mi, di)
+        { MANUFACTURER_HYD,  0x07,  0x85 },
+        { MANUFACTURER_SAP,  0x15,  0xff },
+        { MANUFACTURER_SAP,  0x04,  0xff },
+        { MANUFACTURER_SAP,  0x07,  0x00 },
+        { MANUFACTURER_DME,  0x07,  0x78 },
+        { MANUFACTURER_DME,  0x06,  0x78 },
+        { MANUFACTURER_HYD,  0x07,  0x86 },
+    };
+}
+
+extern constexpr DriverInfo driver_info_izar = []
+{
+    DriverInfo di("izar");
+    di.setDefaultFields("name,id,prefix,serial_number,total_m3,last_month_total_m3,"
+                        "last_month_measure_date,"
+                        "remaining_battery_life_y,"
+                        "current_alarms,"
+                        "previous_alarms,"
+                        "transmit_period_s,"
+                        "manufacture_year,timestamp");
+    di.setMeterType(MeterType::WaterMeter);
+    di.addLinkMode(LinkMode::T1);
+    di.setDetection(detection);
+    di.usesProcessContent();
+    // The payload is scrambled with bytes from the header.
+    di.extractUnchangedPayloads();
+
+    di.setConstructor([](MeterInfo& mi, const DriverInfo& di){ return shared_ptr<Meter>(new Driver(mi, di)); });
+    return di;
+}();
+
+namespace
+{
+    Driver::Driver(MeterInfo &mi, const DriverInfo &di) : MeterCommonImplementation(mi, di)
     {
         initializeDiehlDefaultKeySupport(meterKeys()->confidentiality_key, keys);
 
@@ -188,14 +201,18 @@ namespace
     {
         std::vector<uchar> frame;
         t->extractFrame(&frame);
-        std::vector<uchar> origin = t->original.empty() ? frame : t->original;
-
-        std::vector<uchar> decoded_content;
-        for (auto& key : keys) {
-            decoded_content = decodePrios(origin, frame, key);
-            if (!decoded_content.empty())
-                break;
+        const std::vector<uchar> &origin = t->original.empty() ? frame : t->original;
+
+        std::vector<uchar> decoded_content(frame.size() > 15 ? frame.size() - 15 : 0);
+        bool decoded = false;
+        for (size_t i = 0; i < keys.size() && !decoded; ++i) {
+            size_t k = (last_key_index + i) % keys.size();
+            decoded = decodePrios(origin, frame, keys[k], safeButUnsafeVectorPtr(decoded_content));
+            if (decoded)
+                last_key_index = k;
         }
+        if (!decoded)
+            decoded_content.clear();
 
         debug("(izar) Decoded PRIOS data: %s\n", bin2hex(decoded_content).c_str());
 
@@ -279,9 +296,9 @@ namespace
         setStringValue("previous_alarms", previousAlarmsText(alarms));
     }
 
-    std::vector<uchar> Driver::decodePrios(const std::vector<uchar> &origin, const std::vector<uchar> &frame, uint32_t key)
+    bool Driver::decodePrios(const std::vector<uchar> &origin, const std::vector<uchar> &frame, uint32_t key, uchar *out)
     {
-        return decodeDiehlLfsr(origin, frame, key, DiehlLfsrCheckMethod::HEADER_1_BYTE, 0x4B);
+        return decodeDiehlLfsr(origin, frame, key, DiehlLfsrCheckMethod::HEADER_1_BYTE, 0x4B, out);
     }
 }
 
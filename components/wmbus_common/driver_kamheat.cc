@@ -22,42 +22,56 @@
 namespace
 {
     struct Driver : public virtual MeterCommonImplementation {
-        Driver(MeterInfo &mi, DriverInfo &di);
+        Driver(MeterInfo &mi, const DriverInfo &di);
     };
 
-    static bool ok = registerDriver([](DriverInfo&di)
+    constexpr DriverDetect detection[] =
     {
-        di.setName("kamheat");
-        di.addNameAlias("multical302");
-        di.addNameAlias("multical303");
-        di.addNameAlias("multical403");
-        di.addNameAlias("multical602");
-        di.addNameAlias("multical603");
-        di.addNameAlias("multical803");
-        di.setDefaultFields("name,id,total_energy_consumption_kwh,total_volume_m3,status,timestamp");
-        di.setMeterType(MeterType::HeatMeter);
-        di.addLinkMode(LinkMode::C1);
-        di.addLinkMode(LinkMode::T1);
-        di.addDetection(MANUFACTURER_KAM, 0x04,  0x30); // 302
-        di.addDetection(MANUFACTURER_KAM, 0x0d,  0x30); // 302
-        di.addDetection(MANUFACTURER_KAM, 0x0c,  0x30); // 302
-        di.addDetection(MANUFACTURER_KAM, 0x04,  0x40); // 303
-        di.addDetection(MANUFACTURER_KAM, 0x0c,  0x40); // 303
-        di.addDetection(MANUFACTURER_KAM, 0x04,  0x19); // 402
-        di.addDetection(MANUFACTURER_KAM, 0x04,  0x34); // 403
-        di.addDetection(MANUFACTURER_KAM, 0x0a,  0x34); // 403
-        di.addDetection(MANUFACTURER_KAM, 0x0b,  0x34); // 403
-        di.addDetection(MANUFACTURER_KAM, 0x0c,  0x34); // 403
-        di.addDetection(MANUFACTURER_KAM, 0x0d,  0x34); // 403
-        di.addDetection(MANUFACTURER_KAM, 0x04,  0x1c); // 602
-        di.addDetection(MANUFACTURER_KAM, 0x04,  0x35); // 603
-        di.addDetection(MANUFACTURER_KAM, 0x0c,  0x35); // 603
-        di.addDetection(MANUFACTURER_KAM, 0x04,  0x39); // 803
-
-        di.setConstructor([](MeterInfo& mi, DriverInfo& di){ return shared_ptr<Meter>(new Driver(mi, di)); });
-    });
-
-    Driver::Driver(MeterInfo &mi, DriverInfo &di) : MeterCommonImplementation(mi, di)
+        { MANUFACTURER_KAM, 0x04,  0x30 }, // 302
+        { MANUFACTURER_KAM, 0x0d,  0x30 }, // 302
+        { MANUFACTURER_KAM, 0x0c,  0x30 }, // 302
+        { MANUFACTURER_KAM, 0x04,  0x40 }, // 303
+        { MANUFACTURER_KAM, 0x0c,  0x40 }, // 303
+        { MANUFACTURER_KAM, 0x04,  0x19 }, // 402
+        { MANUFACTURER_KAM, 0x04,  0x34 }, // 403
+        { MANUFACTURER_KAM, 0x0a,  0x34 }, // 403
+        { MANUFACTURER_KAM, 0x0b,  0x34 }, // 403
+        { MANUFACTURER_KAM, 0x0c,  0x34 }, // 403
+        { MANUFACTURER_KAM, 0x0d,  0x34 }, // 403
+        { MANUFACTURER_KAM, 0x04,  0x1c }, // 602
+        { MANUFACTURER_KAM, 0x04,  0x35 }, // 603
+        { MANUFACTURER_KAM, 0x0c,  0x35 }, // 603
+        { MANUFACTURER_KAM, 0x04,  0x39 }, // 803
+    };
+
+    constexpr const char *aliases[] =
+    {
+        "multical302",
+        "multical303",
+        "multical403",
+        "multical602",
+        "multical603",
+        "multical803",
+    };
+}
+
+extern constexpr DriverInfo driver_info_kamheat = []
+{
+    DriverInfo di("kamheat");
+    di.setNameAliases(aliases);
+    di.setDefaultFields("name,id,total_energy_consumption_kwh,total_volume_m3,status,timestamp");
+    di.setMeterType(MeterType::HeatMeter);
+    di.addLinkMode(LinkMode::C1);
+    di.addLinkMode(LinkMode::T1);
+    di.setDetection(detection);
+
+    di.setConstructor([](MeterInfo& mi, const DriverInfo& di){ return shared_ptr<Meter>(new Driver(mi, di)); });
+    return di;
+}();
+
+namespace
+{
+    Driver::Driver(MeterInfo &mi, const DriverInfo &di) : MeterCommonImplementation(mi, di)
     {
         addOptionalLibraryFields("fabrication_no,meter_datetime,on_time_h,on_time_at_error_h");
         addOptionalLibraryFields("flow_return_temperature_difference_c");
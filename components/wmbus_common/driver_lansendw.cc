@@ -21,20 +21,29 @@ namespace
 {
     struct Driver : public virtual MeterCommonImplementation
     {
-        Driver(MeterInfo &mi, DriverInfo &di);
+        Driver(MeterInfo &mi, const DriverInfo &di);
     };
 
-    static bool ok = registerDriver([](DriverInfo&di)
+    constexpr DriverDetect detection[] =
     {
-        di.setName("lansendw");
-        di.setDefaultFields("name,id,status,timestamp");
-        di.setMeterType(MeterType::DoorWindowDetector);
-        di.addLinkMode(LinkMode::T1);
-        di.setConstructor([](MeterInfo& mi, DriverInfo& di){ return shared_ptr<Meter>(new Driver(mi, di)); });
-        di.addDetection(MANUFACTURER_LAS,  0x1d,  0x07);
-    });
+        { MANUFACTURER_LAS,  0x1d,  0x07 },
+    };
+}
+
+extern constexpr DriverInfo driver_info_lansendw = []
+{
+    DriverInfo di("lansendw");
+    di.setDefaultFields("name,id,status,timestamp");
+    di.setMeterType(MeterType::DoorWindowDetector);
+    di.addLinkMode(LinkMode::T1);
+    di.setConstructor([](MeterInfo& mi, const DriverInfo& di){ return shared_ptr<Meter>(new Driver(mi, di)); });
+    di.setDetection(detection);
+    return di;
+}();
 
-    Driver::Driver(MeterInfo &mi, DriverInfo &di) : MeterCommonImplementation(mi, di)
+namespace
+{
+    Driver::Driver(MeterInfo &mi, const DriverInfo &di) : MeterCommonImplementation(mi, di)
     {
         addStringFieldWithExtractorAndLookup(
             "status",
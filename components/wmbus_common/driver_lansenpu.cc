@@ -21,21 +21,30 @@ namespace
 {
     struct Driver : public virtual MeterCommonImplementation
     {
-        Driver(MeterInfo &mi, DriverInfo &di);
+        Driver(MeterInfo &mi, const DriverInfo &di);
     };
 
-    static bool ok = registerDriver([](DriverInfo&di)
+    constexpr DriverDetect detection[] =
     {
-        di.setName("lansenpu");
-        di.setDefaultFields("name,id,status,a_counter,b_counter,timestamp");
-        di.setMeterType(MeterType::PulseCounter);
-        di.addDetection(MANUFACTURER_LAS,  0x00,  0x14);
-        di.addDetection(MANUFACTURER_LAS,  0x00,  0x1b);
-        di.addDetection(MANUFACTURER_LAS,  0x02,  0x0b);
-        di.setConstructor([](MeterInfo& mi, DriverInfo& di){ return shared_ptr<Meter>(new Driver(mi, di)); });
-    });
+        { MANUFACTURER_LAS,  0x00,  0x14 },
+        { MANUFACTURER_LAS,  0x00,  0x1b },
+        { MANUFACTURER_LAS,  0x02,  0x0b },
+    };
+}
+
+extern constexpr DriverInfo driver_info_lansenpu = []
+{
+    DriverInfo di("lansenpu");
+    di.setDefaultFields("name,id,status,a_counter,b_counter,timestamp");
+    di.setMeterType(MeterType::PulseCounter);
+    di.setDetection(detection);
+    di.setConstructor([](MeterInfo& mi, const DriverInfo& di){ return shared_ptr<Meter>(new Driver(mi, di)); });
+    return di;
+}();
 
-    Driver::Driver(MeterInfo &mi, DriverInfo &di) : MeterCommonImplementation(mi, di)
+namespace
+{
+    Driver::Driver(MeterInfo &mi, const DriverInfo &di) : MeterCommonImplementation(mi, di)
     {
         setMfctTPLStatusBits(
             Translate::Lookup()
@@ -23,20 +23,29 @@ namespace
 {
     struct Driver : public virtual MeterCommonImplementation
     {
-        Driver(MeterInfo &mi, DriverInfo &di);
+        Driver(MeterInfo &mi, const DriverInfo &di);
     };
 
-    static bool ok = registerDriver([](DriverInfo&di)
+    constexpr DriverDetect detection[] =
     {
-        di.setName("lansenrp");
-        di.setDefaultFields("name,id,status,total_routed_messages_counter,used_router_slots_counter,is_repeater_listening,timestamp");
-        di.setMeterType(MeterType::Repeater);
-        di.addLinkMode(LinkMode::C1);
-        di.addDetection(MANUFACTURER_LAS, 0x32, 0x0b);
-        di.setConstructor([](MeterInfo& mi, DriverInfo& di){ return shared_ptr<Meter>(new Driver(mi, di)); });
-    });
-
-    Driver::Driver(MeterInfo &mi, DriverInfo &di) : MeterCommonImplementation(mi, di)
+        { MANUFACTURER_LAS, 0x32, 0x0b },
+    };
+}
+
+extern constexpr DriverInfo driver_info_lansenrp = []
+{
+    DriverInfo di("lansenrp");
+    di.setDefaultFields("name,id,status,total_routed_messages_counter,used_router_slots_counter,is_repeater_listening,timestamp");
+    di.setMeterType(MeterType::Repeater);
+    di.addLinkMode(LinkMode::C1);
+    di.setDetection(detection);
+    di.setConstructor([](MeterInfo& mi, const DriverInfo& di){ return shared_ptr<Meter>(new Driver(mi, di)); });
+    return di;
+}();
+
+namespace
+{
+    Driver::Driver(MeterInfo &mi, const DriverInfo &di) : MeterCommonImplementation(mi, di)
     {
         setMfctTPLStatusBits(
             Translate::Lookup()
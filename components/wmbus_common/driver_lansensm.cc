@@ -21,20 +21,29 @@ namespace
 {
     struct Driver : public virtual MeterCommonImplementation
     {
-        Driver(MeterInfo &mi, DriverInfo &di);
+        Driver(MeterInfo &mi, const DriverInfo &di);
     };
 
-    static bool ok = registerDriver([](DriverInfo&di)
+    constexpr DriverDetect detection[] =
     {
-        di.setName("lansensm");
-        di.setDefaultFields("name,id,status,minutes_since_last_manual_test_counter,timestamp");
-        di.setMeterType(MeterType::SmokeDetector);
-        di.addLinkMode(LinkMode::T1);
-        di.addDetection(MANUFACTURER_LAS, 0x1a, 0x03);
-        di.setConstructor([](MeterInfo& mi, DriverInfo& di){ return shared_ptr<Meter>(new Driver(mi, di)); });
-    });
+        { MANUFACTURER_LAS, 0x1a, 0x03 },
+    };
+}
+
+extern constexpr DriverInfo driver_info_lansensm = []
+{
+    DriverInfo di("lansensm");
+    di.setDefaultFields("name,id,status,minutes_since_last_manual_test_counter,timestamp");
+    di.setMeterType(MeterType::SmokeDetector);
+    di.addLinkMode(LinkMode::T1);
+    di.setDetection(detection);
+    di.setConstructor([](MeterInfo& mi, const DriverInfo& di){ return shared_ptr<Meter>(new Driver(mi, di)); });
+    return di;
+}();
 
-    Driver::Driver(MeterInfo &mi, DriverInfo &di) : MeterCommonImplementation(mi, di)
+namespace
+{
+    Driver::Driver(MeterInfo &mi, const DriverInfo &di) : MeterCommonImplementation(mi, di)
     {
         addStringFieldWithExtractorAndLookup(
             "status",
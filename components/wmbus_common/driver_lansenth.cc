@@ -21,20 +21,29 @@ namespace
 {
     struct Driver : public virtual MeterCommonImplementation
     {
-        Driver(MeterInfo &mi, DriverInfo &di);
+        Driver(MeterInfo &mi, const DriverInfo &di);
     };
 
-    static bool ok = registerDriver([](DriverInfo&di)
+    constexpr DriverDetect detection[] =
     {
-        di.setName("lansenth");
-        di.setDefaultFields("name,id,current_temperature_c,current_relative_humidity_rh,timestamp");
-        di.setMeterType(MeterType::TempHygroMeter);
-        di.addDetection(MANUFACTURER_LAS,  0x1b,  0x07);
-        di.addDetection(MANUFACTURER_LAS,  0x1b,  0x09);
-        di.setConstructor([](MeterInfo& mi, DriverInfo& di){ return shared_ptr<Meter>(new Driver(mi, di)); });
-    });
-
-    Driver::Driver(MeterInfo &mi, DriverInfo &di) : MeterCommonImplementation(mi, di)
+        { MANUFACTURER_LAS,  0x1b,  0x07 },
+        { MANUFACTURER_LAS,  0x1b,  0x09 },
+    };
+}
+
+extern constexpr DriverInfo driver_info_lansenth = []
+{
+    DriverInfo di("lansenth");
+    di.setDefaultFields("name,id,current_temperature_c,current_relative_humidity_rh,timestamp");
+    di.setMeterType(MeterType::TempHygroMeter);
+    di.setDetection(detection);
+    di.setConstructor([](MeterInfo& mi, const DriverInfo& di){ return shared_ptr<Meter>(new Driver(mi, di)); });
+    return di;
+}();
+
+namespace
+{
+    Driver::Driver(MeterInfo &mi, const DriverInfo &di) : MeterCommonImplementation(mi, di)
     {
         addOptionalLibraryFields("on_time_h");
         setMfctTPLStatusBits(
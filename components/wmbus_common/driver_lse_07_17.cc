@@ -21,24 +21,33 @@ namespace
 {
     struct Driver : public virtual MeterCommonImplementation
     {
-        Driver(MeterInfo &mi, DriverInfo &di);
+        Driver(MeterInfo &mi, const DriverInfo &di);
     };
 
-    static bool ok = registerDriver([](DriverInfo&di)
-        {
-            di.setName("lse_07_17");
-            di.setDefaultFields("name,id,total_m3,due_date_m3,due_date,error_code,error_date,device_date_time,timestamp");
-            di.setMeterType(MeterType::WaterMeter);
-            di.addLinkMode(LinkMode::S1);
-            di.addDetection(MANUFACTURER_LSE, 0x06,  0x18);
-            di.addDetection(MANUFACTURER_LSE, 0x07,  0x18);
-            di.addDetection(MANUFACTURER_LSE, 0x07,  0x16);
-            di.addDetection(MANUFACTURER_LSE, 0x07,  0x17);
-            di.addDetection(MANUFACTURER_LSE, 0x07,  0xd8);
-            di.setConstructor([](MeterInfo& mi, DriverInfo& di){ return shared_ptr<Meter>(new Driver(mi, di)); });
-        });
-
-    Driver::Driver(MeterInfo &mi, DriverInfo &di) : MeterCommonImplementation(mi, di)
+    constexpr DriverDetect detection[] =
+    {
+        { MANUFACTURER_LSE, 0x06,  0x18 },
+        { MANUFACTURER_LSE, 0x07,  0x18 },
+        { MANUFACTURER_LSE, 0x07,  0x16 },
+        { MANUFACTURER_LSE, 0x07,  0x17 },
+        { MANUFACTURER_LSE, 0x07,  0xd8 },
+    };
+}
+
+extern constexpr DriverInfo driver_info_lse_07_17 = []
+{
+    DriverInfo di("lse_07_17");
+    di.setDefaultFields("name,id,total_m3,due_date_m3,due_date,error_code,error_date,device_date_time,timestamp");
+    di.setMeterType(MeterType::WaterMeter);
+    di.addLinkMode(LinkMode::S1);
+    di.setDetection(detection);
+    di.setConstructor([](MeterInfo& mi, const DriverInfo& di){ return shared_ptr<Meter>(new Driver(mi, di)); });
+    return di;
+}();
+
+namespace
+{
+    Driver::Driver(MeterInfo &mi, const DriverInfo &di) : MeterCommonImplementation(mi, di)
     {
         addNumericFieldWithExtractor(
             "total",
@@ -21,23 +21,32 @@ namespace
 {
     struct Driver : public virtual MeterCommonImplementation
     {
-        Driver(MeterInfo &mi, DriverInfo &di);
+        Driver(MeterInfo &mi, const DriverInfo &di);
     };
 
-    static bool ok = registerDriver([](DriverInfo&di)
+    constexpr DriverDetect detection[] =
     {
-        di.setName("lse_08");
-        di.setDefaultFields("name,id,set_date,consumption_at_set_date_hca,timestamp");
-        di.setMeterType(MeterType::HeatCostAllocationMeter);
-        di.addLinkMode(LinkMode::C1);
-        di.addLinkMode(LinkMode::T1);
-        di.addLinkMode(LinkMode::S1);
-        di.addDetection(MANUFACTURER_LSE, 0x08,  0x01);
-
-        di.setConstructor([](MeterInfo& mi, DriverInfo& di){ return shared_ptr<Meter>(new Driver(mi, di)); });
-    });
-
-    Driver::Driver(MeterInfo &mi, DriverInfo &di) : MeterCommonImplementation(mi, di)
+        { MANUFACTURER_LSE, 0x08,  0x01 },
+    };
+}
+
+extern constexpr DriverInfo driver_info_lse_08 = []
+{
+    DriverInfo di("lse_08");
+    di.setDefaultFields("name,id,set_date,consumption_at_set_date_hca,timestamp");
+    di.setMeterType(MeterType::HeatCostAllocationMeter);
+    di.addLinkMode(LinkMode::C1);
+    di.addLinkMode(LinkMode::T1);
+    di.addLinkMode(LinkMode::S1);
+    di.setDetection(detection);
+
+    di.setConstructor([](MeterInfo& mi, const DriverInfo& di){ return shared_ptr<Meter>(new Driver(mi, di)); });
+    return di;
+}();
+
+namespace
+{
+    Driver::Driver(MeterInfo &mi, const DriverInfo &di) : MeterCommonImplementation(mi, di)
     {
         addStringFieldWithExtractorAndLookup(
             "status",
@@ -21,20 +21,29 @@ namespace
 {
     struct Driver : public virtual MeterCommonImplementation
     {
-        Driver(MeterInfo &mi, DriverInfo &di);
+        Driver(MeterInfo &mi, const DriverInfo &di);
     };
 
-    static bool ok = registerDriver([](DriverInfo&di)
+    constexpr DriverDetect detection[] =
     {
-        di.setName("microclima");
-        di.setDefaultFields("name,id,status,total_energy_consumption_kwh,total_volume_m3,timestamp");
-        di.setMeterType(MeterType::HeatMeter);
-        di.addLinkMode(LinkMode::T1);
-        di.addDetection(MANUFACTURER_MAD, 0x04, 0x00);
-        di.setConstructor([](MeterInfo& mi, DriverInfo& di){ return shared_ptr<Meter>(new Driver(mi, di)); });
-    });
-
-    Driver::Driver(MeterInfo &mi, DriverInfo &di) : MeterCommonImplementation(mi, di)
+        { MANUFACTURER_MAD, 0x04, 0x00 },
+    };
+}
+
+extern constexpr DriverInfo driver_info_microclima = []
+{
+    DriverInfo di("microclima");
+    di.setDefaultFields("name,id,status,total_energy_consumption_kwh,total_volume_m3,timestamp");
+    di.setMeterType(MeterType::HeatMeter);
+    di.addLinkMode(LinkMode::T1);
+    di.setDetection(detection);
+    di.setConstructor([](MeterInfo& mi, const DriverInfo& di){ return shared_ptr<Meter>(new Driver(mi, di)); });
+    return di;
+}();
+
+namespace
+{
+    Driver::Driver(MeterInfo &mi, const DriverInfo &di) : MeterCommonImplementation(mi, di)
     {
         addOptionalLibraryFields("meter_datetime,model_version,parameter_set");
         addOptionalLibraryFields("flow_temperature_c,return_temperature_c");
@@ -22,22 +22,31 @@ namespace
 {
     struct Driver : public virtual MeterCommonImplementation
     {
-        Driver(MeterInfo &mi, DriverInfo &di);
+        Driver(MeterInfo &mi, const DriverInfo &di);
     };
 
-    static bool ok = registerDriver([](DriverInfo&di)
+    constexpr DriverDetect detection[] =
     {
-        di.setName("minomess");
-        di.setDefaultFields("name,id,total_m3,target_m3,status,timestamp");
-        di.setMeterType(MeterType::WaterMeter);
-        di.addLinkMode(LinkMode::C1);
-        di.addDetection(MANUFACTURER_ZRI, 0x07,  0x00);
-        di.addDetection(MANUFACTURER_ZRI, 0x16,  0x01);
-        di.addDetection(MANUFACTURER_ZRI, 0x06,  0x01);
-        di.setConstructor([](MeterInfo& mi, DriverInfo& di){ return shared_ptr<Meter>(new Driver(mi, di)); });
-    });
-
-    Driver::Driver(MeterInfo &mi, DriverInfo &di) : MeterCommonImplementation(mi, di)
+        { MANUFACTURER_ZRI, 0x07,  0x00 },
+        { MANUFACTURER_ZRI, 0x16,  0x01 },
+        { MANUFACTURER_ZRI, 0x06,  0x01 },
+    };
+}
+
+extern constexpr DriverInfo driver_info_minomess = []
+{
+    DriverInfo di("minomess");
+    di.setDefaultFields("name,id,total_m3,target_m3,status,timestamp");
+    di.setMeterType(MeterType::WaterMeter);
+    di.addLinkMode(LinkMode::C1);
+    di.setDetection(detection);
+    di.setConstructor([](MeterInfo& mi, const DriverInfo& di){ return shared_ptr<Meter>(new Driver(mi, di)); });
+    return di;
+}();
+
+namespace
+{
+    Driver::Driver(MeterInfo &mi, const DriverInfo &di) : MeterCommonImplementation(mi, di)
     {
         addOptionalLibraryFields("meter_date,fabrication_no,operating_time_h,on_time_h,on_time_at_error_h,meter_datetime");
         addOptionalLibraryFields("total_m3,total_backward_m3,volume_flow_m3h");
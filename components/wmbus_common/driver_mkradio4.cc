@@ -21,26 +21,35 @@ namespace
 {
     struct Driver : public virtual MeterCommonImplementation
     {
-        Driver(MeterInfo &mi, DriverInfo &di);
+        Driver(MeterInfo &mi, const DriverInfo &di);
 
         void processContent(Telegram *t);
     };
 
-    static bool ok = registerDriver([](DriverInfo&di)
+    constexpr DriverDetect detection[] =
     {
-        di.setName("mkradio4");
-        di.setDefaultFields("name,id,total_m3,target_m3,timestamp");
-        di.setMeterType(MeterType::WaterMeter);
-        di.addLinkMode(LinkMode::T1);
-        di.addDetection(MANUFACTURER_TCH, 0x62,  0x95);
-        di.addDetection(MANUFACTURER_TCH, 0x62,  0x70);
-        di.addDetection(MANUFACTURER_TCH, 0x72,  0x95);
-        di.addDetection(MANUFACTURER_TCH, 0x72,  0x70);
-        di.usesProcessContent();
-        di.setConstructor([](MeterInfo& mi, DriverInfo& di){ return shared_ptr<Meter>(new Driver(mi, di)); });
-    });
-
-    Driver::Driver(MeterInfo &mi, DriverInfo &di) : MeterCommonImplementation(mi, di)
+        { MANUFACTURER_TCH, 0x62,  0x95 },
+        { MANUFACTURER_TCH, 0x62,  0x70 },
+        { MANUFACTURER_TCH, 0x72,  0x95 },
+        { MANUFACTURER_TCH, 0x72,  0x70 },
+    };
+}
+
+extern constexpr DriverInfo driver_info_mkradio4 = []
+{
+    DriverInfo di("mkradio4");
+    di.setDefaultFields("name,id,total_m3,target_m3,timestamp");
+    di.setMeterType(MeterType::WaterMeter);
+    di.addLinkMode(LinkMode::T1);
+    di.setDetection(detection);
+    di.usesProcessContent();
+    di.setConstructor([](MeterInfo& mi, const DriverInfo& di){ return shared_ptr<Meter>(new Driver(mi, di)); });
+    return di;
+}();
+
+namespace
+{
+    Driver::Driver(MeterInfo &mi, const DriverInfo &di) : MeterCommonImplementation(mi, di)
     {
         addNumericField("total",
                         Quantity::Volume,
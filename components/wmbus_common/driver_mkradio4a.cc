@@ -21,23 +21,31 @@ namespace
 {
     struct Driver : public virtual MeterCommonImplementation
     {
-        Driver(MeterInfo &mi, DriverInfo &di);
+        Driver(MeterInfo &mi, const DriverInfo &di);
     };
 
-    static bool ok = registerDriver([](DriverInfo&di)
-
+    constexpr DriverDetect detection[] =
     {
-        di.setName("mkradio4a");
-        di.setDefaultFields("name,id,target_m3,target_date,timestamp");
-        di.setMeterType(MeterType::WaterMeter);
-        di.addLinkMode(LinkMode::T1);
-        di.addLinkMode(LinkMode::C1);
-        di.addDetection(MANUFACTURER_HYD, 0x06,  0xfe);
-        di.addDetection(MANUFACTURER_TCH, 0x37,  0x95);
-        di.setConstructor([](MeterInfo& mi, DriverInfo& di){ return shared_ptr<Meter>(new Driver(mi, di)); });
-    });
+        { MANUFACTURER_HYD, 0x06,  0xfe },
+        { MANUFACTURER_TCH, 0x37,  0x95 },
+    };
+}
 
-    Driver::Driver(MeterInfo &mi, DriverInfo &di) : MeterCommonImplementation(mi, di)
+extern constexpr DriverInfo driver_info_mkradio4a = []
+{
+    DriverInfo di("mkradio4a");
+    di.setDefaultFields("name,id,target_m3,target_date,timestamp");
+    di.setMeterType(MeterType::WaterMeter);
+    di.addLinkMode(LinkMode::T1);
+    di.addLinkMode(LinkMode::C1);
+    di.setDetection(detection);
+    di.setConstructor([](MeterInfo& mi, const DriverInfo& di){ return shared_ptr<Meter>(new Driver(mi, di)); });
+    return di;
+}();
+
+namespace
+{
+    Driver::Driver(MeterInfo &mi, const DriverInfo &di) : MeterCommonImplementation(mi, di)
     {
         setExpectedTPLSecurityMode(TPLSecurityMode::AES_CBC_IV);
 
@@ -20,24 +20,33 @@
 namespace
 {
     struct Driver : public virtual MeterCommonImplementation {
-        Driver(MeterInfo &mi, DriverInfo &di);
+        Driver(MeterInfo &mi, const DriverInfo &di);
     };
 
-    static bool ok = registerDriver([](DriverInfo&di)
+    constexpr DriverDetect detection[] =
     {
-        di.setName("multical21");
-        di.setDefaultFields("name,id,total_m3,target_m3,max_flow_m3h,flow_temperature_c,external_temperature_c,status,timestamp");
-
-        di.setMeterType(MeterType::WaterMeter);
-        di.addLinkMode(LinkMode::C1);
         // Multical21
-        di.addDetection(MANUFACTURER_KAM, 0x06,  0x1b);
-        di.addDetection(MANUFACTURER_KAM, 0x16,  0x1b);
+        { MANUFACTURER_KAM, 0x06,  0x1b },
+        { MANUFACTURER_KAM, 0x16,  0x1b },
+    };
+}
+
+extern constexpr DriverInfo driver_info_multical21 = []
+{
+    DriverInfo di("multical21");
+    di.setDefaultFields("name,id,total_m3,target_m3,max_flow_m3h,flow_temperature_c,external_temperature_c,status,timestamp");
+
+    di.setMeterType(MeterType::WaterMeter);
+    di.addLinkMode(LinkMode::C1);
+    di.setDetection(detection);
 
-        di.setConstructor([](MeterInfo& mi, DriverInfo& di){ return shared_ptr<Meter>(new Driver(mi, di)); });
-    });
+    di.setConstructor([](MeterInfo& mi, const DriverInfo& di){ return shared_ptr<Meter>(new Driver(mi, di)); });
+    return di;
+}();
 
-    Driver::Driver(MeterInfo &mi, DriverInfo &di) : MeterCommonImplementation(mi, di)
+namespace
+{
+    Driver::Driver(MeterInfo &mi, const DriverInfo &di) : MeterCommonImplementation(mi, di)
     {
         addStringFieldWithExtractorAndLookup(
             "status",
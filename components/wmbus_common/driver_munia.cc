@@ -21,20 +21,29 @@ namespace
 {
     struct Driver : public virtual MeterCommonImplementation
     {
-        Driver(MeterInfo &mi, DriverInfo &di);
+        Driver(MeterInfo &mi, const DriverInfo &di);
     };
 
-    static bool ok = registerDriver([](DriverInfo&di)
+    constexpr DriverDetect detection[] =
     {
-        di.setName("munia");
-        di.setDefaultFields("name,id,current_temperature_c,current_relative_humidity_rh,timestamp");
-        di.setMeterType(MeterType::TempHygroMeter);
-        di.setConstructor([](MeterInfo& mi, DriverInfo& di){ return shared_ptr<Meter>(new Driver(mi, di)); });
-        di.addDetection(MANUFACTURER_WEP, 0x1b,  0x02);
-        di.addDetection(MANUFACTURER_WEP, 0x1b,  0x04);
-    });
+        { MANUFACTURER_WEP, 0x1b,  0x02 },
+        { MANUFACTURER_WEP, 0x1b,  0x04 },
+    };
+}
+
+extern constexpr DriverInfo driver_info_munia = []
+{
+    DriverInfo di("munia");
+    di.setDefaultFields("name,id,current_temperature_c,current_relative_humidity_rh,timestamp");
+    di.setMeterType(MeterType::TempHygroMeter);
+    di.setConstructor([](MeterInfo& mi, const DriverInfo& di){ return shared_ptr<Meter>(new Driver(mi, di)); });
+    di.setDetection(detection);
+    return di;
+}();
 
-    Driver::Driver(MeterInfo &mi, DriverInfo &di) : MeterCommonImplementation(mi, di)
+namespace
+{
+    Driver::Driver(MeterInfo &mi, const DriverInfo &di) : MeterCommonImplementation(mi, di)
     {
         addStringFieldWithExtractorAndLookup(
             "status",
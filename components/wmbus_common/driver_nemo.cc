@@ -21,26 +21,35 @@ namespace
 {
     struct Driver : public virtual MeterCommonImplementation
     {
-        Driver(MeterInfo &mi, DriverInfo &di);
+        Driver(MeterInfo &mi, const DriverInfo &di);
     };
 
-    static bool ok = registerDriver([](DriverInfo&di)
+    constexpr DriverDetect detection[] =
     {
-        di.setName("nemo");
-        di.setDefaultFields(
-            "name,id,status,"
-            "total_active_positive_3phase_kwh,"
-            "active_positive_3phase_kw,"
-            "timestamp");
-        di.setMeterType(MeterType::ElectricityMeter);
-        di.addLinkMode(LinkMode::MBUS);
-        di.addDetection(MANUFACTURER_IME,  0x02,  0x1d);
-        di.setConstructor([](MeterInfo& mi, DriverInfo& di){ return shared_ptr<Meter>(new Driver(mi, di)); });
-    });
+        { MANUFACTURER_IME,  0x02,  0x1d },
+    };
+}
+
+extern constexpr DriverInfo driver_info_nemo = []
+{
+    DriverInfo di("nemo");
+    di.setDefaultFields(
+        "name,id,status,"
+        "total_active_positive_3phase_kwh,"
+        "active_positive_3phase_kw,"
+        "timestamp");
+    di.setMeterType(MeterType::ElectricityMeter);
+    di.addLinkMode(LinkMode::MBUS);
+    di.setDetection(detection);
+    di.setConstructor([](MeterInfo& mi, const DriverInfo& di){ return shared_ptr<Meter>(new Driver(mi, di)); });
+    return di;
+}();
 
+namespace
+{
     // Telegram 1 /////////////////////////////////////////////////////////////////////
 
-    Driver::Driver(MeterInfo &mi, DriverInfo &di) : MeterCommonImplementation(mi, di)
+    Driver::Driver(MeterInfo &mi, const DriverInfo &di) : MeterCommonImplementation(mi, di)
     {
         addNumericFieldWithExtractor(
             "total_active_positive_3phase",
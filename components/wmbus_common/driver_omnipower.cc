@@ -41,23 +41,32 @@ namespace
 {
     struct Driver : public virtual MeterCommonImplementation
     {
-        Driver(MeterInfo &mi, DriverInfo &di);
+        Driver(MeterInfo &mi, const DriverInfo &di);
     };
 
-    static bool ok = registerDriver([](DriverInfo&di)
+    constexpr DriverDetect detection[] =
     {
-        di.setName("omnipower");
-        di.setDefaultFields("name,id,total_energy_consumption_kwh,total_energy_production_kwh,"
-                            "current_power_consumption_kw,current_power_production_kw,timestamp");
-        di.setMeterType(MeterType::ElectricityMeter);
-        di.addLinkMode(LinkMode::C1);
+        { MANUFACTURER_KAM, 0x02,  0x30 },
+    };
+}
+
+extern constexpr DriverInfo driver_info_omnipower = []
+{
+    DriverInfo di("omnipower");
+    di.setDefaultFields("name,id,total_energy_consumption_kwh,total_energy_production_kwh,"
+                        "current_power_consumption_kw,current_power_production_kw,timestamp");
+    di.setMeterType(MeterType::ElectricityMeter);
+    di.addLinkMode(LinkMode::C1);
 
-        di.addDetection(MANUFACTURER_KAM, 0x02,  0x30);
+    di.setDetection(detection);
 
-        di.setConstructor([](MeterInfo& mi, DriverInfo& di){ return shared_ptr<Meter>(new Driver(mi, di)); });
-    });
+    di.setConstructor([](MeterInfo& mi, const DriverInfo& di){ return shared_ptr<Meter>(new Driver(mi, di)); });
+    return di;
+}();
 
-    Driver::Driver(MeterInfo &mi, DriverInfo &di) : MeterCommonImplementation(mi, di)
+namespace
+{
+    Driver::Driver(MeterInfo &mi, const DriverInfo &di) : MeterCommonImplementation(mi, di)
     {
         addNumericFieldWithExtractor(
             "total_energy_consumption",
@@ -21,20 +21,29 @@ namespace
 {
     struct Driver : public virtual MeterCommonImplementation
     {
-        Driver(MeterInfo &mi, DriverInfo &di);
+        Driver(MeterInfo &mi, const DriverInfo &di);
     };
 
-    static bool ok = registerDriver([](DriverInfo&di)
+    constexpr DriverDetect detection[] =
     {
-        di.setName("piigth");
-        di.setDefaultFields("name,id,status,temperature_c,relative_humidity_rh,timestamp");
-        di.setMeterType(MeterType::TempHygroMeter);
-        di.addLinkMode(LinkMode::MBUS);
-        di.setConstructor([](MeterInfo& mi, DriverInfo& di){ return shared_ptr<Meter>(new Driver(mi, di)); });
-        di.addDetection(MANUFACTURER_PII,  0x1b,  0x01);
-    });
-
-    Driver::Driver(MeterInfo &mi, DriverInfo &di) : MeterCommonImplementation(mi, di)
+        { MANUFACTURER_PII,  0x1b,  0x01 },
+    };
+}
+
+extern constexpr DriverInfo driver_info_piigth = []
+{
+    DriverInfo di("piigth");
+    di.setDefaultFields("name,id,status,temperature_c,relative_humidity_rh,timestamp");
+    di.setMeterType(MeterType::TempHygroMeter);
+    di.addLinkMode(LinkMode::MBUS);
+    di.setConstructor([](MeterInfo& mi, const DriverInfo& di){ return shared_ptr<Meter>(new Driver(mi, di)); });
+    di.setDetection(detection);
+    return di;
+}();
+
+namespace
+{
+    Driver::Driver(MeterInfo &mi, const DriverInfo &di) : MeterCommonImplementation(mi, di)
     {
         addOptionalLibraryFields("fabrication_no,software_version");
 
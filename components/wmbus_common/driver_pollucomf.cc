@@ -20,22 +20,31 @@
 namespace
 {
     struct Driver : public virtual MeterCommonImplementation {
-        Driver(MeterInfo &mi, DriverInfo &di);
+        Driver(MeterInfo &mi, const DriverInfo &di);
     };
 
-    static bool ok = registerDriver([](DriverInfo&di)
+    constexpr DriverDetect detection[] =
     {
-        di.setName("pollucomf");
-        di.setDefaultFields("name,id,status,total_kwh,total_m3,target_kwh,target_m3,timestamp");
-        di.setMeterType(MeterType::HeatMeter);
-        di.addLinkMode(LinkMode::T1);    // default
-        di.addLinkMode(LinkMode::C1);
-        di.addLinkMode(LinkMode::MBUS);  // optional hw module
-        di.addDetection(MANUFACTURER_SEN, 0x04,  0x1d);
-        di.setConstructor([](MeterInfo& mi, DriverInfo& di){ return shared_ptr<Meter>(new Driver(mi, di)); });
-    });
-
-    Driver::Driver(MeterInfo &mi, DriverInfo &di) : MeterCommonImplementation(mi, di)
+        { MANUFACTURER_SEN, 0x04,  0x1d },
+    };
+}
+
+extern constexpr DriverInfo driver_info_pollucomf = []
+{
+    DriverInfo di("pollucomf");
+    di.setDefaultFields("name,id,status,total_kwh,total_m3,target_kwh,target_m3,timestamp");
+    di.setMeterType(MeterType::HeatMeter);
+    di.addLinkMode(LinkMode::T1);    // default
+    di.addLinkMode(LinkMode::C1);
+    di.addLinkMode(LinkMode::MBUS);  // optional hw module
+    di.setDetection(detection);
+    di.setConstructor([](MeterInfo& mi, const DriverInfo& di){ return shared_ptr<Meter>(new Driver(mi, di)); });
+    return di;
+}();
+
+namespace
+{
+    Driver::Driver(MeterInfo &mi, const DriverInfo &di) : MeterCommonImplementation(mi, di)
     {
         addStringField(
             "status",
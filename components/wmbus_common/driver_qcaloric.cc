@@ -21,31 +21,45 @@ namespace
 {
     struct Driver : public virtual MeterCommonImplementation
     {
-        Driver(MeterInfo &mi, DriverInfo &di);
+        Driver(MeterInfo &mi, const DriverInfo &di);
     };
 
-    static bool ok = registerDriver([](DriverInfo&di)
+    constexpr DriverDetect detection[] =
     {
-        di.setName("qcaloric");
-        di.addNameAlias("whe5x");
-        di.addNameAlias("whe46x");
-        di.setDefaultFields("name,id,current_consumption_hca,set_date,consumption_at_set_date_hca,timestamp");
-        di.setMeterType(MeterType::HeatCostAllocationMeter);
-        di.addLinkMode(LinkMode::C1);
-        di.addLinkMode(LinkMode::T1);
-        di.addLinkMode(LinkMode::S1);
-        di.addDetection(MANUFACTURER_LSE, 0x08,  0x34);
-        di.addDetection(MANUFACTURER_LSE, 0x08,  0x35);
-        di.addDetection(MANUFACTURER_QDS, 0x08,  0x35);
-        di.addDetection(MANUFACTURER_QDS, 0x08,  0x34);
-        di.addDetection(MANUFACTURER_QDS, 0x08,  0x36);
-        di.addDetection(MANUFACTURER_LSE, 0x08,  0x18); // whe4
-        di.addDetection(MANUFACTURER_ZRI, 0x08,  0xfd);
-
-        di.setConstructor([](MeterInfo& mi, DriverInfo& di){ return shared_ptr<Meter>(new Driver(mi, di)); });
-    });
-
-    Driver::Driver(MeterInfo &mi, DriverInfo &di) : MeterCommonImplementation(mi, di)
+        { MANUFACTURER_LSE, 0x08,  0x34 },
+        { MANUFACTURER_LSE, 0x08,  0x35 },
+        { MANUFACTURER_QDS, 0x08,  0x35 },
+        { MANUFACTURER_QDS, 0x08,  0x34 },
+        { MANUFACTURER_QDS, 0x08,  0x36 },
+        { MANUFACTURER_LSE, 0x08,  0x18 }, // whe4
+        { MANUFACTURER_ZRI, 0x08,  0xfd },
+    };
+
+    constexpr const char *aliases[] =
+    {
+        "whe5x",
+        "whe46x",
+    };
+}
+
+extern constexpr DriverInfo driver_info_qcaloric = []
+{
+    DriverInfo di("qcaloric");
+    di.setNameAliases(aliases);
+    di.setDefaultFields("name,id,current_consumption_hca,set_date,consumption_at_set_date_hca,timestamp");
+    di.setMeterType(MeterType::HeatCostAllocationMeter);
+    di.addLinkMode(LinkMode::C1);
+    di.addLinkMode(LinkMode::T1);
+    di.addLinkMode(LinkMode::S1);
+    di.setDetection(detection);
+
+    di.setConstructor([](MeterInfo& mi, const DriverInfo& di){ return shared_ptr<Meter>(new Driver(mi, di)); });
+    return di;
+}();
+
+namespace
+{
+    Driver::Driver(MeterInfo &mi, const DriverInfo &di) : MeterCommonImplementation(mi, di)
     {
         addStringFieldWithExtractorAndLookup(
             "status",
@@ -22,26 +22,37 @@ namespace
 {
     struct Driver : public virtual MeterCommonImplementation
     {
-        Driver(MeterInfo &mi, DriverInfo &di);
+        Driver(MeterInfo &mi, const DriverInfo &di);
 
     protected:
       void processContent(Telegram *t) override;
     };
 
-    static bool ok = registerDriver([](DriverInfo&di)
+    constexpr DriverDetect detection[] =
     {
-        di.setName("qheat");
-        di.setDefaultFields("name,id,total_energy_consumption_kwh,last_month_date,last_month_energy_consumption_kwh,timestamp");
-        di.setMeterType(MeterType::HeatMeter);
-        di.addLinkMode(LinkMode::C1);
-        di.addDetection(MANUFACTURER_QDS, 0x04,  0x23);
-        di.addDetection(MANUFACTURER_QDS, 0x04,  0x46);
-        di.addDetection(MANUFACTURER_QDS, 0x37,  0x23);
-        di.usesProcessContent();
-        di.setConstructor([](MeterInfo& mi, DriverInfo& di){ return shared_ptr<Meter>(new Driver(mi, di)); });
-    });
-
-    Driver::Driver(MeterInfo &mi, DriverInfo &di) :  MeterCommonImplementation(mi, di)
+        { MANUFACTURER_QDS, 0x04,  0x23 },
+        { MANUFACTURER_QDS, 0x04,  0x46 },
+        { MANUFACTURER_QDS, 0x37,  0x23 },
+    };
+}
+
+extern constexpr DriverInfo driver_info_qheat = []
+{
+    DriverInfo di("qheat");
+    di.setDefaultFields("name,id,total_energy_consumption_kwh,last_month_date,last_month_energy_consumption_kwh,timestamp");
+    di.setMeterType(MeterType::HeatMeter);
+    di.addLinkMode(LinkMode::C1);
+    di.setDetection(detection);
+    di.usesProcessContent();
+    // processContent patches the telegram header, so it must run for every telegram.
+    di.extractUnchangedPayloads();
+    di.setConstructor([](MeterInfo& mi, const DriverInfo& di){ return shared_ptr<Meter>(new Driver(mi, di)); });
+    return di;
+}();
+
+namespace
+{
+    Driver::Driver(MeterInfo &mi, const DriverInfo &di) :  MeterCommonImplementation(mi, di)
     {
         addStringFieldWithExtractorAndLookup(
             "status",
@@ -162,7 +173,7 @@ namespace
             hex2bin(entry.value.substr(0, 8), &v);
             // FIXME PROBLEM
             Address a;
-            a.id = tostrprintf("%02x%02x%02x%02x", v[3], v[2], v[1], v[0]);
+            a.setId(tostrprintf("%02x%02x%02x%02x", v[3], v[2], v[1], v[0]));
             t->addresses.push_back(a);
             std::string info = "*** " + entry.value.substr(0, 8) + " tpl-id (" + t->addresses.back().id + ")";
             t->addSpecialExplanation(entry.offset, 4, KindOfData::CONTENT, Understanding::FULL, info.c_str());
@@ -21,7 +21,7 @@ namespace
 {
     struct Driver : public virtual MeterCommonImplementation
     {
-        Driver(MeterInfo &mi, DriverInfo &di);
+        Driver(MeterInfo &mi, const DriverInfo &di);
 
         // Telegrams contain the following values:
 
@@ -35,19 +35,28 @@ namespace
         // prev_month_kwh[13] - 13 past month readings, storagenr 2 to 14
     };
 
-    static bool ok = registerDriver([](DriverInfo &di)
-        {
-            di.setName("qheat_55_us");
-            di.setDefaultFields("name,id,total_energy_consumption_kwh,key_date_kwh,timestamp");
-            di.setMeterType(MeterType::HeatMeter);
+    constexpr DriverDetect detection[] =
+    {
+        { MANUFACTURER_LUG, 0x04,  0x07 },
+        { MANUFACTURER_LUG, 0x04,  0x0a },
+    };
+}
 
-            di.addLinkMode(LinkMode::C1);
-            di.addDetection(MANUFACTURER_LUG, 0x04,  0x07);
-            di.addDetection(MANUFACTURER_LUG, 0x04,  0x0a);
-            di.setConstructor([](MeterInfo& mi, DriverInfo& di){ return shared_ptr<Meter>(new Driver(mi, di)); });
-        });
+extern constexpr DriverInfo driver_info_qheat_55_us = []
+{
+    DriverInfo di("qheat_55_us");
+    di.setDefaultFields("name,id,total_energy_consumption_kwh,key_date_kwh,timestamp");
+    di.setMeterType(MeterType::HeatMeter);
+
+    di.addLinkMode(LinkMode::C1);
+    di.setDetection(detection);
+    di.setConstructor([](MeterInfo& mi, const DriverInfo& di){ return shared_ptr<Meter>(new Driver(mi, di)); });
+    return di;
+}();
 
-    Driver::Driver(MeterInfo &mi, DriverInfo &di) : MeterCommonImplementation(mi, di)
+namespace
+{
+    Driver::Driver(MeterInfo &mi, const DriverInfo &di) : MeterCommonImplementation(mi, di)
     {
         addStringFieldWithExtractor(
             "device_date_time",
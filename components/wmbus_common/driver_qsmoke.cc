@@ -21,21 +21,30 @@ namespace
 {
     struct Driver : public virtual MeterCommonImplementation
     {
-        Driver(MeterInfo &mi, DriverInfo &di);
+        Driver(MeterInfo &mi, const DriverInfo &di);
     };
 
-    static bool ok = registerDriver([](DriverInfo&di)
+    constexpr DriverDetect detection[] =
     {
-        di.setName("qsmoke");
-        di.setDefaultFields("name,id,status,last_alarm_date,alarm_counter,timestamp");
-        di.setMeterType(MeterType::SmokeDetector);
-        di.addLinkMode(LinkMode::T1);
-        di.addDetection(MANUFACTURER_QDS, 0x1a,  0x21);
-        di.addDetection(MANUFACTURER_QDS, 0x1a,  0x23);
-        di.setConstructor([](MeterInfo& mi, DriverInfo& di){ return shared_ptr<Meter>(new Driver(mi, di)); });
-    });
-
-    Driver::Driver(MeterInfo &mi, DriverInfo &di) : MeterCommonImplementation(mi, di)
+        { MANUFACTURER_QDS, 0x1a,  0x21 },
+        { MANUFACTURER_QDS, 0x1a,  0x23 },
+    };
+}
+
+extern constexpr DriverInfo driver_info_qsmoke = []
+{
+    DriverInfo di("qsmoke");
+    di.setDefaultFields("name,id,status,last_alarm_date,alarm_counter,timestamp");
+    di.setMeterType(MeterType::SmokeDetector);
+    di.addLinkMode(LinkMode::T1);
+    di.setDetection(detection);
+    di.setConstructor([](MeterInfo& mi, const DriverInfo& di){ return shared_ptr<Meter>(new Driver(mi, di)); });
+    return di;
+}();
+
+namespace
+{
+    Driver::Driver(MeterInfo &mi, const DriverInfo &di) : MeterCommonImplementation(mi, di)
     {
         addStringFieldWithExtractorAndLookup(
             "status",
@@ -21,22 +21,31 @@ namespace
 {
     struct Driver : public virtual MeterCommonImplementation
     {
-        Driver(MeterInfo &mi, DriverInfo &di);
+        Driver(MeterInfo &mi, const DriverInfo &di);
     };
 
-    static bool ok = registerDriver([](DriverInfo&di)
+    constexpr DriverDetect detection[] =
     {
-        di.setName("qualcosonic");
-        di.setDefaultFields("name,id,status,total_heat_energy_kwh,total_cooling_energy_kwh,"
-                            "power_kw,target_datetime,target_heat_energy_kwh,target_cooling_energy_kwh,timestamp");
-        di.setMeterType(MeterType::HeatCoolingMeter);
-        di.addLinkMode(LinkMode::C1);
-        di.addDetection(MANUFACTURER_AXI, 0x0d,  0x0b);
-        di.addDetection(MANUFACTURER_AXI, 0x0d,  0x0c);
-        di.setConstructor([](MeterInfo& mi, DriverInfo& di){ return shared_ptr<Meter>(new Driver(mi, di)); });
-    });
-
-    Driver::Driver(MeterInfo &mi, DriverInfo &di) :  MeterCommonImplementation(mi, di)
+        { MANUFACTURER_AXI, 0x0d,  0x0b },
+        { MANUFACTURER_AXI, 0x0d,  0x0c },
+    };
+}
+
+extern constexpr DriverInfo driver_info_qualcosonic = []
+{
+    DriverInfo di("qualcosonic");
+    di.setDefaultFields("name,id,status,total_heat_energy_kwh,total_cooling_energy_kwh,"
+                        "power_kw,target_datetime,target_heat_energy_kwh,target_cooling_energy_kwh,timestamp");
+    di.setMeterType(MeterType::HeatCoolingMeter);
+    di.addLinkMode(LinkMode::C1);
+    di.setDetection(detection);
+    di.setConstructor([](MeterInfo& mi, const DriverInfo& di){ return shared_ptr<Meter>(new Driver(mi, di)); });
+    return di;
+}();
+
+namespace
+{
+    Driver::Driver(MeterInfo &mi, const DriverInfo &di) :  MeterCommonImplementation(mi, di)
     {
         addOptionalLibraryFields("fabrication_no,operating_time_h,on_time_h,meter_datetime,meter_datetime_at_error");
         addOptionalLibraryFields("total_m3,flow_temperature_c,return_temperature_c,flow_return_temperature_difference_c,volume_flow_m3h");
@@ -22,37 +22,46 @@ namespace
 {
     struct Driver : public virtual MeterCommonImplementation
     {
-        Driver(MeterInfo &mi, DriverInfo &di);
+        Driver(MeterInfo &mi, const DriverInfo &di);
     protected:
         void processContent(Telegram *t) override;
     };
 
-    static bool ok = registerDriver([](DriverInfo&di)
+    constexpr DriverDetect detection[] =
     {
-        di.setName("qwater");
-        di.setDefaultFields("name,id,total_m3,"
-                            "due_date_m3,"
-                            "due_date,"
-                            "status,"
-                            "timestamp");
-        di.setMeterType(MeterType::WaterMeter);
-        di.addLinkMode(LinkMode::S1);
-        di.addDetection(MANUFACTURER_QDS, 0x37,  0x33);
-        di.addDetection(MANUFACTURER_QDS, 0x06,  0x16);
-        di.addDetection(MANUFACTURER_QDS, 0x07,  0x16);
-        di.addDetection(MANUFACTURER_QDS, 0x06,  0x17);
-        di.addDetection(MANUFACTURER_QDS, 0x07,  0x17);
-        di.addDetection(MANUFACTURER_QDS, 0x06,  0x18);
-        di.addDetection(MANUFACTURER_QDS, 0x07,  0x18);
-        di.addDetection(MANUFACTURER_QDS, 0x07,  0x19);
-        di.addDetection(MANUFACTURER_QDS, 0x06,  0x35);
-        di.addDetection(MANUFACTURER_QDS, 0x07,  0x35);
-        di.usesProcessContent();
-
-        di.setConstructor([](MeterInfo& mi, DriverInfo& di){ return shared_ptr<Meter>(new Driver(mi, di)); });
-    });
-
-    Driver::Driver(MeterInfo &mi, DriverInfo &di) :
+        { MANUFACTURER_QDS, 0x37,  0x33 },
+        { MANUFACTURER_QDS, 0x06,  0x16 },
+        { MANUFACTURER_QDS, 0x07,  0x16 },
+        { MANUFACTURER_QDS, 0x06,  0x17 },
+        { MANUFACTURER_QDS, 0x07,  0x17 },
+        { MANUFACTURER_QDS, 0x06,  0x18 },
+        { MANUFACTURER_QDS, 0x07,  0x18 },
+        { MANUFACTURER_QDS, 0x07,  0x19 },
+        { MANUFACTURER_QDS, 0x06,  0x35 },
+        { MANUFACTURER_QDS, 0x07,  0x35 },
+    };
+}
+
+extern constexpr DriverInfo driver_info_qwater = []
+{
+    DriverInfo di("qwater");
+    di.setDefaultFields("name,id,total_m3,"
+                        "due_date_m3,"
+                        "due_date,"
+                        "status,"
+                        "timestamp");
+    di.setMeterType(MeterType::WaterMeter);
+    di.addLinkMode(LinkMode::S1);
+    di.setDetection(detection);
+    di.usesProcessContent();
+
+    di.setConstructor([](MeterInfo& mi, const DriverInfo& di){ return shared_ptr<Meter>(new Driver(mi, di)); });
+    return di;
+}();
+
+namespace
+{
+    Driver::Driver(MeterInfo &mi, const DriverInfo &di) :
         MeterCommonImplementation(mi, di)
     {
         addOptionalLibraryFields("meter_datetime");
@@ -21,20 +21,29 @@ namespace
 {
     struct Driver : public virtual MeterCommonImplementation
     {
-        Driver(MeterInfo &mi, DriverInfo &di);
+        Driver(MeterInfo &mi, const DriverInfo &di);
     };
 
-    static bool ok = registerDriver([](DriverInfo&di)
+    constexpr DriverDetect detection[] =
     {
-        di.setName("rfmamb");
-        di.setDefaultFields("name,id,current_temperature_c,current_relative_humidity_rh,timestamp");
-        di.setMeterType(MeterType::TempHygroMeter);
-        di.addLinkMode(LinkMode::T1);
-        di.setConstructor([](MeterInfo& mi, DriverInfo& di){ return shared_ptr<Meter>(new Driver(mi, di)); });
-        di.addDetection(MANUFACTURER_BMT, 0x1b,  0x10);
-    });
-
-    Driver::Driver(MeterInfo &mi, DriverInfo &di) : MeterCommonImplementation(mi, di)
+        { MANUFACTURER_BMT, 0x1b,  0x10 },
+    };
+}
+
+extern constexpr DriverInfo driver_info_rfmamb = []
+{
+    DriverInfo di("rfmamb");
+    di.setDefaultFields("name,id,current_temperature_c,current_relative_humidity_rh,timestamp");
+    di.setMeterType(MeterType::TempHygroMeter);
+    di.addLinkMode(LinkMode::T1);
+    di.setConstructor([](MeterInfo& mi, const DriverInfo& di){ return shared_ptr<Meter>(new Driver(mi, di)); });
+    di.setDetection(detection);
+    return di;
+}();
+
+namespace
+{
+    Driver::Driver(MeterInfo &mi, const DriverInfo &di) : MeterCommonImplementation(mi, di)
     {
         addStringField(
             "status",
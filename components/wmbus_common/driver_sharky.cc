@@ -22,24 +22,33 @@ namespace
 {
     struct Driver : public virtual MeterCommonImplementation
     {
-        Driver(MeterInfo &mi, DriverInfo &di);
+        Driver(MeterInfo &mi, const DriverInfo &di);
     };
 
-    static bool ok = registerDriver([](DriverInfo&di)
+    constexpr DriverDetect detection[] =
     {
-        // This is the sharky 775 heat meter driver, should this merge with the sharky 774 driver?
-        di.setName("sharky");
-        di.setDefaultFields("name,id,total_energy_consumption_kwh,total_energy_consumption_tariff1_kwh,total_volume_m3,"
-                            "total_volume_tariff2_m3,volume_flow_m3h,power_kw,flow_temperature_c,"
-                            "return_temperature_c,temperature_difference_c,timestamp");
-        di.setMeterType(MeterType::HeatMeter);
-        di.addLinkMode(LinkMode::T1);
-        di.addDetection(MANUFACTURER_HYD, 0x04, 0x20);
-        di.addDetection(MANUFACTURER_DME, 0x04, 0x40);
-        di.setConstructor([](MeterInfo& mi, DriverInfo& di){ return shared_ptr<Meter>(new Driver(mi, di)); });
-    });
-
-    Driver::Driver(MeterInfo &mi, DriverInfo &di) : MeterCommonImplementation(mi, di)
+        { MANUFACTURER_HYD, 0x04, 0x20 },
+        { MANUFACTURER_DME, 0x04, 0x40 },
+    };
+}
+
+extern constexpr DriverInfo driver_info_sharky = []
+{
+    DriverInfo di("sharky");
+    // This is the sharky 775 heat meter driver, should this merge with the sharky 774 driver?
+    di.setDefaultFields("name,id,total_energy_consumption_kwh,total_energy_consumption_tariff1_kwh,total_volume_m3,"
+                        "total_volume_tariff2_m3,volume_flow_m3h,power_kw,flow_temperature_c,"
+                        "return_temperature_c,temperature_difference_c,timestamp");
+    di.setMeterType(MeterType::HeatMeter);
+    di.addLinkMode(LinkMode::T1);
+    di.setDetection(detection);
+    di.setConstructor([](MeterInfo& mi, const DriverInfo& di){ return shared_ptr<Meter>(new Driver(mi, di)); });
+    return di;
+}();
+
+namespace
+{
+    Driver::Driver(MeterInfo &mi, const DriverInfo &di) : MeterCommonImplementation(mi, di)
     {
         addOptionalLibraryFields("operating_time_h");
 
@@ -22,26 +22,35 @@ namespace
 {
     struct Driver : public virtual MeterCommonImplementation
     {
-        Driver(MeterInfo &mi, DriverInfo &di);
+        Driver(MeterInfo &mi, const DriverInfo &di);
     };
 
-    static bool ok = registerDriver([](DriverInfo&di)
+    constexpr DriverDetect detection[] =
     {
-        di.setName("sharky774");
-        di.setDefaultFields("name,id,"
-                            "total_energy_consumption_kwh,"
-                            "energy_at_set_date_kwh,"
-                            "set_date,"
-                            "timestamp");
-        di.setMeterType(MeterType::HeatMeter);
-        di.addLinkMode(LinkMode::T1);
-        di.addDetection(MANUFACTURER_DME, 0x04,  0x41);
-        di.addDetection(MANUFACTURER_DME, 0x0d,  0x41);
-        di.addDetection(MANUFACTURER_DME, 0x0c,  0x41);
-        di.setConstructor([](MeterInfo& mi, DriverInfo& di){ return shared_ptr<Meter>(new Driver(mi, di)); });
-    });
-
-    Driver::Driver(MeterInfo &mi, DriverInfo &di) :  MeterCommonImplementation(mi, di)
+        { MANUFACTURER_DME, 0x04,  0x41 },
+        { MANUFACTURER_DME, 0x0d,  0x41 },
+        { MANUFACTURER_DME, 0x0c,  0x41 },
+    };
+}
+
+extern constexpr DriverInfo driver_info_sharky774 = []
+{
+    DriverInfo di("sharky774");
+    di.setDefaultFields("name,id,"
+                        "total_energy_consumption_kwh,"
+                        "energy_at_set_date_kwh,"
+                        "set_date,"
+                        "timestamp");
+    di.setMeterType(MeterType::HeatMeter);
+    di.addLinkMode(LinkMode::T1);
+    di.setDetection(detection);
+    di.setConstructor([](MeterInfo& mi, const DriverInfo& di){ return shared_ptr<Meter>(new Driver(mi, di)); });
+    return di;
+}();
+
+namespace
+{
+    Driver::Driver(MeterInfo &mi, const DriverInfo &di) :  MeterCommonImplementation(mi, di)
     {
         addNumericFieldWithExtractor(
             "total_energy_consumption",
@@ -41,24 +41,33 @@ namespace
 {
     struct Driver : public virtual MeterCommonImplementation
     {
-        Driver(MeterInfo &mi, DriverInfo &di);
+        Driver(MeterInfo &mi, const DriverInfo &di);
     };
 
-    static bool ok = registerDriver([](DriverInfo&di)
+    constexpr DriverDetect detection[] =
     {
-        di.setName("topaseskr");
-        di.setDefaultFields(
-            "name,id,total_m3,temperature_c,current_flow_m3h,volume_year_period_m3,"
-            "reverse_volume_year_period_m3,meter_year_period_end_date,volume_month_period_m3,"
-            "meter_month_period_end_datetime,timestamp");
-        di.setMeterType(MeterType::WaterMeter);
-        di.addLinkMode(LinkMode::T1);
-        di.addDetection(MANUFACTURER_AMT, 0x06,  0xf1);
-        di.addDetection(MANUFACTURER_AMT, 0x07,  0xf1);
-        di.setConstructor([](MeterInfo& mi, DriverInfo& di){ return shared_ptr<Meter>(new Driver(mi, di)); });
-    });
-
-    Driver::Driver(MeterInfo &mi, DriverInfo &di) : MeterCommonImplementation(mi, di)
+        { MANUFACTURER_AMT, 0x06,  0xf1 },
+        { MANUFACTURER_AMT, 0x07,  0xf1 },
+    };
+}
+
+extern constexpr DriverInfo driver_info_topaseskr = []
+{
+    DriverInfo di("topaseskr");
+    di.setDefaultFields(
+        "name,id,total_m3,temperature_c,current_flow_m3h,volume_year_period_m3,"
+        "reverse_volume_year_period_m3,meter_year_period_end_date,volume_month_period_m3,"
+        "meter_month_period_end_datetime,timestamp");
+    di.setMeterType(MeterType::WaterMeter);
+    di.addLinkMode(LinkMode::T1);
+    di.setDetection(detection);
+    di.setConstructor([](MeterInfo& mi, const DriverInfo& di){ return shared_ptr<Meter>(new Driver(mi, di)); });
+    return di;
+}();
+
+namespace
+{
+    Driver::Driver(MeterInfo &mi, const DriverInfo &di) : MeterCommonImplementation(mi, di)
     {
         addOptionalLibraryFields("total_m3,access_counter");
 
@@ -21,19 +21,28 @@ namespace
 {
     struct Driver : public virtual MeterCommonImplementation
     {
-        Driver(MeterInfo &mi, DriverInfo &di);
+        Driver(MeterInfo &mi, const DriverInfo &di);
     };
 
-    static bool ok = registerDriver([](DriverInfo&di)
+    constexpr DriverDetect detection[] =
     {
-        di.setName("ultraheat");
-        di.setDefaultFields("name,id,heat_kwh,timestamp");
-        di.setMeterType(MeterType::HeatMeter);
-        di.addDetection(MANUFACTURER_LUG, 0x04,  0x04);
-        di.setConstructor([](MeterInfo& mi, DriverInfo& di){ return shared_ptr<Meter>(new Driver(mi, di)); });
-    });
-
-    Driver::Driver(MeterInfo &mi, DriverInfo &di) : MeterCommonImplementation(mi, di)
+        { MANUFACTURER_LUG, 0x04,  0x04 },
+    };
+}
+
+extern constexpr DriverInfo driver_info_ultraheat = []
+{
+    DriverInfo di("ultraheat");
+    di.setDefaultFields("name,id,heat_kwh,timestamp");
+    di.setMeterType(MeterType::HeatMeter);
+    di.setDetection(detection);
+    di.setConstructor([](MeterInfo& mi, const DriverInfo& di){ return shared_ptr<Meter>(new Driver(mi, di)); });
+    return di;
+}();
+
+namespace
+{
+    Driver::Driver(MeterInfo &mi, const DriverInfo &di) : MeterCommonImplementation(mi, di)
     {
         addOptionalLibraryFields("meter_datetime,fabrication_no");
 
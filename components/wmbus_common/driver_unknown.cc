@@ -19,24 +19,23 @@
 
 struct MeterUnknown : public virtual MeterCommonImplementation
 {
-    MeterUnknown(MeterInfo &mi, DriverInfo &di);
+    MeterUnknown(MeterInfo &mi, const DriverInfo &di);
 };
 
-static bool ok = registerDriver([](DriverInfo&di)
+extern constexpr DriverInfo driver_info_unknown = []
 {
-    di.setName("unknown");
+    DriverInfo di("unknown");
     di.setDefaultFields("name,id,timestamp");
     di.setMeterType(MeterType::UnknownMeter);
-    di.setConstructor([](MeterInfo& mi, DriverInfo& di){ return shared_ptr<Meter>(new MeterUnknown(mi, di)); });
-});
+    di.setConstructor([](MeterInfo& mi, const DriverInfo& di){ return shared_ptr<Meter>(new MeterUnknown(mi, di)); });
+    return di;
+}();
 
-MeterUnknown::MeterUnknown(MeterInfo &mi, DriverInfo &di) : MeterCommonImplementation(mi, di)
+MeterUnknown::MeterUnknown(MeterInfo &mi, const DriverInfo &di) : MeterCommonImplementation(mi, di)
 {
 }
 
 shared_ptr<Meter> createUnknown(MeterInfo &mi)
 {
-    DriverInfo di;
-    di.setName("unknown");
-    return shared_ptr<Meter>(new MeterUnknown(mi, di));
+    return shared_ptr<Meter>(new MeterUnknown(mi, driver_info_unknown));
 }
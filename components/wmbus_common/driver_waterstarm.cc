@@ -21,26 +21,35 @@ namespace
 {
     struct Driver : public virtual MeterCommonImplementation
     {
-        Driver(MeterInfo &mi, DriverInfo &di);
+        Driver(MeterInfo &mi, const DriverInfo &di);
     };
 
-    static bool ok = registerDriver([](DriverInfo&di)
+    constexpr DriverDetect detection[] =
     {
-        di.setName("waterstarm");
-        di.setDefaultFields("name,id,total_m3,total_backwards_m3,status,timestamp");
-        di.setMeterType(MeterType::WaterMeter);
-        di.addLinkMode(LinkMode::T1);
-        di.addLinkMode(LinkMode::C1);
-        di.addDetection(MANUFACTURER_DWZ,  0x06,  0x00);    // warm water
-        di.addDetection(MANUFACTURER_DWZ,  0x06,  0x02);    // warm water
-        di.addDetection(MANUFACTURER_DWZ,  0x07,  0x02);
-        di.addDetection(MANUFACTURER_EFE,  0x07,  0x03);
-        di.addDetection(MANUFACTURER_DWZ,  0x07,  0x00);    // water meter
-
-        di.setConstructor([](MeterInfo& mi, DriverInfo& di){ return shared_ptr<Meter>(new Driver(mi, di)); });
-    });
-
-    Driver::Driver(MeterInfo &mi, DriverInfo &di) : MeterCommonImplementation(mi, di)
+        { MANUFACTURER_DWZ,  0x06,  0x00 }, // warm water
+        { MANUFACTURER_DWZ,  0x06,  0x02 }, // warm water
+        { MANUFACTURER_DWZ,  0x07,  0x02 },
+        { MANUFACTURER_EFE,  0x07,  0x03 },
+        { MANUFACTURER_DWZ,  0x07,  0x00 }, // water meter
+    };
+}
+
+extern constexpr DriverInfo driver_info_waterstarm = []
+{
+    DriverInfo di("waterstarm");
+    di.setDefaultFields("name,id,total_m3,total_backwards_m3,status,timestamp");
+    di.setMeterType(MeterType::WaterMeter);
+    di.addLinkMode(LinkMode::T1);
+    di.addLinkMode(LinkMode::C1);
+    di.setDetection(detection);
+
+    di.setConstructor([](MeterInfo& mi, const DriverInfo& di){ return shared_ptr<Meter>(new Driver(mi, di)); });
+    return di;
+}();
+
+namespace
+{
+    Driver::Driver(MeterInfo &mi, const DriverInfo &di) : MeterCommonImplementation(mi, di)
     {
         addStringFieldWithExtractorAndLookup(
             "status",
@@ -19,6 +19,7 @@
 #include"wmbus.h"
 #include"util.h"
 
+#include<algorithm>
 #include<assert.h>
 #include<cmath>
 #include<math.h>
@@ -149,20 +150,125 @@ LIST_OF_VIF_RANGES
     return false;
 }
 
-std::map<uint16_t,std::string> hash_to_format_;
+static FormatSignatureCache format_signature_cache_;
+// Formats too long for a FormatSignatureEntry, never persisted.
+struct LongFormatSignatureEntry
+{
+    uint32_t last_used; // 0 for an unused entry
+    uint16_t signature;
+    std::vector<uchar> bytes;
+};
+static LongFormatSignatureEntry long_format_signature_cache_[WMBUS_FORMAT_SIGNATURE_CACHE_SIZE];
+// Stamps entries with their last use, starts at 1 since 0 marks an unused entry.
+static uint32_t format_signature_clock_ = 0;
+static uint32_t format_signature_generation_ = 0;
+// Sorted signatures restored or learned since boot.
+static std::vector<uint16_t> seen_format_signatures_;
+
+template<typename Entry, size_t N>
+static Entry *findFormatSignatureEntry(Entry (&entries)[N], uint16_t format_signature)
+{
+    for (Entry &e : entries)
+    {
+        if (e.last_used != 0 && e.signature == format_signature) return &e;
+    }
+    return NULL;
+}
+
+template<typename Entry, size_t N>
+static Entry *leastRecentlyUsedFormatSignatureEntry(Entry (&entries)[N])
+{
+    Entry *victim = &entries[0];
+    for (Entry &e : entries)
+    {
+        if (e.last_used < victim->last_used) victim = &e;
+    }
+    return victim;
+}
+
+// Returns true when the signature was not seen before.
+static bool markFormatSignatureSeen(uint16_t format_signature)
+{
+    auto i = std::lower_bound(seen_format_signatures_.begin(), seen_format_signatures_.end(), format_signature);
+    if (i != seen_format_signatures_.end() && *i == format_signature) return false;
+    // Past the limit, new formats are still learned, they just do not make the cache dirty.
+    if (seen_format_signatures_.size() >= WMBUS_FORMAT_SIGNATURE_SEEN_MAX) return false;
+    seen_format_signatures_.insert(i, format_signature);
+    return true;
+}
 
 bool loadFormatBytesFromSignature(uint16_t format_signature, std::vector<uchar> *format_bytes)
 {
-    if (hash_to_format_.count(format_signature) > 0) {
+    FormatSignatureEntry *e = findFormatSignatureEntry(format_signature_cache_.entries, format_signature);
+    if (e != NULL) {
         debug("(dvparser) found remembered format for hash %x\n", format_signature);
-        // Return the proper hash!
-        hex2bin(hash_to_format_[format_signature], format_bytes);
+        e->last_used = ++format_signature_clock_;
+        format_bytes->assign(e->bytes, e->bytes+e->length);
+        return true;
+    }
+    LongFormatSignatureEntry *le = findFormatSignatureEntry(long_format_signature_cache_, format_signature);
+    if (le != NULL) {
+        debug("(dvparser) found remembered long format for hash %x\n", format_signature);
+        le->last_used = ++format_signature_clock_;
+        *format_bytes = le->bytes;
         return true;
     }
     // Unknown format signature.
     return false;
 }
 
+void rememberFormatBytes(const std::vector<uchar> &format_bytes)
+{
+    Crc16En13757 crc;
+    crc.update(format_bytes.data(), format_bytes.size());
+    uint16_t hash = crc.value();
+
+    if (format_bytes.size() > WMBUS_FORMAT_SIGNATURE_MAX_BYTES)
+    {
+        if (findFormatSignatureEntry(long_format_signature_cache_, hash) != NULL) return;
+
+        LongFormatSignatureEntry *victim = leastRecentlyUsedFormatSignatureEntry(long_format_signature_cache_);
+        victim->last_used = ++format_signature_clock_;
+        victim->signature = hash;
+        victim->bytes = format_bytes;
+        debug("(dvparser) found new long format \"%s\" with hash %x, remembering in RAM!\n", bin2hex(format_bytes).c_str(), hash);
+        return;
+    }
+
+    if (findFormatSignatureEntry(format_signature_cache_.entries, hash) != NULL) return;
+
+    FormatSignatureEntry *victim = leastRecentlyUsedFormatSignatureEntry(format_signature_cache_.entries);
+    victim->last_used = ++format_signature_clock_;
+    victim->signature = hash;
+    victim->length = format_bytes.size();
+    memcpy(victim->bytes, format_bytes.data(), format_bytes.size());
+    if (markFormatSignatureSeen(hash)) format_signature_generation_++;
+
+    debug("(dvparser) found new format \"%s\" with hash %x, remembering!\n", bin2hex(format_bytes).c_str(), hash);
+}
+
+const FormatSignatureCache &formatSignatureCache()
+{
+    return format_signature_cache_;
+}
+
+uint32_t formatSignatureCacheGeneration()
+{
+    return format_signature_generation_;
+}
+
+void restoreFormatSignatureCache(const FormatSignatureCache &cache)
+{
+    format_signature_cache_ = cache;
+    format_signature_clock_ = 0;
+    for (FormatSignatureEntry &e : format_signature_cache_.entries)
+    {
+        if (e.length > WMBUS_FORMAT_SIGNATURE_MAX_BYTES) e.last_used = 0;
+        if (e.last_used != 0) markFormatSignatureSeen(e.signature);
+        format_signature_clock_ = std::max(format_signature_clock_, e.last_used);
+    }
+}
+
 bool parseDV(Telegram *t,
              std::vector<uchar> &databytes,
              std::vector<uchar>::iterator data,
@@ -562,14 +668,8 @@ bool parseDV(Telegram *t,
         }
     }
 
-    std::string format_string = bin2hex(format_bytes);
-    uint16_t hash = crc16_EN13757(safeButUnsafeVectorPtr(format_bytes), format_bytes.size());
-
     if (data_has_difvifs) {
-        if (hash_to_format_.count(hash) == 0) {
-            hash_to_format_[hash] = format_string;
-            debug("(dvparser) found new format \"%s\" with hash %x, remembering!\n", format_string.c_str(), hash);
-        }
+        rememberFormatBytes(format_bytes);
     }
 
     return true;
@@ -510,7 +510,41 @@ struct FieldMatcher
     std::string str();
 };
 
+// The dif/vif bytes of full frames are remembered under their format signature,
+// so that compact frames (ci 0x79) with the same signature can be decoded.
+// The cache is bounded, when full the least recently used format is replaced.
+// Formats longer than WMBUS_FORMAT_SIGNATURE_MAX_BYTES are remembered in a
+// second cache of the same size, which is kept in RAM only.
+#ifndef WMBUS_FORMAT_SIGNATURE_CACHE_SIZE
+#define WMBUS_FORMAT_SIGNATURE_CACHE_SIZE 16
+#endif
+#define WMBUS_FORMAT_SIGNATURE_MAX_BYTES 96
+// How many signatures are tracked as seen since boot, see formatSignatureCacheGeneration.
+#define WMBUS_FORMAT_SIGNATURE_SEEN_MAX 1024
+
+struct FormatSignatureEntry
+{
+    uint32_t last_used; // 0 for an unused entry
+    uint16_t signature;
+    uchar length;
+    uchar bytes[WMBUS_FORMAT_SIGNATURE_MAX_BYTES];
+};
+
+struct FormatSignatureCache
+{
+    FormatSignatureEntry entries[WMBUS_FORMAT_SIGNATURE_CACHE_SIZE];
+};
+
 bool loadFormatBytesFromSignature(uint16_t format_signature, std::vector<uchar> *format_bytes);
+void rememberFormatBytes(const std::vector<uchar> &format_bytes);
+
+// For persisting the cache. The generation changes when a format is learned whose signature
+// was neither restored nor learned before since boot. A format learned again after it was
+// replaced does not change it, so more formats in range than the cache holds do not keep
+// the cache dirty.
+const FormatSignatureCache &formatSignatureCache();
+uint32_t formatSignatureCacheGeneration();
+void restoreFormatSignatureCache(const FormatSignatureCache &cache);
 
 struct Telegram;
 
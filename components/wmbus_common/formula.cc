@@ -20,6 +20,7 @@
 #include"meters.h"
 #include"units.h"
 
+#include<algorithm>
 #include<cmath>
 #include<string.h>
 #include<limits>
@@ -177,6 +178,92 @@ double NumericFormulaSquareRoot::calculate(SIUnit to_siunit)
     return v;
 }
 
+bool NumericFormulaConstant::compile(const SIUnit &to)
+{
+    formula()->emitPush(calculate(to));
+    return true;
+}
+
+bool NumericFormulaMeterField::compile(const SIUnit &to_si_unit)
+{
+    Meter *m = formula()->meter();
+    if (m == NULL)
+    {
+        formula()->emitPush(std::numeric_limits<double>::quiet_NaN());
+        return true;
+    }
+
+    // Bind the field to its index, the field infos are only ever appended to.
+    std::vector<FieldInfo> &fields = m->fieldInfos();
+    for (size_t i = 0; i < fields.size(); i++)
+    {
+        if (fields[i].vname() != vname_ || fields[i].xuantity() != quantity_) continue;
+
+        FormulaInstruction load(FormulaOpCode::LOAD_FIELD);
+        load.index = i;
+        load.unit = fields[i].displayUnit();
+        formula()->emit(load, 1);
+        formula()->emitConversion(toSIUnit(load.unit), to_si_unit);
+        return true;
+    }
+
+    return false;
+}
+
+bool NumericFormulaDVEntryField::compile(const SIUnit &to_si_unit)
+{
+    FormulaInstruction load(FormulaOpCode::LOAD_COUNTER);
+    load.counter = counter_;
+    formula()->emit(load, 1);
+    formula()->emitConversion(toSIUnit(Unit::COUNTER), to_si_unit);
+    return true;
+}
+
+bool NumericFormulaAddition::compile(const SIUnit &to_siunit)
+{
+    return formula()->compileMathOp(MathOp::ADD, left_.get(), right_.get(), to_siunit);
+}
+
+bool NumericFormulaSubtraction::compile(const SIUnit &to_siunit)
+{
+    return formula()->compileMathOp(MathOp::SUB, left_.get(), right_.get(), to_siunit);
+}
+
+bool NumericFormulaMultiplication::compile(const SIUnit &to_siunit)
+{
+    if (!formula()->compileNode(left_.get(), left_->siunit())) return false;
+    if (!formula()->compileNode(right_.get(), right_->siunit())) return false;
+    formula()->emit(FormulaInstruction(FormulaOpCode::MUL), -1);
+    formula()->emitConversion(siunit(), to_siunit);
+    return true;
+}
+
+bool NumericFormulaDivision::compile(const SIUnit &to_siunit)
+{
+    if (!formula()->compileNode(left_.get(), left_->siunit())) return false;
+    if (!formula()->compileNode(right_.get(), right_->siunit())) return false;
+    formula()->emit(FormulaInstruction(FormulaOpCode::DIV), -1);
+    formula()->emitConversion(siunit(), to_siunit);
+    return true;
+}
+
+bool NumericFormulaExponentiation::compile(const SIUnit &to_siunit)
+{
+    if (!formula()->compileNode(left_.get(), to_siunit)) return false;
+    if (!formula()->compileNode(right_.get(), to_siunit)) return false;
+    formula()->emit(FormulaInstruction(FormulaOpCode::POW), -1);
+    formula()->emitConversion(siunit(), to_siunit);
+    return true;
+}
+
+bool NumericFormulaSquareRoot::compile(const SIUnit &to_siunit)
+{
+    if (!formula()->compileNode(inner_.get(), inner_->siunit())) return false;
+    formula()->emit(FormulaInstruction(FormulaOpCode::SQRT), 0);
+    formula()->emitConversion(siunit(), to_siunit);
+    return true;
+}
+
 const char *toString(TokenType tt)
 {
     switch (tt) {
@@ -248,7 +335,12 @@ Unit Token::unit(const std::string &s)
 void FormulaImplementation::clear()
 {
     valid_ = true;
+    reads_meter_fields_ = false;
     op_stack_.clear();
+    program_.clear();
+    program_ok_ = false;
+    program_unit_ = Unit::Unknown;
+    program_meter_ = NULL;
     tokens_.clear();
     formula_ = "";
     dventry_ = NULL;
@@ -933,9 +1025,189 @@ double FormulaImplementation::calculate(Unit to, DVEntry *dve, Meter *m)
         return std::nan("");
     }
 
+    if (program_unit_ != to || program_meter_ != meter_) compile(to);
+
+    if (program_ok_) return execute();
+
     return topOp()->calculate(toSIUnit(to));
 }
 
+void FormulaImplementation::compile(Unit to)
+{
+    program_.clear();
+    program_depth_ = 0;
+    program_max_depth_ = 0;
+    program_unit_ = to;
+    program_meter_ = meter_;
+
+    program_ok_ = compileNode(topOp(), toSIUnit(to)) && program_max_depth_ <= FORMULA_MAX_STACK_DEPTH;
+    if (!program_ok_) program_.clear();
+
+    debug("(formula) compiled %zu instructions %s\n", program_.size(), program_ok_ ? "OK" : "FAILED");
+}
+
+bool FormulaImplementation::compileNode(NumericFormula *nf, const SIUnit &to)
+{
+    if (nf->isConstant())
+    {
+        // Calculated exactly as the tree would do it, but only once.
+        emitPush(nf->calculate(to));
+        return true;
+    }
+    return nf->compile(to);
+}
+
+bool FormulaImplementation::compileMathOp(MathOp op, NumericFormula *left, NumericFormula *right, const SIUnit &to)
+{
+    SIUnit &left_siunit = left->siunit();
+    SIUnit &right_siunit = right->siunit();
+    SIUnit v_siunit(Unit::COUNTER);
+
+    bool ok = left_siunit.mathOpTo(op, 0, 0, right_siunit, &v_siunit, NULL);
+    if (!ok) return false;
+
+    if (left_siunit.convertTo(0, right_siunit, NULL))
+    {
+        // Same units or temperatures, the left value is converted into the right unit.
+        if (!compileNode(left, left_siunit)) return false;
+        emitConversion(left_siunit, right_siunit);
+        if (!compileNode(right, right_siunit)) return false;
+        emit(FormulaInstruction(op == MathOp::ADD ? FormulaOpCode::ADD : FormulaOpCode::SUB), -1);
+    }
+    else
+    {
+        // Operating on a unix timestamp, which mathOpTo always puts to the left.
+        bool flip = right_siunit.exp() == SI_UnixTimestamp.exp();
+        NumericFormula *timestamp = flip ? right : left;
+        NumericFormula *other = flip ? left : right;
+
+        if (!compileNode(timestamp, timestamp->siunit())) return false;
+        if (!compileNode(other, other->siunit())) return false;
+
+        if (other->siunit().exp() == SI_Second.exp())
+        {
+            emitConversion(other->siunit(), SI_Second);
+            emit(FormulaInstruction(op == MathOp::ADD ? FormulaOpCode::ADD : FormulaOpCode::SUB), -1);
+        }
+        else
+        {
+            emit(FormulaInstruction(op == MathOp::ADD ? FormulaOpCode::ADD_MONTHS : FormulaOpCode::SUB_MONTHS), -1);
+        }
+    }
+
+    emitConversion(v_siunit, to);
+    return true;
+}
+
+void FormulaImplementation::emit(const FormulaInstruction &fi, int delta)
+{
+    program_.push_back(fi);
+    program_depth_ += delta;
+    program_max_depth_ = std::max(program_max_depth_, program_depth_);
+}
+
+void FormulaImplementation::emitPush(double c)
+{
+    FormulaInstruction push(FormulaOpCode::PUSH);
+    push.a = c;
+    emit(push, 1);
+}
+
+static inline double convertValue(const FormulaInstruction &fi, double v)
+{
+    if (fi.op == FormulaOpCode::SCALE) return (v*fi.a)/fi.b;
+    if (fi.op == FormulaOpCode::OFFSET_SCALE) return ((v+fi.a)*fi.b)/fi.c-fi.d;
+    return std::numeric_limits<double>::quiet_NaN();
+}
+
+void FormulaImplementation::emitConversion(const SIUnit &from, const SIUnit &to)
+{
+    FormulaInstruction conv(FormulaOpCode::INVALID);
+
+    if (from.exp() == to.exp())
+    {
+        // The multiplication and division are kept apart, a single a/b factor
+        // would not round the same as convertTo. Only scale 1 can be skipped.
+        if (from.scale() == 1.0 && to.scale() == 1.0) return;
+        conv.op = FormulaOpCode::SCALE;
+        conv.a = from.scale();
+        conv.b = to.scale();
+    }
+    else if (from.temperatureConversionTo(to, &conv.a, &conv.b, &conv.c, &conv.d))
+    {
+        conv.op = FormulaOpCode::OFFSET_SCALE;
+    }
+
+    if (program_.size() > 0 && program_.back().op == FormulaOpCode::PUSH)
+    {
+        program_.back().a = convertValue(conv, program_.back().a);
+        return;
+    }
+    emit(conv, 0);
+}
+
+double FormulaImplementation::execute()
+{
+    double stack[FORMULA_MAX_STACK_DEPTH];
+    int sp = 0;
+
+    for (const FormulaInstruction &fi : program_)
+    {
+        switch (fi.op)
+        {
+        case FormulaOpCode::PUSH:
+            stack[sp++] = fi.a;
+            break;
+        case FormulaOpCode::LOAD_FIELD:
+            // A meter is always present, otherwise the field was compiled into a nan push.
+            stack[sp++] = meter_->getNumericValue(&meter_->fieldInfos()[fi.index], fi.unit);
+            break;
+        case FormulaOpCode::LOAD_COUNTER:
+            if (dventry_ == NULL) stack[sp++] = std::numeric_limits<double>::quiet_NaN();
+            else stack[sp++] = dventry_->getCounter(fi.counter);
+            break;
+        case FormulaOpCode::SCALE:
+        case FormulaOpCode::OFFSET_SCALE:
+        case FormulaOpCode::INVALID:
+            stack[sp-1] = convertValue(fi, stack[sp-1]);
+            break;
+        case FormulaOpCode::ADD:
+            sp--;
+            stack[sp-1] = stack[sp-1]+stack[sp];
+            break;
+        case FormulaOpCode::SUB:
+            sp--;
+            stack[sp-1] = stack[sp-1]-stack[sp];
+            break;
+        case FormulaOpCode::MUL:
+            sp--;
+            stack[sp-1] = stack[sp-1]*stack[sp];
+            break;
+        case FormulaOpCode::DIV:
+            sp--;
+            stack[sp-1] = stack[sp-1]/stack[sp];
+            break;
+        case FormulaOpCode::POW:
+            sp--;
+            stack[sp-1] = pow(stack[sp-1], stack[sp]);
+            break;
+        case FormulaOpCode::SQRT:
+            stack[sp-1] = sqrt(stack[sp-1]);
+            break;
+        case FormulaOpCode::ADD_MONTHS:
+            sp--;
+            stack[sp-1] = addMonths(stack[sp-1], stack[sp]);
+            break;
+        case FormulaOpCode::SUB_MONTHS:
+            sp--;
+            stack[sp-1] = addMonths(stack[sp-1], -stack[sp]);
+            break;
+        }
+    }
+
+    return stack[0];
+}
+
 void FormulaImplementation::doConstant(Unit u, double c)
 {
     pushOp(new NumericFormulaConstant(this, u, c));
@@ -1042,6 +1314,8 @@ void FormulaImplementation::doMeterField(Unit u, FieldInfo *fi)
     SIUnit to_si_unit = toSIUnit(u);
     assert(from_si_unit.convertTo(0, to_si_unit, NULL));
 
+    reads_meter_fields_ = true;
+
     pushOp(new NumericFormulaMeterField(this, u, fi->vname(), fi->xuantity()));
 }
 
@@ -1293,3 +1567,12 @@ std::string StringInterpolatorImplementation::apply(Meter *m, DVEntry *dve)
 
     return result;
 }
+
+bool StringInterpolatorImplementation::dependsOnlyOnCounters()
+{
+    for (auto &f : formulas_)
+    {
+        if (f->readsMeterFields()) return false;
+    }
+    return true;
+}
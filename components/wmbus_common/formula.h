@@ -51,6 +51,8 @@ struct Formula
     virtual void setMeter(Meter *m) = 0;
     // Specify which dventry to read counter fields from.
     virtual void setDVEntry(DVEntry *dve) = 0;
+    // Returns true if the formula reads meter fields, not only constants and dventry counters.
+    virtual bool readsMeterFields() = 0;
 
     virtual ~Formula() = 0;
 };
@@ -73,6 +75,11 @@ struct StringInterpolator
 
     */
     virtual std::string apply(Meter *m, DVEntry *dve) = 0;
+    /**
+       dependsOnlyOnCounters: Returns true if apply reads nothing but the storage, tariff and subunit
+       counters of the dve, ie the result can be memoized on these counters.
+    */
+    virtual bool dependsOnlyOnCounters() = 0;
 
     virtual ~StringInterpolator() = 0;
 };
@@ -25,12 +25,52 @@
 
 struct FormulaImplementation;
 
+// Formulas are compiled into a flat stack bytecode that is executed instead of walking the tree.
+enum class FormulaOpCode
+{
+    PUSH,         // Push the constant a.
+    LOAD_FIELD,   // Push the value of the meter field at index, in unit.
+    LOAD_COUNTER, // Push the dventry counter.
+    SCALE,        // Convert the top value: (v*a)/b
+    OFFSET_SCALE, // Convert the top temperature: ((v+a)*b)/c-d
+    INVALID,      // The top value cannot be converted, replace it with nan.
+    ADD,
+    SUB,
+    MUL,
+    DIV,
+    POW,
+    SQRT,
+    ADD_MONTHS,   // Add the top number of months to the unix timestamp below it.
+    SUB_MONTHS    // Subtract the top number of months from the unix timestamp below it.
+};
+
+struct FormulaInstruction
+{
+    explicit FormulaInstruction(FormulaOpCode o) : op(o) {}
+
+    FormulaOpCode op;
+    size_t index {};
+    Unit unit {};
+    DVEntryCounterType counter {};
+    double a {};
+    double b {};
+    double c {};
+    double d {};
+};
+
+// Formulas that need a deeper stack are calculated by walking the tree.
+#define FORMULA_MAX_STACK_DEPTH 16
+
 struct NumericFormula
 {
     NumericFormula(FormulaImplementation *f, SIUnit u) : formula_(f), siunit_(u) { }
     SIUnit &siunit() { return siunit_; }
     // Calculate the formula and return the value in the given "to" unit.
     virtual double calculate(SIUnit to) = 0;
+    // Emit bytecode that leaves calculate(to) on top of the stack. Return false if this is not possible.
+    virtual bool compile(const SIUnit &to) = 0;
+    // True if the node does not read any meter field or dventry counter, ie it can be folded.
+    virtual bool isConstant() = 0;
     virtual std::string str() = 0;
     virtual std::string tree() = 0;
     virtual ~NumericFormula() = 0;
@@ -47,6 +87,8 @@ struct NumericFormulaConstant : public NumericFormula
 {
     NumericFormulaConstant(FormulaImplementation *f, Unit u, double c) : NumericFormula(f, u), constant_(c) {}
     double calculate(SIUnit to);
+    bool compile(const SIUnit &to);
+    bool isConstant() { return true; }
     std::string str();
     std::string tree();
     ~NumericFormulaConstant();
@@ -62,6 +104,8 @@ struct NumericFormulaMeterField : public NumericFormula
         : NumericFormula(f, u), vname_(v), quantity_(q) {}
 
     double calculate(SIUnit to);
+    bool compile(const SIUnit &to);
+    bool isConstant() { return false; }
     std::string str();
     std::string tree();
     ~NumericFormulaMeterField();
@@ -77,6 +121,8 @@ struct NumericFormulaDVEntryField : public NumericFormula
     NumericFormulaDVEntryField(FormulaImplementation *f, Unit u, DVEntryCounterType ct) : NumericFormula(f, u), counter_(ct) {}
 
     double calculate(SIUnit to);
+    bool compile(const SIUnit &to);
+    bool isConstant() { return false; }
     std::string str();
     std::string tree();
     ~NumericFormulaDVEntryField();
@@ -101,6 +147,7 @@ struct NumericFormulaPair : public NumericFormula
 
     std::string str();
     std::string tree();
+    bool isConstant() { return left_->isConstant() && right_->isConstant(); }
     ~NumericFormulaPair();
 
 protected:
@@ -119,6 +166,7 @@ struct NumericFormulaAddition : public NumericFormulaPair
         : NumericFormulaPair(f, siu, a, b, "ADD", "+") {}
 
     double calculate(SIUnit to);
+    bool compile(const SIUnit &to);
 
     ~NumericFormulaAddition();
 };
@@ -131,6 +179,7 @@ struct NumericFormulaSubtraction : public NumericFormulaPair
         : NumericFormulaPair(f, siu, a, b, "SUB", "-") {}
 
     double calculate(SIUnit to);
+    bool compile(const SIUnit &to);
 
     ~NumericFormulaSubtraction();
 };
@@ -143,6 +192,7 @@ struct NumericFormulaMultiplication : public NumericFormulaPair
         : NumericFormulaPair(f, siu, a, b, "TIMES", "×") {}
 
     double calculate(SIUnit to);
+    bool compile(const SIUnit &to);
 
     ~NumericFormulaMultiplication();
 };
@@ -155,6 +205,7 @@ struct NumericFormulaDivision : public NumericFormulaPair
         : NumericFormulaPair(f, siu, a, b, "DIV", "÷") {}
 
     double calculate(SIUnit to);
+    bool compile(const SIUnit &to);
 
     ~NumericFormulaDivision();
 };
@@ -167,6 +218,7 @@ struct NumericFormulaExponentiation : public NumericFormulaPair
         : NumericFormulaPair(f, siu, a, b, "EXP", "^") {}
 
     double calculate(SIUnit to);
+    bool compile(const SIUnit &to);
 
     ~NumericFormulaExponentiation();
 };
@@ -178,6 +230,8 @@ struct NumericFormulaSquareRoot : public NumericFormula
         : NumericFormula(f, siu), inner_(std::move(inner)) {}
 
     double calculate(SIUnit to);
+    bool compile(const SIUnit &to);
+    bool isConstant() { return inner_->isConstant(); }
     std::string str();
     std::string tree();
 
@@ -236,6 +290,7 @@ struct FormulaImplementation : public Formula
     SIUnit &siUnit();
     void setMeter(Meter *m);
     void setDVEntry(DVEntry *dve);
+    bool readsMeterFields() { return reads_meter_fields_; }
 
     // Pushes a constant on the formula builder stack.
     void doConstant(Unit u, double c);
@@ -301,18 +356,41 @@ struct FormulaImplementation : public Formula
     NumericFormula *topOp();
     NumericFormula *top2Op();
 
+    // Compile the tree into bytecode that calculates into the to unit for the current meter.
+    void compile(Unit to);
+    // Emit the bytecode for a node, constant nodes are folded into a single push.
+    bool compileNode(NumericFormula *nf, const SIUnit &to);
+    // Emit the bytecode for an addition or subtraction, the unit checks of mathOpTo are resolved here.
+    bool compileMathOp(MathOp op, NumericFormula *left, NumericFormula *right, const SIUnit &to);
+    // Append an instruction that changes the stack depth with delta.
+    void emit(const FormulaInstruction &fi, int delta);
+    void emitPush(double c);
+    // Emit the convertTo from one unit to another, a conversion of a pushed constant is folded.
+    void emitConversion(const SIUnit &from, const SIUnit &to);
+    // Run the compiled bytecode.
+    double execute();
+
     Meter *meter() { return meter_; }
     DVEntry *dventry() { return dventry_; }
 
 private:
 
     bool valid_ = true;
+    bool reads_meter_fields_ = false;
     std::vector<std::unique_ptr<NumericFormula>> op_stack_;
     std::vector<Token> tokens_;
     std::string formula_; // To be parsed.
     Meter *meter_; // To be referenced when parsing and calculating.
     DVEntry *dventry_; // To be referenced when calculating.
 
+    // The bytecode is compiled for a target unit and meter on the first calculate.
+    std::vector<FormulaInstruction> program_;
+    bool program_ok_ = false;
+    Unit program_unit_ = Unit::Unknown;
+    Meter *program_meter_ = NULL;
+    int program_depth_ = 0;
+    int program_max_depth_ = 0;
+
     // Any errors during parsing are store here.
     std::vector<std::string> errors_;
 };
@@ -323,6 +401,7 @@ struct StringInterpolatorImplementation : public StringInterpolator
     // Which for a dventry with storage 13 will "generate historic_1_value"
     bool parse(Meter *m, const std::string &f);
     std::string apply(Meter *m, DVEntry *dve);
+    bool dependsOnlyOnCounters();
     ~StringInterpolatorImplementation();
 
     // The std::strings store "historic_" "_value"
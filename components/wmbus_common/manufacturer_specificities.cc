@@ -162,53 +162,77 @@ void transformDiehlAddress (std::vector<uchar>& frame, DiehlAddressTransformMeth
     }
 }
 
+// Diehl: advance the LFSR by one bit
+// https://en.wikipedia.org/wiki/Linear-feedback_shift_register
+static constexpr uint32_t diehlLfsrStep(uint32_t key)
+{
+    // calculate new bit value (xor of selected bits from previous key)
+    uint32_t bit = ((key >> 1) ^ (key >> 2) ^ (key >> 11) ^ (key >> 31)) & 1;
+    // shift key bits and add new one at the end
+    return (key << 1) | bit;
+}
+
+// Diehl: the 8 bits shifted in by 8 LFSR steps only depend on key bits 0-11 and
+// 24-31, and linearly so. They are looked up for key bits 24-31, 4-11 and 0-3.
+struct DiehlLfsrTables
+{
+    uchar high[256];
+    uchar mid[256];
+    uchar low[16];
+};
+
+static constexpr uchar diehlLfsrNextByte(uint32_t key)
+{
+    for (int j = 0; j < 8; ++j) key = diehlLfsrStep(key);
+    return key & 0xFF;
+}
+
+static constexpr DiehlLfsrTables makeDiehlLfsrTables()
+{
+    DiehlLfsrTables t {};
+    for (uint32_t v = 0; v < 256; ++v)
+    {
+        t.high[v] = diehlLfsrNextByte(v << 24);
+        t.mid[v] = diehlLfsrNextByte(v << 4);
+        if (v < 16) t.low[v] = diehlLfsrNextByte(v);
+    }
+    return t;
+}
+
+static constexpr DiehlLfsrTables diehl_lfsr_tables = makeDiehlLfsrTables();
+
 // Diehl: decode LFSR encrypted data used in Izar/PRIOS and Sharky meters
-std::vector<uchar> decodeDiehlLfsr(const std::vector<uchar> &origin, const std::vector<uchar> &frame, uint32_t key, DiehlLfsrCheckMethod check_method, uint32_t check_value)
+bool decodeDiehlLfsr(const std::vector<uchar> &origin, const std::vector<uchar> &frame, uint32_t key, DiehlLfsrCheckMethod check_method, uint32_t check_value, uchar *out)
 {
+    if (frame.size() <= 15) return false;
+
     // modify seed key with header values
     key ^= uint32FromBytes(origin, 2); // manufacturer + address[0-1]
     key ^= uint32FromBytes(origin, 6); // address[2-3] + version + type
     key ^= uint32FromBytes(frame, 10); // ci + some more bytes from the telegram...
 
-    int size = frame.size() - 15;
-    std::vector<uchar> decoded(size);
-
-    for (int i = 0; i < size; ++i) {
-        // calculate new key (LFSR)
-        // https://en.wikipedia.org/wiki/Linear-feedback_shift_register
-        for (int j = 0; j < 8; ++j) {
-            // calculate new bit value (xor of selected bits from previous key)
-            uchar bit = ((key & 0x2) != 0) ^ ((key & 0x4) != 0) ^ ((key & 0x800) != 0) ^ ((key & 0x80000000) != 0);
-            // shift key bits and add new one at the end
-            key = (key << 1) | bit;
-        }
+    size_t size = frame.size() - 15;
+    const uchar *in = &frame[15];
+    uint32_t checksum = 0;
+
+    for (size_t i = 0; i < size; ++i) {
+        // calculate new key, 8 LFSR steps at once
+        uchar next = diehl_lfsr_tables.high[key >> 24] ^ diehl_lfsr_tables.mid[(key >> 4) & 0xFF] ^ diehl_lfsr_tables.low[key & 0xF];
+        key = (key << 8) | next;
         // decode i-th content byte with fresh/last 8-bits of key
-        decoded[i] = frame[i + 15] ^ (key & 0xFF);
+        out[i] = in[i] ^ next;
 
-        if (check_method == DiehlLfsrCheckMethod::HEADER_1_BYTE)
-        {
-            // check-byte doesn't match?
-            if (decoded[0] != 0x4B) {
-                decoded.clear();
-                return decoded;
-            }
-        }
-        else if (check_method == DiehlLfsrCheckMethod::CHECKSUM_AND_0XEF)
-        {
-            if (i == size - 1) {
-                uint32_t checksum = 0;
-                for (int index = 0; index < size; index++) {
-                    checksum += (decoded[index] & 0xFF);
-                }
-                if ((checksum & 0xEF) != check_value) {
-                    decoded.clear();
-                    return decoded;
-                }
-            }
-        }
+        // check-byte doesn't match?
+        if (check_method == DiehlLfsrCheckMethod::HEADER_1_BYTE && i == 0 && out[0] != check_value) return false;
+        checksum += out[i];
     }
 
-    return decoded;
+    if (check_method == DiehlLfsrCheckMethod::CHECKSUM_AND_0XEF)
+    {
+        if ((checksum & 0xEF) != check_value) return false;
+    }
+
+    return true;
 }
 
 uint32_t uint32FromBytes(const std::vector<uchar> &data, int offset, bool reverse)
@@ -283,14 +307,15 @@ bool decryptDielhRealData(Telegram *t, std::vector<uchar> &frame, std::vector<uc
     std::vector<uint32_t> keys;
     initializeDiehlDefaultKeySupport(confidentiality_key, keys);
 
-    std::vector<uchar> decoded_content;
+    std::vector<uchar> decoded_content(frame.size() > 15 ? frame.size() - 15 : 0);
+    bool decoded = false;
     for (auto& key : keys) {
-        decoded_content = decodeDiehlLfsr(t->original.empty() ? frame : t->original, frame, key, DiehlLfsrCheckMethod::CHECKSUM_AND_0XEF, frame[14] & 0xEF);
-        if (!decoded_content.empty())
+        decoded = decodeDiehlLfsr(t->original.empty() ? frame : t->original, frame, key, DiehlLfsrCheckMethod::CHECKSUM_AND_0XEF, frame[14] & 0xEF, safeButUnsafeVectorPtr(decoded_content));
+        if (decoded)
             break;
     }
 
-    if (decoded_content.empty())
+    if (!decoded)
     {
         if (!t->isSimulated() && t->parserWarns())
         {
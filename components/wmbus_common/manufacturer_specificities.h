@@ -39,7 +39,9 @@ enum class DiehlLfsrCheckMethod {
 };
 
 // Diehl: decode LFSR encrypted data used in Izar/PRIOS and Sharky meters
-std::vector<uchar> decodeDiehlLfsr(const std::vector<uchar> &origin, const std::vector<uchar> &frame, uint32_t key, DiehlLfsrCheckMethod check_method, uint32_t check_value);
+// The frame content from offset 15 is decoded into out, which must have room for
+// frame.size()-15 bytes. Returns false if the decoded data does not pass the check.
+bool decodeDiehlLfsr(const std::vector<uchar> &origin, const std::vector<uchar> &frame, uint32_t key, DiehlLfsrCheckMethod check_method, uint32_t check_value, uchar *out);
 
 // Diehl: frame interpretation
 enum class DiehlFrameInterpretation {
@@ -0,0 +1,1380 @@
+// Generated by scripts/generate_manufacturer_table.py from manufacturers.h, do not edit.
+#ifndef MANUFACTURER_TABLE_H
+#define MANUFACTURER_TABLE_H
+
+#include <stdint.h>
+
+#define MANUFACTURER_TABLE_SOURCE_ENTRIES 1331
+
+struct ManufacturerEntry
+{
+    uint16_t m_field;
+    const char *name;
+};
+
+static const uint16_t manufacturer_seeds_[332] =
+{
+    15, 44, 46, 231, 206, 10, 23, 13, 8, 42, 6, 12,
+    16, 168, 7, 37, 1, 2, 81, 1, 79, 65, 53, 0,
+    69, 17, 2, 46, 50, 2, 1, 56, 613, 119, 144, 145,
+    129, 19, 146, 14, 845, 55, 1, 41, 432, 23, 10, 67,
+    9, 4, 13, 662, 113, 21, 290, 39, 16, 180, 81, 285,
+    1, 197, 1, 239, 5, 127, 100, 32, 30, 100, 1, 113,
+    54, 1, 5, 7, 102, 14, 15, 12, 62, 140, 227, 7,
+    54, 59, 57, 17, 242, 7, 11, 72, 362, 41, 196, 19,
+    51, 64, 1043, 127, 251, 115, 2, 63, 4, 5, 38, 628,
+    112, 851, 168, 758, 84, 1, 76, 463, 283, 1, 101, 1536,
+    310, 6, 360, 171, 3, 0, 206, 167, 0, 45, 0, 574,
+    16, 31, 76, 1, 546, 265, 26, 8, 6, 53, 322, 4,
+    2, 24, 91, 5, 45, 12, 2, 996, 295, 155, 25, 0,
+    4, 122, 1, 2, 156, 126, 32, 6, 139, 4, 146, 86,
+    37, 157, 51, 5, 100, 109, 690, 111, 11, 97, 9, 264,
+    136, 8, 28, 6, 5, 108, 21, 14, 1523, 91, 337, 55,
+    39, 262, 1670, 1, 6, 343, 27, 11, 361, 1, 34, 1,
+    196, 95, 129, 2, 119, 298, 7, 173, 363, 1414, 49, 617,
+    165, 7, 102, 91, 76, 147, 8, 1014, 747, 395, 1298, 23,
+    316, 279, 22, 743, 16, 1550, 1, 998, 4, 148, 266, 128,
+    9, 34, 89, 476, 0, 1, 32, 148, 8, 4843, 101, 13,
+    1699, 1, 528, 15, 1, 18, 57, 79, 27, 6, 248, 158,
+    1, 4328, 850, 1, 64, 7, 205, 22, 253, 3395, 1544, 20,
+    4, 2450, 18, 44, 6629, 423, 1, 14, 1, 70, 414, 86,
+    65, 22, 472, 1519, 37, 2904, 7364, 32, 916, 55, 6213, 154,
+    231, 92, 0, 39, 89, 572, 84, 35, 5, 5, 452, 2,
+    5, 65, 480, 1417, 982, 90, 1699, 1539, 888, 50, 1599, 517,
+    1009, 31, 38, 3, 353, 42, 8, 56,
+};
+
+static const ManufacturerEntry manufacturer_table_[1329] =
+{
+    { 0x1e0d, "Gram Power, India" }, // GPM
+    { 0x418c, "POLL, Czech Republic" }, // PLL
+    { 0x0667, "Meter technology Company, Saudi Arabia" }, // ASG
+    { 0x40a1, "PEA J V Company, Ecuador" }, // PEA
+    { 0x1649, "Easun Reyrolle, India" }, // ERI
+    { 0x3ca5, "ONUR Elektrik ve Elektronik, Turkey" }, // OEE
+    { 0x41c3, "PNC Technology, South Korea" }, // PNC
+    { 0x4caf, "SENSOCO Greatech, Germany" }, // SEO
+    { 0x5cac, "WELLTECH automation, China" }, // WEL
+    { 0x2689, "ITRON Asia, Indonesia" }, // ITI
+    { 0x0959, "Beijing JOYO smart water meter, China" }, // BJY
+    { 0x628d, "Suntront Tech, China" }, // XTM
+    { 0x2b33, "Beijing Jingyuan instrument company, China" }, // JYS
+    { 0x1d2c, "Genus Innovations, India" }, // GIL
+    { 0x1734, "Enerlyt Potsdam" }, // EYT
+    { 0x0523, "Avastu Creations, India" }, // AIC
+    { 0x0dee, "Conlog" }, // CON
+    { 0x3265, "Landis Staefa electronic" }, // LSE
+    { 0x4df4, "Sotronix, Germany" }, // SOT
+    { 0x3d89, "Olivetti, Italy" }, // OLI
+    { 0x1ca3, "GEC Meters" }, // GEC
+    { 0x235a, "Huizhou Zhongcheng Electronic Technology, China" }, // HZZ
+    { 0x098d, "BELIMO Automation, Switzerland" }, // BLM
+    { 0x0643, "Arcelik, Turkey" }, // ARC
+    { 0x3523, "Microtronics Engineering, Austria" }, // MIC
+    { 0x14f7, "Enermess Energie Mess und Servicedienste, Germany" }, // EGW
+    { 0x3438, "MAXMET, South Korea" }, // MAX
+    { 0x3453, "MBS, Germany" }, // MBS
+    { 0x48b3, "Renesas Electronics, Singapore" }, // RES
+    { 0x30e3, "Landis Gyr Equipamentos de Medicaoa Brasil, Brazil" }, // LGC
+    { 0x052d, "Ningbo Aimei Meter Manufacture, China" }, // AIM
+    { 0x166f, "Monosan Monofaze Elektrik Motorlari, Turkey" }, // ESO
+    { 0x0468, "Acantho, Italy" }, // ACH
+    { 0x4303, "Phoenix Contact, Germany" }, // PXC
+    { 0x4e03, "JSC RPC Spektr, Russian Federation" }, // SPC
+    { 0x21c4, "Shenzhen Hemei Group, China" }, // HND
+    { 0x0709, "UAB Axis Industries, Lithuania" }, // AXI
+    { 0x2c21, "Kamstrup, Denmark" }, // KAA
+    { 0x0c2c, "Caleffi, Italy" }, // CAL
+    { 0x3733, "MODEMSYS, Spain" }, // MYS
+    { 0x15c4, "ENDYS" }, // END
+    { 0x2dd8, "KONNEX based users Siemens Regensburg" }, // KNX
+    { 0x06b4, "Aiut, Poland" }, // AUT
+    { 0x04a5, "Atlas Electronics, Serbia" }, // AEE
+    { 0x4db4, "Smarteh, Slovenia" }, // SMT
+    { 0x1c36, "Carlo Gavazzi Controls, Italy" }, // GAV
+    { 0x4e8f, "ABB STOTZ KONTAKT, Germany" }, // STO
+    { 0x168b, "ELTEK BROJILA, Croatia" }, // ETK
+    { 0x3029, "Hangzhou LAISON Technology, China" }, // LAI
+    { 0x3023, "Heinz Lackmann, Germany" }, // LAC
+    { 0x09a9, "Badger Meter, United States of America" }, // BMI
+    { 0x41b3, "PMS Elektronik, Germany" }, // PMS
+    { 0x25d6, "Sensus Metering Systems, Germany" }, // INV
+    { 0x49b4, "Richter Messtechnik, Germany" }, // RMT
+    { 0x2d8b, "Kerlink, France" }, // KLK
+    { 0x5df7, "Sciknow Techno Solutions, India" }, // WOW
+    { 0x5199, "LLC SPE Telemetry, Ukraine" }, // TLY
+    { 0x4dec, "Soledia, Italy" }, // SOL
+    { 0x060c, "APLI, Slovakia" }, // APL
+    { 0x0d81, "3g celllabs, India" }, // CLA
+    { 0x2125, "Shenzhen Holley South Electronics Technology, China" }, // HIE
+    { 0x5292, "Tetraedre, Switzerland" }, // TTR
+    { 0x0d32, "Circutor, Spain" }, // CIR
+    { 0x15a2, "Embit, Italy" }, // EMB
+    { 0x35a9, "MyMeterInfo, France" }, // MMI
+    { 0x418f, "Weihai Ploumeter, China" }, // PLO
+    { 0x0db0, "CM Partner, South Korea" }, // CMP
+    { 0x2545, "ILJIN Electric, South Korea" }, // IJE
+    { 0x5194, "Telecommunication Technologies, Ukraine" }, // TLT
+    { 0x2e4f, "Kromschroder" }, // KRO
+    { 0x12fa, "Lorenz, Germany" }, // DWZ
+    { 0x35b4, "METMOTEC, United Kingdom" }, // MMT
+    { 0x5a65, "Valenciana Smart Energy of Mediterranean Sea, Spain" }, // VSE
+    { 0x14a3, "ESCO, Poland" }, // EEC
+    { 0x2669, "Akcionarsko Drustvo Insa Industrija Satova, Serbia" }, // ISI
+    { 0x164c, "Erelsan Elektrik ve Elektronik, Turkey" }, // ERL
+    { 0x15d4, "ENTES Elektronik, Turkey" }, // ENT
+    { 0x048e, "Aidon, Finland" }, // ADN
+    { 0x6830, "Zaptronix" }, // ZAP
+    { 0x0de8, "COHEAT Future Business Centre, United Kingdom" }, // COH
+    { 0x15cf, "ennovatis, Germany" }, // ENO
+    { 0x488d, "RDMx Consulting, Brazil" }, // RDM
+    { 0x1594, "ELTAKO, Germany" }, // ELT
+    { 0x3085, "Shenzhen Londian Electrics, China" }, // LDE
+    { 0x0474, "Activis Metering, Germany" }, // ACT
+    { 0x64c3, "Yufeng Changhui Automation Instrument, China" }, // YFC
+    { 0x0995, "Bluering, Italy" }, // BLU
+    { 0x30ad, "LEM HEME, United Kingdom" }, // LEM
+    { 0x19ad, "F IMM, Italy" }, // FMM
+    { 0x19d8, "Flownetix, United Kingdom" }, // FNX
+    { 0x50c3, "Toos Fuse, Iran" }, // TFC
+    { 0x0cb4, "Cetinkaya Aydinlatma, Turkey" }, // CET
+    { 0x3e8d, "OTMetric, France" }, // OTM
+    { 0x482d, "Rossweiner Armaturen und Messgeraete OHG, Germany" }, // RAM
+    { 0x6ac3, "SigmaHeat" }, // ZVC
+    { 0x4ef4, "Beijing Swirling Technology, China" }, // SWT
+    { 0x34ac, "Mikroelektronika a d, Bosnia and Herzegovina" }, // MEL
+    { 0x34a5, "Metron Europe, France" }, // MEE
+    { 0x4d27, "Sigrenea, France" }, // SIG
+    { 0x34b3, "Electrometer U, Spain" }, // MES
+    { 0x3943, "NAMJUN, South Korea" }, // NJC
+    { 0x503a, "PoyeshGaran Sahandzaran Tabrizazma, Iran" }, // TAZ
+    { 0x38b2, "Nero Electronics, Belarus" }, // NER
+    { 0x1c4a, "Grundfoss" }, // GBJ
+    { 0x61b8, "Xemex, Belgium" }, // XMX
+    { 0x10c5, "Dongfang Electronics, China" }, // DFE
+    { 0x42ac, "NPP Teplovodokhran" }, // PUL
+    { 0x20cc, "HFIL Technologies" }, // HFL
+    { 0x25d4, "Infranet Technologies, Germany" }, // INT
+    { 0x4dad, "Smart Metering, Italy" }, // SMM
+    { 0x2445, "IBOT ENERGY SYSTEMS, India" }, // IBE
+    { 0x3134, "Punos Electronic, Sweden" }, // LIT
+    { 0x2447, "ITI BANGALORE PLANT, India" }, // IBG
+    { 0x0442, "ABB, Sweden" }, // ABB
+    { 0x2685, "ITRON Electricity, France" }, // ITE
+    { 0x54a9, "United Electrical Industries, India" }, // UEI
+    { 0x4a61, "Rahrovan Sepehr Andisheh" }, // RSA
+    { 0x5c2c, "Wallaby Metering Systems, India" }, // WAL
+    { 0x4dd2, "NTN SNR, France" }, // SNR
+    { 0x38b4, "Netatmo, France" }, // NET
+    { 0x0e07, "CentraPlus, Germany" }, // CPG
+    { 0x40b0, "POWRTEC ENERGY, India" }, // PEP
+    { 0x2317, "Hangzhou Xili Watthour Meter Manufacture, China" }, // HXW
+    { 0x0e58, "Corinex Communications, Canada" }, // CRX
+    { 0x0657, "Arrow Electronics, India" }, // ARW
+    { 0x20b7, "Honeywell Integrated Technology, China" }, // HEW
+    { 0x1243, "DURECOM, South Korea" }, // DRC
+    { 0x10b6, "Develco Products, Denmark" }, // DEV
+    { 0x592b, "VI KO ELEKTRIK, Turkey" }, // VIK
+    { 0x06b2, "Aurum Europe, Netherlands" }, // AUR
+    { 0x30e4, "Landis Gyr, Germany" }, // LGD
+    { 0x2977, "QingdaoJakewill Energy Technology, China" }, // JKW
+    { 0x36ab, "Meters UK Whitegate White Lund Trading Estate, United Kingdom" }, // MUK
+    { 0x1a70, "Finmek Space, Italy" }, // FSP
+    { 0x266f, "Isoil Industria, Italy" }, // ISO
+    { 0x25c3, "Incotex, Russian Federation" }, // INC
+    { 0x1a43, "Friendcom Technology" }, // FRC
+    { 0x54f4, "DP UKRGAZTECH Ukrainian gas technologies, Ukraine" }, // UGT
+    { 0x3e14, "Optec, Switzerland" }, // OPT
+    { 0x4ecd, "AB Svensk Vaermemaetning SVM" }, // SVM
+    { 0x5e72, "WESER, Russian Federation" }, // WSR
+    { 0x21e5, "HOENTZSCH, Germany" }, // HOE
+    { 0x39f6, "NovaTech, United States of America" }, // NOV
+    { 0x4e0c, "Sappel" }, // SPL
+    { 0x2693, "ITRON Australasia, Australia" }, // ITS
+    { 0x2524, "PT INDUSTRI TELEKOMUNIKASI Persero, Indonesia" }, // IID
+    { 0x21b5, "Hugo Muller, Germany" }, // HMU
+    { 0x50a1, "TEAM R" }, // TEA
+    { 0x266b, "Iskraemeco, Slovenia" }, // ISK
+    { 0x30b3, "Lakshmi Electrical Control Systems, India" }, // LES
+    { 0x4d98, "Ymatron, Switzerland" }, // SLX
+    { 0x3533, "Iskra MIS, Slovenia" }, // MIS
+    { 0x4d14, "Shitek Technology, Italy" }, // SHT
+    { 0x4c2d, "Siemens OEsterreich AMIS Automated Metering and Information System, Austria" }, // SAM
+    { 0x50b0, "TEPEECAL, France" }, // TEP
+    { 0x2e79, "KUNDO SystemTechnik, Germany" }, // KSY
+    { 0x25ce, "INNEXIV, United States of America" }, // INN
+    { 0x0e6c, "Comsel System, Finland" }, // CSL
+    { 0x05a7, "ANTE METER GROUP, China" }, // AMG
+    { 0x518d, "Theodor Lange Messgeraete, Germany" }, // TLM
+    { 0x4d05, "Shenzhen SingHang Elec tech, China" }, // SHE
+    { 0x1cb0, "GEPDEC INFRATECH" }, // GEP
+    { 0x39a7, "NMG, Poland" }, // NMG
+    { 0x2c23, ", Russian Federation" }, // KAC
+    { 0x4241, "Paya Ravesh Aria" }, // PRA
+    { 0x3833, "NAS Instruments OU, Estonia" }, // NAS
+    { 0x1de5, "Genus Power Infrastructures, India" }, // GOE
+    { 0x5256, "Transvaro Elektron Aletleri, Turkey" }, // TRV
+    { 0x412d, "Power Innovation, Germany" }, // PIM
+    { 0x4c8d, "Shandong Delu Measurement, China" }, // SDM
+    { 0x192e, "Finder, Germany" }, // FIN
+    { 0x2645, "IREN Energia, Italy" }, // IRE
+    { 0x5ca2, "Webolution, Germany" }, // WEB
+    { 0x41a7, "Sensus Metering Systems, Germany" }, // PMG
+    { 0x5a0c, "Verticross, India" }, // VPL
+    { 0x15ac, "Emlite, United Kingdom" }, // EML
+    { 0x14b0, "ELECTRONET EQUIPMENT, India" }, // EEP
+    { 0x4c65, "Seo Chang Electric Communication, South Korea" }, // SCE
+    { 0x1dd0, "GEPDEC ENERGY, India" }, // GNP
+    { 0x3da7, "Open Metering System Group OMS Group e V" }, // OMG
+    { 0x5dd7, "Wistron NeWeb Corporation Marketing Center, Taiwan" }, // WNW
+    { 0x2674, "Ista" }, // IST
+    { 0x38f0, "Ngenic, Poland" }, // NGP
+    { 0x5e8d, "Watertech, Italy" }, // WTM
+    { 0x1ab3, "Fuccesso, China" }, // FUS
+    { 0x40ac, "Pak Elektron PEL, Pakistan" }, // PEL
+    { 0x31e7, "LOGAREX Smart Metering, Czech Republic" }, // LOG
+    { 0x1179, "Electric Power Research Institute of Guangdong Power Grid Corporation, China" }, // DKY
+    { 0x3aed, "Ningbo Water Meter, China" }, // NWM
+    { 0x1e44, "Greenradio" }, // GRD
+    { 0x3601, "Mega Power Automation International, Hong Kong" }, // MPA
+    { 0x3a8d, "Netinium, Netherlands" }, // NTM
+    { 0x6b14, "Zhejiang Xinghao Technology" }, // ZXT
+    { 0x24ae, "Institute of Power Engineering, Poland" }, // IEN
+    { 0x1667, "ESG, South Korea" }, // ESG
+    { 0x5257, "Triowatt" }, // TRW
+    { 0x20b2, "Hermes Systems, Australia" }, // HER
+    { 0x0832, "Baer Industrie Elektronik, Germany" }, // BAR
+    { 0x10e9, "Digi International" }, // DGI
+    { 0x4195, "Plutus Smart Energy Solutions, India" }, // PLU
+    { 0x166e, "Zhejiang Eastron Electronic, China" }, // ESN
+    { 0x25c4, "INDRA SISTEMAS, Spain" }, // IND
+    { 0x0d13, "Smart Services International, Switzerland" }, // CHS
+    { 0x68ac, "Dr techn Josef Zelisko, Austria" }, // ZEL
+    { 0x5689, "Utilia, Italy" }, // UTI
+    { 0x5d2e, "Windmill Innovations, Netherlands" }, // WIN
+    { 0x4e92, "Strike Technologies, South Africa" }, // STR
+    { 0x1c65, "Genergica, Venezuela" }, // GCE
+    { 0x2692, "Itron" }, // ITR
+    { 0x6868, "Zhejiang Chaorong Electric Technology, China" }, // ZCH
+    { 0x2098, "Beijing TianRuiXiangDe Measuring Technology, China" }, // HDX
+    { 0x2af2, "Shandong jingwei telecommunications equipment, China" }, // JWR
+    { 0x6737, "Shandong youyuan instrument, China" }, // YYW
+    { 0x392b, "NIK ELEKTRONIKA, Ukraine" }, // NIK
+    { 0x0dd5, "CNU Global, South Korea" }, // CNU
+    { 0x068c, "Atlas Elektronik, Turkey" }, // ATL
+    { 0x50ab, "Tekmar Regelsysteme, Germany" }, // TEK
+    { 0x0686, "AKTIF OTOMASYON STI, Turkey" }, // ATF
+    { 0x2c4b, "KBK ELECTRONICS, Pakistan" }, // KBK
+    { 0x2633, "IQ Systems, South Africa" }, // IQS
+    { 0x25d8, "Innolex Engineering, Netherlands" }, // INX
+    { 0x402b, "Paktim Energy Sp zo o, Poland" }, // PAK
+    { 0x3427, "MAGNATECH Smart Grid Solutions, India" }, // MAG
+    { 0x1473, "Herholdt Controls, Italy" }, // ECS
+    { 0x25b4, "INTEGRA METERING, Switzerland" }, // IMT
+    { 0x4d25, "Siemens" }, // SIE
+    { 0x5cb0, "Weptech elektronik, Germany" }, // WEP
+    { 0x044e, "ABN Braun, Germany" }, // ABN
+    { 0x0a0d, "Aadharshila Mobility Solutions, India" }, // BPM
+    { 0x29c3, "NINGBO JIANAN ELECTRONICS, China" }, // JNC
+    { 0x1085, "D D Elettronica, Italy" }, // DDE
+    { 0x34ad, "MEMS, Switzerland" }, // MEM
+    { 0x2da2, "Kamstrup, Denmark" }, // KMB
+    { 0x4026, "FAP PAFAL, Poland" }, // PAF
+    { 0x160c, "Escorts, Pakistan" }, // EPL
+    { 0x52ef, "2Flow, Sweden" }, // TWO
+    { 0x39b3, "Nisko Advanced Metering Solutions, Israel" }, // NMS
+    { 0x2ce5, "Guangzhou Keli General Electric, China" }, // KGE
+    { 0x20b8, "Shenzhen Hexcell Electronics Technology, China" }, // HEX
+    { 0x1985, "XIAN FLAG ELECTRONIC, China" }, // FLE
+    { 0x4839, "Rayleigh Instruments, United Kingdom" }, // RAY
+    { 0x10ae, "Ducati Energia, Italy" }, // DEN
+    { 0x2688, "INTELTEH, Croatia" }, // ITH
+    { 0x0496, "Advant" }, // ADV
+    { 0x28e8, "ITSQUARE, South Korea" }, // JGH
+    { 0x10b3, "Desi Alarms, Turkey" }, // DES
+    { 0x34a8, "Mueller electronic, Germany" }, // MEH
+    { 0x4c2e, "SANN Stockholm, Sweden" }, // SAN
+    { 0x5c24, "Waher Data, Sweden" }, // WAD
+    { 0x3a13, "NEOPIS, South Korea" }, // NPS
+    { 0x2475, "i cube, Switzerland" }, // ICU
+    { 0x3973, "N ERGIE Kundenservice, Germany" }, // NKS
+    { 0x1a8c, "Tritschler, Germany" }, // FTL
+    { 0x4e84, "Stedin, Netherlands" }, // STD
+    { 0x50ae, "TekhnoEnergo, Russian Federation" }, // TEN
+    { 0x14e3, "Ekbatan Gas Control, Iran" }, // EGC
+    { 0x062d, "INTEGRA METERING, Switzerland" }, // AQM
+    { 0x530c, "CETC46 TianJin New Top Electronics Technology, China" }, // TXL
+    { 0x51ba, "TMZ Thuringer Mess und Zaehlerwesen Service, Germany" }, // TMZ
+    { 0x08a5, "Bentec, India" }, // BEE
+    { 0x14d2, "Europaeische Funk Rundsteuerung, Germany" }, // EFR
+    { 0x5cee, "Wasser Geraete, Germany" }, // WGN
+    { 0x064d, "Arivus metering, Germany" }, // ARM
+    { 0x68d9, "Hang Zhou Fu Yang Instrument General Factory, China" }, // ZFY
+    { 0x36f5, "METRONA Union, Germany" }, // MWU
+    { 0x0e91, "Control Q, Netherlands" }, // CTQ
+    { 0x4df3, "SOFTSERVICE, Ukraine" }, // SOS
+    { 0x0635, "Aquamess, Germany" }, // AQU
+    { 0x3072, "ShanDong LiChuang Science and Technology, China" }, // LCR
+    { 0x1525, "Ei Electronics, Ireland" }, // EIE
+    { 0x14e1, "eGain International, Sweden" }, // EGA
+    { 0x1713, "exceeding solutions, Germany" }, // EXS
+    { 0x4cc9, "Siemens Flow Instruments, Denmark" }, // SFI
+    { 0x268b, "Itron, Germany" }, // ITK
+    { 0x31d4, "Schneider Electric, India" }, // LNT
+    { 0x1998, "FLEXIM Flexible Industriemesstechnik, Germany" }, // FLX
+    { 0x5ca7, "WEG Equipamentos Eletricos Automacao, Brazil" }, // WEG
+    { 0x068d, "Atmel SAU, Spain" }, // ATM
+    { 0x5e8c, "Wipro Technologies, India" }, // WTL
+    { 0x1421, "Electronic Afzar Azma, Iran" }, // EAA
+    { 0x4ee9, "Swistec, Germany" }, // SWI
+    { 0x29ca, "JNJ POWERCOM SYSTEMS, India" }, // JNJ
+    { 0x164e, "Ericsson Telecomunicazioni, Italy" }, // ERN
+    { 0x3683, "Metering Technology Corporation" }, // MTC
+    { 0x30e6, "Landis Gyr, Finland" }, // LGF
+    { 0x0495, "Adunos, Germany" }, // ADU
+    { 0x386b, "NC Korea, South Korea" }, // NCK
+    { 0x24d8, "Infineon Technologies, Germany" }, // IFX
+    { 0x524c, "Trilliant, Canada" }, // TRL
+    { 0x5258, "Beijing TianRuiXiang Equipment, China" }, // TRX
+    { 0x22ed, "Beijing Hongwei Chaoda Instrument Manufacturing, China" }, // HWM
+    { 0x1e8d, "G2 misuratori, Italy" }, // GTM
+    { 0x0ca7, "Consolinno Energy, Germany" }, // CEG
+    { 0x0872, "Jiangsu Bingchen Electronics, China" }, // BCR
+    { 0x5070, "Telecard Prilad, Ukraine" }, // TCP
+    { 0x1198, "Delixi Group Instruments Meters, China" }, // DLX
+    { 0x0c24, "CADIS, Belgium" }, // CAD
+    { 0x4cae, "Sensus Metering Systems, Germany" }, // SEN
+    { 0x4e8c, "Saudi Technical Group, Saudi Arabia" }, // STL
+    { 0x0ea3, "Cuculus, Germany" }, // CUC
+    { 0x1987, "FLOMAG, Czech Republic" }, // FLG
+    { 0x0689, "Analogics Tech, India" }, // ATI
+    { 0x6a85, "ZTE Corporation ZTE Plaza, China" }, // ZTE
+    { 0x1c83, "GADICO TECNOLOGIAA" }, // GDC
+    { 0x426e, "PySENSE, Poland" }, // PSN
+    { 0x0485, "Yantai Aerospace Delu Energy saving Technology, China" }, // ADE
+    { 0x3565, "MKEK Genel Mudurlugu Gazi Fisek ELSA, Turkey" }, // MKE
+    { 0x1045, "Decibels Electronics P Decibels Electronics, India" }, // DBE
+    { 0x145a, "eBZ, Germany" }, // EBZ
+    { 0x2aad, "JUMO, Germany" }, // JUM
+    { 0x54e9, "United Gas Industries" }, // UGI
+    { 0x2343, "TANGSHAN HUIZHONG INSTRUMENTATION, China" }, // HZC
+    { 0x4e8d, "STELMEC, India" }, // STM
+    { 0x524a, "SHENZHEN TECHRISE ELECTRONICS, China" }, // TRJ
+    { 0x0d93, "Celsa Messgeraete, Germany" }, // CLS
+    { 0x1664, "Edelstrom Electronic Devices and Designing, United Arab Emirates" }, // ESD
+    { 0x2283, "Horstmann Timers and Controls" }, // HTC
+    { 0x158c, "Energy Plus, Russian Federation" }, // ELL
+    { 0x16b3, "Ebeling und Sohn, Germany" }, // EUS
+    { 0x09f6, "JiaXing Bove Intelligent Technology, China" }, // BOV
+    { 0x370d, "Maxim Integrated Circuit Design, India" }, // MXM
+    { 0x4a6d, "Zhejiang Risesun Science and Technology, China" }, // RSM
+    { 0x18c4, "Fast Forward, Germany" }, // FFD
+    { 0x3325, "Jiangsu Linyang Electronics, China" }, // LYE
+    { 0x6610, "YPP, South Korea" }, // YPP
+    { 0x224d, "Hefei Runa Metering, China" }, // HRM
+    { 0x31b0, "LIN MAN POWER TECHNOLOGY, Philippines" }, // LMP
+    { 0x1ea8, "ShenZhen GuangNing Industrial, China" }, // GUH
+    { 0x1e70, "Ingenieurbuero Gasperowicz" }, // GSP
+    { 0x1a45, "Frer, Italy" }, // FRE
+    { 0x3263, "Lund Science, Sweden" }, // LSC
+    { 0x48b0, "Radiant Energy Solutions, India" }, // REP
+    { 0x1ee6, "Gas u Wassermesserfabrik, Switzerland" }, // GWF
+    { 0x1463, "Energycare Company, Saudi Arabia" }, // ECC
+    { 0x0b52, "Gebr Bauer, Germany" }, // BZR
+    { 0x060f, "APOLIS haftungsbeschraenkt, Germany" }, // APO
+    { 0x290d, "Changzhou Jianhu Intelligentize Meter, China" }, // JHM
+    { 0x05a5, "Avon Meters, India" }, // AME
+    { 0x14e4, "EcoGuard, Sweden" }, // EGD
+    { 0x0473, "Tianjin Chuangshi Technology Developing, China" }, // ACS
+    { 0x5192, "Telereading, Italy" }, // TLR
+    { 0x31b3, "LMS Services, Germany" }, // LMS
+    { 0x40a5, "Prantech Energy Solutions, India" }, // PEE
+    { 0x40e5, "PayGo Energy" }, // PGE
+    { 0x15a6, "IT Beratung Energiemanagement Flammang, Germany" }, // EMF
+    { 0x082d, "Bachmann, Germany" }, // BAM
+    { 0x046c, "Aclara Meters UK, United Kingdom" }, // ACL
+    { 0x2dc9, "zhangzhou keneng electrical equipment, China" }, // KNI
+    { 0x10f9, "Discovergy, Germany" }, // DGY
+    { 0x64ed, "YGM Shandong Yiguang heat metering technology, China" }, // YGM
+    { 0x5d27, "Wigersma Sikkema, Netherlands" }, // WIG
+    { 0x0693, "Atlas Sayac Sanayi, Turkey" }, // ATS
+    { 0x4db0, "LLC FIRM SEMPAL, Ukraine" }, // SMP
+    { 0x4e93, "Swistec Systems, Switzerland" }, // STS
+    { 0x2f4b, "KRIZIK, Czech Republic" }, // KZK
+    { 0x4ca5, "El Sewedy Electrometer, Egypt" }, // SEE
+    { 0x14ce, "EFEN, Germany" }, // EFN
+    { 0x25c9, "Altero, Sweden" }, // INI
+    { 0x4d2a, "SUN STAR INDUSTRIES, India" }, // SIJ
+    { 0x0612, "Apronecs, Bulgaria" }, // APR
+    { 0x20a7, "Hamburger Elektronik Gesellschaft" }, // HEG
+    { 0x4c34, "SATEC, Israel" }, // SAT
+    { 0x4c93, "Sitec Elettronica industriale, Italy" }, // SDS
+    { 0x30e1, "Landis Gyr" }, // LGA
+    { 0x3692, "METER, Russian Federation" }, // MTR
+    { 0x4c72, "Sanchuan Wisdom Technology, China" }, // SCR
+    { 0x1265, "Digitech Systems and Engineering, India" }, // DSE
+    { 0x0d0d, "Chung Hsin Electric and Machinery Manufacturing, Taiwan" }, // CHM
+    { 0x3a4d, "Norm Elektronik, Turkey" }, // NRM
+    { 0x0a78, "BS Messtechnik, Germany" }, // BSX
+    { 0x0d82, "CMC, Italy" }, // CLB
+    { 0x35f4, "The Motwane Manufacturing Company, India" }, // MOT
+    { 0x3150, "Lars Jansen Productions, Netherlands" }, // LJP
+    { 0x0b03, "Beijing Fuxing Xiao Cheng Electronic Technology Stock Xisanhuan Beilu, China" }, // BXC
+    { 0x2901, "Zhejiang JiaHe Instrument, China" }, // JHA
+    { 0x4cad, "Smart Meter Company, Myanmar" }, // SEM
+    { 0x0e54, "CRDM Technology, France" }, // CRT
+    { 0x16e1, "EWATTCH, France" }, // EWA
+    { 0x1670, "EFICAA ENSMART SOLUTIONS, India" }, // ESP
+    { 0x1db3, "Gity Madara Sepahan, Iran" }, // GMS
+    { 0x214d, "Huaihua Jiannan Machinery Factory, China" }, // HJM
+    { 0x1663, "EDMI Shenzhen, China" }, // ESC
+    { 0x146c, "Electronics Corporation of, India" }, // ECL
+    { 0x5124, "TIDE, South Korea" }, // TID
+    { 0x5925, "Vientech, France" }, // VIE
+    { 0x0594, "Amplitec, Germany" }, // ALT
+    { 0x6292, "HENAN SUNTRONT TECH, China" }, // XTR
+    { 0x35ad, "MATRICA" }, // MMM
+    { 0x1dd9, "JiangSu GuoNeng Instrument Technology, China" }, // GNY
+    { 0x246b, "I C Technology, South Korea" }, // ICK
+    { 0x50a3, "TECSON Digital, Germany" }, // TEC
+    { 0x2e54, "Karat, Russian Federation" }, // KRT
+    { 0x5890, "Plant Vodopribor management company, Russian Federation" }, // VDP
+    { 0x3a83, "Nuri Telecom, South Korea" }, // NTC
+    { 0x3e42, "ORBIS Tecnologia Electrica, Spain" }, // ORB
+    { 0x2324, "Hydrometer" }, // HYD
+    { 0x0481, "Andrea Informatique, France" }, // ADA
+    { 0x5cf0, "GreenPoint, Poland" }, // WGP
+    { 0x614d, "XJ Metering, China" }, // XJM
+    { 0x220d, "HANGZHOU HPM COMPANY, China" }, // HPM
+    { 0x4e85, "Satera Elektrik Elektronik San ve Tic" }, // STE
+    { 0x2d4e, "Radniroo Industrial" }, // KJN
+    { 0x3498, "mdex, Germany" }, // MDX
+    { 0x1993, "FLASH o s, Turkey" }, // FLS
+    { 0x1cae, "Goerlitz" }, // GEN
+    { 0x3e4d, "Ormazabal, Spain" }, // ORM
+    { 0x0601, "Apator, Poland" }, // APA
+    { 0x524e, "TERRANOVA, Italy" }, // TRN
+    { 0x16f4, "Elin Wasserwerkstechnik" }, // EWT
+    { 0x368c, "Advance Metering technology, India" }, // MTL
+    { 0x3886, "NUCLEO DURO FELGUERA, Spain" }, // NDF
+    { 0x2274, "HST Equipamentos Electronicosa" }, // HST
+    { 0x4664, "Quicksand, Belgium" }, // QSD
+    { 0x48a3, "Zhejiang Reallin Electron, China" }, // REC
+    { 0x12c7, "Device, Germany" }, // DVG
+    { 0x368e, "Merytronic, Spain" }, // MTN
+    { 0x12a1, "DLMS User Association, Switzerland" }, // DUA
+    { 0x20ad, "Hokkaido Electric Meter Industry, Japan" }, // HEM
+    { 0x4d97, "SOLID WAY SAS, France" }, // SLW
+    { 0x0c8c, "Customised Data, United Kingdom" }, // CDL
+    { 0x046e, "ACN Advanced Communications Networks, Switzerland" }, // ACN
+    { 0x1a79, "FlowService, Poland" }, // FSY
+    { 0x0c49, "Circuit Breaker Industries, South Africa" }, // CBI
+    { 0x0e0f, "C3PO, Spain" }, // CPO
+    { 0x352b, "Mikroklima, Czech Republic" }, // MIK
+    { 0x6b19, "Linyi City Xiaoyuan Water Meter, China" }, // ZXY
+    { 0x166d, "Monosan Monofaze Elektrik Motorlari, Turkey" }, // ESM
+    { 0x5034, "Tatung, Taiwan" }, // TAT
+    { 0x2682, "Itron Solucoes para Energia e Aguaa, Brazil" }, // ITB
+    { 0x5dc3, "wireless netcontrol, Germany" }, // WNC
+    { 0x4c6c, "Steama Company" }, // SCL
+    { 0x41f7, "PowerApp, Denmark" }, // POW
+    { 0x2304, "Beijing HongHaoXingDa Meters, China" }, // HXD
+    { 0x0e70, "CSP Innovazione nelle ICT, Italy" }, // CSP
+    { 0x5243, "Traco Doo, Serbia" }, // TRC
+    { 0x0674, "ASTINCO, Canada" }, // AST
+    { 0x4e81, "Shenzhen Star Instrument, China" }, // STA
+    { 0x2666, "Investcom Szymon Fiedorowicz, Poland" }, // ISF
+    { 0x3612, "Michael Rac, Germany" }, // MPR
+    { 0x34b4, "METRA Energie Messtechnik, Germany" }, // MET
+    { 0x0cef, "Cavagna Group, Italy" }, // CGO
+    { 0x4e0d, "Stelmec Powercom, India" }, // SPM
+    { 0x41ec, "Pronal sp k, Poland" }, // POL
+    { 0x5138, "Tixi Com" }, // TIX
+    { 0x05c1, "Anacle Systems, Singapore" }, // ANA
+    { 0x6484, "Jilin Yongda Group" }, // YDD
+    { 0x30b4, "LAN ENGINEERING TECHNOLOGIES, India" }, // LET
+    { 0x58ac, "VELANKANI ELECTRONICS, India" }, // VEL
+    { 0x4c21, "Sanjesh Afzar Asia, Iran" }, // SAA
+    { 0x08ae, "BEENIC, Germany" }, // BEN
+    { 0x3690, "Modern Transformers, India" }, // MTP
+    { 0x5193, "TLS Energimaetning, Sweden" }, // TLS
+    { 0x0f2e, "Cynox Weinart Engineering, Germany" }, // CYN
+    { 0x06c1, "Avangard JSC, Russian Federation" }, // AVA
+    { 0x15a9, "Entorno Inteligente de Medicion, Spain" }, // EMI
+    { 0x50a9, "Tohoku Electric Meter Industry, Japan" }, // TEI
+    { 0x04a7, "AEG" }, // AEG
+    { 0x4ca3, "Schneider Electric, Canada" }, // SEC
+    { 0x0586, "Alfatech Elektromed Elektronik, Turkey" }, // ALF
+    { 0x3a4e, "Neuron, Switzerland" }, // NRN
+    { 0x32ae, "LUNA Elektrik Elektronik, Turkey" }, // LUN
+    { 0x0646, "ADEUNIS RF, France" }, // ARF
+    { 0x0c34, "Cubes And Tubes, Finland" }, // CAT
+    { 0x1127, "Digutal Request, Germany" }, // DIG
+    { 0x28a4, "JED, South Korea" }, // JED
+    { 0x6959, "Zhejiang Jiayou Thermal Technology Equipment, China" }, // ZJY
+    { 0x04b2, "Aerzener Maschinenfabrik, Germany" }, // AER
+    { 0x112c, "DECCAN INFRATECH LIMETED, India" }, // DIL
+    { 0x6299, "LianYuanGang Tengyue Electronics Technology" }, // XTY
+    { 0x24b3, "Integrated Electronic Systems Lab, China" }, // IES
+    { 0x326b, "LS Industrial Systems, South Korea" }, // LSK
+    { 0x4259, "ShanDong LiChuang Science and Technology, China" }, // PRY
+    { 0x066d, "Adya Wifi Metering, India" }, // ASM
+    { 0x5078, "Qingdao Topscomm Communication, China" }, // TCX
+    { 0x1679, "EasyMeter" }, // ESY
+    { 0x3591, "MeterLinq, Italy" }, // MLQ
+    { 0x4823, "Michael Rac, Germany" }, // RAC
+    { 0x4335, "PYUNGIL, South Korea" }, // PYU
+    { 0x3832, "NARI Group Corporation NARI Technology Development, China" }, // NAR
+    { 0x2673, "Iskra, Slovenia" }, // ISS
+    { 0x1714, "LOTRIC Metrology, Slovenia" }, // EXT
+    { 0x2d65, "KK Electronic" }, // KKE
+    { 0x668c, "ZheJiang yongtailong electronic, China" }, // YTL
+    { 0x4065, "Precise Electronics, Thailand" }, // PCE
+    { 0x1d98, "Electrical Equipment Joint Stock Corporation, Vietnam" }, // GLX
+    { 0x602f, "Info Solution, Italy" }, // XAO
+    { 0x0e92, "Contar Electronica Industrial, Portugal" }, // CTR
+    { 0x2c48, "K Biesinger, Germany" }, // KBH
+    { 0x20d2, "SAERI HEAT METERING TECHNOLOGY, China" }, // HFR
+    { 0x22f4, "Huawei Technologies, China" }, // HWT
+    { 0x14ed, "Elgama Elektronika, Lithuania" }, // EGM
+    { 0x4e73, "SUEZ SMART SOLUTIONS, France" }, // SSS
+    { 0x208b, "Hydroko, Belgium" }, // HDK
+    { 0x49ac, "ROLEX METERS RPIVATE, India" }, // RML
+    { 0x61a1, "XMASTER, Poland" }, // XMA
+    { 0x04a9, "Ajay Electrical Industries, India" }, // AEI
+    { 0x0e59, "Crystal Power, India" }, // CRY
+    { 0x0907, "Brunata, Denmark" }, // BHG
+    { 0x39a5, "SI ART, Russian Federation" }, // NME
+    { 0x484d, "R B M, Italy" }, // RBM
+    { 0x2ccd, "Shenzhen Kaifa Technology, China" }, // KFM
+    { 0x4e18, "Sensus Metering Systems, Germany" }, // SPX
+    { 0x5cd4, "Waft Embedded Circuit Solutions, India" }, // WFT
+    { 0x2cb2, "KERMS haftungsbeschraenkt, Germany" }, // KER
+    { 0x14c9, "Efimatic Iberica, Spain" }, // EFI
+    { 0x2823, "Jay Autocomponents, India" }, // JAC
+    { 0x4072, "Powercom, Israel" }, // PCR
+    { 0x0462, "AcBel Polytech, Taiwan" }, // ACB
+    { 0x0d94, "Zhuhai S E Z Calintech Electric, China" }, // CLT
+    { 0x15b2, "CJSC Energomera, Russian Federation" }, // EMR
+    { 0x2d27, "Kiwigrid Kleiststrasse, Germany" }, // KIG
+    { 0x4693, "QT systems, Sweden" }, // QTS
+    { 0x5202, "2 Plus AD, Bulgaria" }, // TPB
+    { 0x5663, "Usanca Soluciones, Spain" }, // USC
+    { 0x05b3, "Zhejiang Joy Electronic Technology, China" }, // AMS
+    { 0x5459, "ubitricity Gesellschaft fur verteilte Energiesysteme mbH, Germany" }, // UBY
+    { 0x3c45, "Obeo, Norway" }, // OBE
+    { 0x0634, "Aquatherm PPH, Poland" }, // AQT
+    { 0x0647, "ARGO group of companies, Russian Federation" }, // ARG
+    { 0x0663, "A2A Smart City, Italy" }, // ASC
+    { 0x39b4, "Nova met, Czech Republic" }, // NMT
+    { 0x5130, "TIP, Germany" }, // TIP
+    { 0x5a83, "Vitelec, Netherlands" }, // VTC
+    { 0x1534, "EnergyICT, Belgium" }, // EIT
+    { 0x5127, "ZHONGHUAN TIG, China" }, // TIG
+    { 0x5e64, "Yantai Wisdom Electric, China" }, // WSD
+    { 0x6685, "Yuksek Teknoloji, Turkey" }, // YTE
+    { 0x506f, "Teco, Czech Republic" }, // TCO
+    { 0x2c37, "Kamstrup, Denmark" }, // KAW
+    { 0x1e93, "GIGATRONIK Stuttgart, Germany" }, // GTS
+    { 0x0621, "ACTAQUA, Germany" }, // AQA
+    { 0x3f4b, "Oz kar Enerji, Turkey" }, // OZK
+    { 0x0653, "ADD, Bulgaria" }, // ARS
+    { 0x058c, "Allied Engineering Works, India" }, // ALL
+    { 0x4130, "Hermann Pipersberg jr, Germany" }, // PIP
+    { 0x1e58, "Gurux, Finland" }, // GRX
+    { 0x4e05, "SUKHILA POWER ELECTRONICS, India" }, // SPE
+    { 0x1832, "FARAB, Iran" }, // FAR
+    { 0x366d, "MS M, South Korea" }, // MSM
+    { 0x11a5, "DIEHL Metering, Germany" }, // DME
+    { 0x402e, "Panasonic Corporation, Japan" }, // PAN
+    { 0x4d38, "Six Innovation, Sweden" }, // SIX
+    { 0x55c5, "Zhejiang Goldcard Power Tech, China" }, // UNE
+    { 0x506d, "TCOM, Serbia" }, // TCM
+    { 0x35b3, "Brunswick Bowling and Billiards UK, United Kingdom" }, // MMS
+    { 0x3532, "MIR Research and Production Association, Russian Federation" }, // MIR
+    { 0x4d0d, "Shanghai Metering, China" }, // SHM
+    { 0x2474, "International Control Metering Technologies, Germany" }, // ICT
+    { 0x0f41, "Contadores de Agua de Zaragoza, Spain" }, // CZA
+    { 0x5065, "Qingdao iTechene Technologies, China" }, // TCE
+    { 0x1596, "Elvaco, Sweden" }, // ELV
+    { 0x58b2, "VERAUT, Austria" }, // VER
+    { 0x3ace, "NOVEN ENERGY AND ICT, Turkey" }, // NVN
+    { 0x592e, "Vektor innovations, India" }, // VIN
+    { 0x0587, "Algodue Elettronica, Italy" }, // ALG
+    { 0x3ac4, "METER" }, // NVD
+    { 0x42d4, "Pavo Tasarim Uretim Elektronik Tic, Turkey" }, // PVT
+    { 0x4da1, "Smart me, Switzerland" }, // SMA
+    { 0x11cf, "DENO, Croatia" }, // DNO
+    { 0x39d4, "2N Telekomunikace, Czech Republic" }, // NNT
+    { 0x1026, "Daf Enerji Sanayi ve Ticaret, Turkey" }, // DAF
+    { 0x1025, "DAE, Italy" }, // DAE
+    { 0x2db4, "Krohne Messtechnik, Germany" }, // KMT
+    { 0x4e45, "Guangzhou Sunrise Electronics Development, China" }, // SRE
+    { 0x146d, "Ecomess, Poland" }, // ECM
+    { 0x65d0, "Ningbo Yong Neng Power Technology, China" }, // YNP
+    { 0x4f53, "Szerver Szektor Kft, Hungary" }, // SZS
+    { 0x2293, "HTS Elektronik" }, // HTS
+    { 0x22c7, "Hekatron Vertriebs, Germany" }, // HVG
+    { 0x120d, "DELTA PRIMA METERING SDN BHD" }, // DPM
+    { 0x4965, "Viterra Energy Services formerly Raab Karcher ES" }, // RKE
+    { 0x16a5, "E E Electronic, Austria" }, // EUE
+    { 0x30e9, "Landis Gyr, India" }, // LGI
+    { 0x066a, "ACCUMET SOLUTIONS, India" }, // ASJ
+    { 0x05a8, "AmiHo, United Kingdom" }, // AMH
+    { 0x5053, "TEBAS END ISI SIS INS TUR SAN VE TIC STI, Turkey" }, // TBS
+    { 0x1984, "Fludia, France" }, // FLD
+    { 0x528d, "Toshiba Toko Meter Systems, Japan" }, // TTM
+    { 0x0c53, "CB Svendsen, Denmark" }, // CBS
+    { 0x4cee, "SYGNITY, Poland" }, // SGN
+    { 0x4da9, "PT SMART METER, Indonesia" }, // SMI
+    { 0x3524, "MiDo, Italy" }, // MID
+    { 0x420c, "Prompribor plant, Russian Federation" }, // PPL
+    { 0x5e67, "ZHEJIANG WELLSUN INTELLIGENT TECHNOLOGY, China" }, // WSG
+    { 0x254b, "IJENKO, France" }, // IJK
+    { 0x0644, "Arad Group, Israel" }, // ARD
+    { 0x256d, "Ikom, Croatia" }, // IKM
+    { 0x11d6, "DNV GL, Netherlands" }, // DNV
+    { 0x48a9, "RENESAS ELECTRONICS, India" }, // REI
+    { 0x0613, "Apsis Kontrol Sistemleri, Turkey" }, // APS
+    { 0x521a, "PLC Technology" }, // TPZ
+    { 0x2ae8, "TIANJIN WANHUA, China" }, // JWH
+    { 0x0a64, "BSED, Germany" }, // BSD
+    { 0x41e4, "PowerOneData, India" }, // POD
+    { 0x48ad, "Remote Energy Monitoring, United Kingdom" }, // REM
+    { 0x4e6c, "Synapsys Solutions" }, // SSL
+    { 0x4923, "Richa Equipments, India" }, // RIC
+    { 0x50b5, "TOSHELECTROAPPARAT FE, Uzbekistan" }, // TEU
+    { 0x31f6, "Lovato Electric, Italy" }, // LOV
+    { 0x4d96, "Solvimus, Germany" }, // SLV
+    { 0x4f33, "Softwareentwicklung Systemdesign, Austria" }, // SYS
+    { 0x0664, "AS DAQ SYSTEMS, India" }, // ASD
+    { 0x2485, "IMIT" }, // IDE
+    { 0x48ac, "Relay, Germany" }, // REL
+    { 0x3514, "Mechatronic Meters, Italy" }, // MHT
+    { 0x4de3, "SOCOMEC, France" }, // SOC
+    { 0x09d2, "Beijing Banner Electric, China" }, // BNR
+    { 0x192f, "Pietro Fiorentini, Italy" }, // FIO
+    { 0x51b3, "TEMASS IMALAT, Turkey" }, // TMS
+    { 0x5e6d, "winAMR Systems, India" }, // WSM
+    { 0x3698, "Matrix Energy, India" }, // MTX
+    { 0x5a8b, "Linkwell Telesystems, India" }, // VTK
+    { 0x20ed, "HG meter, Denmark" }, // HGM
+    { 0x3473, "MetCom Solutions, Germany" }, // MCS
+    { 0x59b0, "VAMP, Finland" }, // VMP
+    { 0x6930, "St Petersburg Meters Factory, Russian Federation" }, // ZIP
+    { 0x10d3, "Danfoss" }, // DFS
+    { 0x41a5, "Pal Mohan Electronics, India" }, // PME
+    { 0x268c, "Indriya Technologies, India" }, // ITL
+    { 0x4e83, "Sunrise Technology, China" }, // STC
+    { 0x1585, "Elster Electricity, United States of America" }, // ELE
+    { 0x09b4, "BMETERS, Italy" }, // BMT
+    { 0x30fa, "Landis Gyr, Switzerland" }, // LGZ
+    { 0x38b3, "NORA ELK MALZ SAN ve TIC, Turkey" }, // NES
+    { 0x1e41, "Graesslin, Germany" }, // GRA
+    { 0x3470, "MPSE, Germany" }, // MCP
+    { 0x15ce, "Enernet, South Korea" }, // ENN
+    { 0x0e94, "DLMS User Association Conformance, Switzerland" }, // CTT
+    { 0x1668, "EMSYCON, Germany" }, // ESH
+    { 0x0db4, "CMOSTEK MICROELECTRONICS, China" }, // CMT
+    { 0x5083, "Telecom Design, France" }, // TDC
+    { 0x4cac, "Selec Controls, India" }, // SEL
+    { 0x4dee, "Sontex, Switzerland" }, // SON
+    { 0x064b, "Arkon Flow Systems, Czech Republic" }, // ARK
+    { 0x3472, "MICRORISC, Czech Republic" }, // MCR
+    { 0x0e85, "COSTER T E, Italy" }, // CTE
+    { 0x32a7, "Landis Gyr, Germany" }, // LUG
+    { 0x15ad, "Email Metering, Australia" }, // EMM
+    { 0x096f, "Beko Elektronik, Turkey" }, // BKO
+    { 0x69f4, "Zhejiang Ocaenergy Technology" }, // ZOT
+    { 0x302e, "Langmatz, Germany" }, // LAN
+    { 0x21ac, "Holley Technology, China" }, // HML
+    { 0x08a7, "begcomm Communication, Sweden" }, // BEG
+    { 0x24c3, "infocon, Montenegro" }, // IFC
+    { 0x3db3, "OMNISYSTEM, South Korea" }, // OMS
+    { 0x0c94, "CENTRE FOR DEVELOPMENT OF TELEMATICS, India" }, // CDT
+    { 0x524f, "TROX, Germany" }, // TRO
+    { 0x25c6, "Infometric, Sweden" }, // INF
+    { 0x2cac, "KELEMINIC, Croatia" }, // KEL
+    { 0x1561, "Eka Systems, United States of America" }, // EKA
+    { 0x0713, "AXSEM, Switzerland" }, // AXS
+    { 0x3665, "Mahashakti Energy, India" }, // MSE
+    { 0x4a77, "RSW Technik, Germany" }, // RSW
+    { 0x4dcd, "ShenZhen Northmeter, China" }, // SNM
+    { 0x6832, "SNC ZARALAB, Bulgaria" }, // ZAR
+    { 0x410c, "HangZhou PAX Electronic Technology, China" }, // PHL
+    { 0x15a8, "EMH metering formerly EMH Elektrizitatszahler" }, // EMH
+    { 0x192d, "Frodexim, Bulgaria" }, // FIM
+    { 0x5eb2, "Wurm Elektronische Systeme, Germany" }, // WUR
+    { 0x2526, "Westenergie Metering, Germany" }, // IIF
+    { 0x0845, "Bentec Bhartia Engineers, India" }, // BBE
+    { 0x2465, "Icoal incorporated, United States of America" }, // ICE
+    { 0x25f4, "Trilliant Networks, Canada" }, // IOT
+    { 0x4d34, "SITEL, Serbia" }, // SIT
+    { 0x4cab, "StroyEnergoKom, Russian Federation" }, // SEK
+    { 0x5694, "UtiliTools, Germany" }, // UTT
+    { 0x5d6c, "Shenyang jia DE lian yi energy technology, China" }, // WKL
+    { 0x2059, "HENAN HUABIAO INSTRUMENT TECHNOLOGY, China" }, // HBY
+    { 0x35d3, "MANAS Elektronik, Turkey" }, // MNS
+    { 0x15c8, "ENMAS, Germany" }, // ENH
+    { 0x22ad, "Humanlitech, Ghana" }, // HUM
+    { 0x5129, "TRIKALA INDUSTRIES, India" }, // TII
+    { 0x4e56, "Servic, Ukraine" }, // SRV
+    { 0x5934, "Vitir, Norway" }, // VIT
+    { 0x4db8, "Smart Meters Technologies Sdn Bhd, Malaysia" }, // SMX
+    { 0x1673, "Energy Saving Systems, Ukraine" }, // ESS
+    { 0x15d3, "ENSO NETZ, Germany" }, // ENS
+    { 0x3679, "MAK SAY Elektrik Elektronik Malzemeleri, Turkey" }, // MSY
+    { 0x1a12, "F Pribor, Belarus" }, // FPR
+    { 0x1573, "DICLE KOEK ENERJI YATIRIM" }, // EKS
+    { 0x1433, "EAS Elektronik San Tic, Turkey" }, // EAS
+    { 0x3573, "MAK SAY Elektrik Elektronik, Turkey" }, // MKS
+    { 0x58a3, "Energo Control, Ukraine" }, // VEC
+    { 0x5449, "Ubitronix system solutions, Austria" }, // UBI
+    { 0x51f0, "KMB systems, Czech Republic" }, // TOP
+    { 0x0a4e, "Bruntab Energy, Iran" }, // BRN
+    { 0x550d, "Micronics, United Kingdom" }, // UHM
+    { 0x05a4, "KEPID AMSTECH, South Korea" }, // AMD
+    { 0x6a99, "ZHEJIANG CHINT INSTRUMENT METER, China" }, // ZTY
+    { 0x318d, "LianYunGang LianLi First Meter, China" }, // LLM
+    { 0x5033, "Pouyeshgaran Tabriz Azma, Iran" }, // TAS
+    { 0x04a3, "Advance Electronics Company, Saudi Arabia" }, // AEC
+    { 0x41ac, "PROGRESSIVE METERS, India" }, // PML
+    { 0x24f2, "iGridS Hebelweg, Germany" }, // IGR
+    { 0x1da3, "GMC I Messtechnik, Germany" }, // GMC
+    { 0x1cb8, "Global Evolution Lighting, Tunisia" }, // GEX
+    { 0x41b0, "REDUR, Germany" }, // PMP
+    { 0x3b2e, "Nanjing Yuneng Instrument, China" }, // NYN
+    { 0x2325, "Zhejiang Hyayi Electronic Industry, China" }, // HYE
+    { 0x5027, "Telma, Switzerland" }, // TAG
+    { 0x0516, "aventies, Germany" }, // AHV
+    { 0x1064, "Delhi Control Devices, India" }, // DCD
+    { 0x1cac, "Industrial Technology Research Institute, Taiwan" }, // GEL
+    { 0x4e46, "Saraf Industries, India" }, // SRF
+    { 0x21ec, "Holosys, Croatia" }, // HOL
+    { 0x0e57, "Xuzhou Runwu Science and Technology Development, China" }, // CRW
+    { 0x0d05, "Shandong Chenhui Electronic Technology, China" }, // CHE
+    { 0x0eb2, "CURRENT Group, United States of America" }, // CUR
+    { 0x1ccd, "GE Fuji Meter, Japan" }, // GFM
+    { 0x40b2, "Perry Electric, Italy" }, // PER
+    { 0x05b8, "APATOR METRIX, Poland" }, // AMX
+    { 0x4ded, "Somesca, France" }, // SOM
+    { 0x5daf, "Westermo Teleindustri, Sweden" }, // WMO
+    { 0x15d2, "Energisme" }, // ENR
+    { 0x05ee, "ASTRON, Slovenia" }, // AON
+    { 0x0461, "Acean, France" }, // ACA
+    { 0x1a0c, "fifthplay, Belgium" }, // FPL
+    { 0x1574, "PA KVANT J S, Russian Federation" }, // EKT
+    { 0x05c4, "Andis, Slovakia" }, // AND
+    { 0x4833, "Rubikon Apskaitos Sistemos, Lithuania" }, // RAS
+    { 0x25d3, "INSYS MICROELECTRONICS, Germany" }, // INS
+    { 0x6a4d, "ZENNER International, Germany" }, // ZRM
+    { 0x25ba, "iMezr Innovations, India" }, // IMZ
+    { 0x18a4, "Federal Elektrik, Turkey" }, // FED
+    { 0x3834, "Natural Heat Ahorro Energetico, Spain" }, // NAT
+    { 0x4dc2, "Stromnetz Berlin, Germany" }, // SNB
+    { 0x11c2, "Dana Sanjesh o Bargh Danaab, Iran" }, // DNB
+    { 0x35b0, "MATRIXMETERS, India" }, // MMP
+    { 0x12cc, "devolo, Germany" }, // DVL
+    { 0x0a63, "Sanaye Sanjesh Energy Behineh Sazan Toos, Iran" }, // BSC
+    { 0x24a9, "Informage Energy, India" }, // IEI
+    { 0x2697, "ITRON Water, France" }, // ITW
+    { 0x14d3, "EFSYS, France" }, // EFS
+    { 0x366f, "Metiso, Serbia" }, // MSO
+    { 0x4e4e, "Shandong SARON Intelligent Technology, China" }, // SRN
+    { 0x525a, "TR Group, South Africa" }, // TRZ
+    { 0x5039, "Taytech Otomasyon ve Bilisim Teknolojileri Sti, Turkey" }, // TAY
+    { 0x2cb3, "Kavosh Electronic Sepahan, Iran" }, // KES
+    { 0x4249, "Polymeters Response International" }, // PRI
+    { 0x3933, "Nisko Industries, Israel" }, // NIS
+    { 0x2027, "Hager Electro, Germany" }, // HAG
+    { 0x26b3, "IUSA DE CV, Mexico" }, // IUS
+    { 0x4f38, "SyxthSense, United Kingdom" }, // SYX
+    { 0x206d, "Hidroconta U, Spain" }, // HCM
+    { 0x15c9, "entec innovations, Germany" }, // ENI
+    { 0x3481, "PT MELCOINDA, Indonesia" }, // MDA
+    { 0x0421, "Aventies, Germany" }, // AAA
+    { 0x1661, "ESAC, Italy" }, // ESA
+    { 0x4d87, "Silergy Technologies" }, // SLG
+    { 0x1530, "Elmeasure, India" }, // EIP
+    { 0x2c93, "Kedros, Slovakia" }, // KDS
+    { 0x5d2b, "WIKON Kommunikationstechnik, Germany" }, // WIK
+    { 0x20ac, "Heliowatt" }, // HEL
+    { 0x30e7, "Ningxia LGG Instrument, China" }, // LGG
+    { 0x30f5, "LG Uplus, South Korea" }, // LGU
+    { 0x4cb4, "Sagemcom Energy Telecom, France" }, // SET
+    { 0x6493, "YIDU Smart Technology Beijing, China" }, // YDS
+    { 0x25a5, "Fellows, Poland" }, // IME
+    { 0x0db6, "Comverge, United States of America" }, // CMV
+    { 0x3662, "MISA SDN BHD, Malaysia" }, // MSB
+    { 0x50a8, "IOTech" }, // TEH
+    { 0x16c4, "DREWAG NETZ, Germany" }, // EVD
+    { 0x5c8e, "Webdyn, France" }, // WDN
+    { 0x0a74, "BESTAS Elektronik Optik, Turkey" }, // BST
+    { 0x5183, "TELECON GALICIA, Spain" }, // TLC
+    { 0x3e6b, "Osaki Electric, Japan" }, // OSK
+    { 0x2473, "ICSA, India" }, // ICS
+    { 0x35f3, "MOMAS SYSTEMS, Nigeria" }, // MOS
+    { 0x1489, "Enel Distribuzione Via Ombrone, Italy" }, // EDI
+    { 0x5ad6, "VIVAVIS, Germany" }, // VVV
+    { 0x04ac, "Kohler, Turkey" }, // AEL
+    { 0x4e65, "S T Smart Energy, Austria" }, // SSE
+    { 0x2289, "Shandong Hetong Information Technology, China" }, // HTI
+    { 0x2a6f, "Schloesser Armaturen, Germany" }, // JSO
+    { 0x05ed, "Aquametro Oil Marine, Switzerland" }, // AOM
+    { 0x0c73, "Chetas Control Systems, India" }, // CCS
+    { 0x3425, "Mates Elektronik Metin Ates, Turkey" }, // MAE
+    { 0x4d2e, "SINAPSI, Italy" }, // SIN
+    { 0x2c34, "KATHREIN Werke, Germany" }, // KAT
+    { 0x24f3, "I G S DATAFLOW, Italy" }, // IGS
+    { 0x1347, "DZG Metering, Germany" }, // DZG
+    { 0x4d79, "SKYLARK SMARTMETERS, India" }, // SKY
+    { 0x30e2, "Landis Gyr, United Kingdom" }, // LGB
+    { 0x0a92, "RIA BTR Produktions, Germany" }, // BTR
+    { 0x19ac, "Siemens Measurements Formerly FML" }, // FML
+    { 0x0452, "ABB, Czech Republic" }, // ABR
+    { 0x35ea, "Mojec International, Nigeria" }, // MOJ
+    { 0x49d7, "Renergy Micro Technologies, China" }, // RNW
+    { 0x5a09, "Van Putten Instruments" }, // VPI
+    { 0x150c, "Secure Meters" }, // EHL
+    { 0x1456, "EBV Elektronik, Germany" }, // EBV
+    { 0x0e13, "CAPITAL POWER SYSTEMS, India" }, // CPS
+    { 0x582c, "Valkoder, Bulgaria" }, // VAL
+    { 0x0477, "Actaris Water and Heat, France" }, // ACW
+    { 0x0ce3, "Contor Group, Romania" }, // CGC
+    { 0x1997, "Fluidwell, Netherlands" }, // FLW
+    { 0x1e49, "Grinpal Energy Management, South Africa" }, // GRI
+    { 0x1587, "Elgas, Czech Republic" }, // ELG
+    { 0x5068, "Techem Service" }, // TCH
+    { 0x0a93, "Basari Teknolojik Sistemler, Turkey" }, // BTS
+    { 0x2105, "HAUSHELD, Germany" }, // HHE
+    { 0x0d53, "CJS Technology, United Kingdom" }, // CJS
+    { 0x0e0c, "CPL CONCORDIA Soc Coop, Italy" }, // CPL
+    { 0x3101, "Atlantic Meters, South Africa" }, // LHA
+    { 0x216b, "Hokuriku Instrumentation, Japan" }, // HKK
+    { 0x1a55, "OJSC NRPA FRUNZE, Russian Federation" }, // FRU
+    { 0x1e53, "Garderos, Germany" }, // GRS
+    { 0x1461, "ECO ADAPT, France" }, // ECA
+    { 0x4824, "Radiocrafts, Norway" }, // RAD
+    { 0x05ac, "Eon Electric, India" }, // AML
+    { 0x11b3, "Digilog Micro Solutions, India" }, // DMS
+    { 0x16e7, "EWG DOO, Serbia" }, // EWG
+    { 0x0583, "Zenner Gas, Italy" }, // ALC
+    { 0x0c28, "MAEC GROUPE CAHORS, France" }, // CAH
+    { 0x15a5, "SC Electromagnetica, Romania" }, // EME
+    { 0x1e92, "Globaltronics for Electronics E, Egypt" }, // GTR
+    { 0x5c29, "Chongqing WECAN Precision Instruments, China" }, // WAI
+    { 0x05b0, "Ampy Automation Digilog" }, // AMP
+    { 0x09b0, "BMETERS Polska, Poland" }, // BMP
+    { 0x2470, "PT Comnets Plus, Indonesia" }, // ICP
+    { 0x492c, "Rikken Instrumentation, India" }, // RIL
+    { 0x0b37, "Baylan Water Meters, Turkey" }, // BYW
+    { 0x2e04, "Korea Electric Power Industrial Development, South Korea" }, // KPD
+    { 0x5ca8, "E Wehrle, Germany" }, // WEH
+    { 0x4265, "pSenso, Poland" }, // PSE
+    { 0x3033, "Lansen Systems, Sweden" }, // LAS
+    { 0x3693, "MeteRSit, Italy" }, // MTS
+    { 0x3a54, "Zavod Nartis, Russian Federation" }, // NRT
+    { 0x3534, "Sagemcom Energy Telecom, France" }, // MIT
+    { 0x55c9, "Univations, Hong Kong" }, // UNI
+    { 0x0668, "Basic Electronics Company, Saudi Arabia" }, // ASH
+    { 0x0a65, "Basari Elektronik, Turkey" }, // BSE
+    { 0x2604, "IPD Industrial Products, Australia" }, // IPD
+    { 0x269a, "ITRON, South Africa" }, // ITZ
+    { 0x4c6d, "CalinMeter, China" }, // SCM
+    { 0x05a9, "AMI Tech I, India" }, // AMI
+    { 0x2573, "IKASIAN, Spain" }, // IKS
+    { 0x3684, "Removed November, United States of America" }, // MTD
+    { 0x15af, "Enermet" }, // EMO
+    { 0x38a5, "Northern Electric Equipment Joint Stock Company, Vietnam" }, // NEE
+    { 0x412c, "Pilot Systems London, United Kingdom" }, // PIL
+    { 0x342e, "Manthey, Germany" }, // MAN
+    { 0x0853, "BBS Electronics, Singapore" }, // BBS
+    { 0x31e2, "Lobaro, Germany" }, // LOB
+    { 0x50f8, "Tiesse, Italy" }, // TGX
+    { 0x3c89, "OAS Digital Infrastructures, India" }, // ODI
+    { 0x11ed, "Domat Control System, Czech Republic" }, // DOM
+    { 0x1593, "Elster, Germany" }, // ELS
+    { 0x50c7, "TERMICS Divisione FIMIGAS, Italy" }, // TFG
+    { 0x3dd2, "ONUR Elektroteknik, Turkey" }, // ONR
+    { 0x1141, "De Jaeger Automation, Belgium" }, // DJA
+    { 0x3a65, "North Smart Equipment, China" }, // NSE
+    { 0x5209, "Transfopower Industries, Pakistan" }, // TPI
+    { 0x0e23, "Yueqing Qicheng Electric, China" }, // CQC
+    { 0x5a6e, "Viewshine, China" }, // VSN
+    { 0x0ab9, "BUYI TECHNOLOGOY, China" }, // BUY
+    { 0x5133, "Texas Instruments, Hong Kong" }, // TIS
+    { 0x4d23, "SICK Engineering, Germany" }, // SIC
+    { 0x24a3, "leonnardo Corporation, Ukraine" }, // IEC
+    { 0x25b3, "IMST, Germany" }, // IMS
+    { 0x5f47, "Neumann Wasserzaehler Glaubitz, Germany" }, // WZG
+    { 0x08b2, "Bernina Electronic, Switzerland" }, // BER
+    { 0x328f, "Labtrino, Sweden" }, // LTO
+    { 0x228c, "Ernst Heitland Erlenstr, Germany" }, // HTL
+    { 0x21b4, "Hangzhou Meteronic Technology, China" }, // HMT
+    { 0x14f9, "ian Smart Meter Company, Egypt" }, // EGY
+    { 0x3c52, "RMZ OBRIY, Ukraine" }, // OBR
+    { 0x1a74, "FieldServer Technologies, United States of America" }, // FST
+    { 0x1428, "Endress Hauser, Germany" }, // EAH
+    { 0x5105, "Theben, Germany" }, // THE
+    { 0x4938, "Raonix, South Korea" }, // RIX
+    { 0x1684, "Energy Team, Italy" }, // ETD
+    { 0x2846, "Beijing jingyibeifang instrument company" }, // JBF
+    { 0x0745, "AZEL Electronics, Turkey" }, // AZE
+    { 0x327a, "Siemens Building Technologies" }, // LSZ
+    { 0x4d04, "Beijing SanHuaDeBao Energy Technoligy, China" }, // SHD
+    { 0x25b2, "iMeter, Ukraine" }, // IMR
+    { 0x11d4, "Dr Neuhaus Telekommunikation, Germany" }, // DNT
+    { 0x40f0, "P G P Smart Sensing, Belgium" }, // PGP
+    { 0x4024, "PadMess, Germany" }, // PAD
+    { 0x41b8, "Dell Anna Ing Luca, Italy" }, // PMX
+    { 0x0ca2, "Cebyc, Norway" }, // CEB
+    { 0x144b, "Biesenthal, Germany" }, // EBK
+    { 0x3561, "mirakonta, Germany" }, // MKA
+    { 0x4230, "PQ Plus, Germany" }, // PQP
+    { 0x4129, "PiiGAB Processinformation i Goteborg, Sweden" }, // PII
+    { 0x05a3, "Arch Meter Corporation, Taiwan" }, // AMC
+    { 0x44d0, "QFP Engineering, Italy" }, // QFP
+    { 0x4dd3, "Signals and Systems, India" }, // SNS
+    { 0x26d9, "IVY metering, China" }, // IVY
+    { 0x04b3, "ALFANAR ELECTRICAL SYSTEM, Saudi Arabia" }, // AES
+    { 0x60ad, "XEMTEC, Switzerland" }, // XEM
+    { 0x4ef3, "Stadtwerke Senftenberg, Germany" }, // SWS
+    { 0x4da3, "Sierra Monitor Corporation, United States of America" }, // SMC
+    { 0x0588, "ALFANAR ELECTRICAL SYSTEM, Saudi Arabia" }, // ALH
+    { 0x1468, "Networked Energy Services Corporation, United States of America" }, // ECH
+    { 0x502c, "TALAMONA, Italy" }, // TAL
+    { 0x05b2, "Actislink, Poland" }, // AMR
+    { 0x4d6e, "BENTEX CONTROL AND SWITCH GEAR, India" }, // SKN
+    { 0x2134, "ABB, Poland" }, // HIT
+    { 0x6a98, "ZHEJIANG TANCY INSTRUMENT TECHNOLOGY eTD, China" }, // ZTX
+    { 0x0ee1, "CompWell, Sweden" }, // CWA
+    { 0x2c2d, "Kamstrup Energi" }, // KAM
+    { 0x2199, "Holley Metering" }, // HLY
+    { 0x5d78, "JINING WUKEXING METER, China" }, // WKX
+    { 0x294e, "BeiJing Fine Clean Enery Technology, China" }, // JJN
+    { 0x16b2, "Eurometers" }, // EUR
+    { 0x1caf, "Green Energy Options, United Kingdom" }, // GEO
+    { 0x0ded, "COMMON, Poland" }, // COM
+    { 0x05da, "Anhui Nari Zenith Electricity Electronic" }, // ANZ
+    { 0x4289, "Prolific Technology, Taiwan" }, // PTI
+    { 0x424f, "Proton Elektromed, Turkey" }, // PRO
+    { 0x2745, "iZenze, Sweden" }, // IZE
+    { 0x368d, "Metrum, Sweden" }, // MTM
+    { 0x568c, "United Telecoms, India" }, // UTL
+    { 0x20a9, "Hydro Eco Invest, Poland" }, // HEI
+    { 0x1669, "Monosan Monofaze Elektrik Motorlari, Turkey" }, // ESI
+    { 0x4ce1, "smartGAS Mikrosensorik, Germany" }, // SGA
+    { 0x3989, "Next Level Integration, Germany" }, // NLI
+    { 0x4f23, "Sycous Leeds Innovation Centre, United Kingdom" }, // SYC
+    { 0x49a7, "RMG Messtechnik, Germany" }, // RMG
+    { 0x1d8d, "GETRALINE, France" }, // GLM
+    { 0x246d, "Intracom, Greece" }, // ICM
+    { 0x5a9a, "VitzroSys, South Korea" }, // VTZ
+    { 0x0a41, "Brandes, Germany" }, // BRA
+    { 0x25cf, "Indotech Switchgear Controls Delhi, India" }, // INO
+    { 0x34a3, "Mitsubishi Electric Corporation, Japan" }, // MEC
+    { 0x21ee, "Honeywell Technologies, Switzerland" }, // HON
+    { 0x5294, "Telephone and Telegraph Technique, Bulgaria" }, // TTT
+    { 0x5173, "Teksan Teknolojik OElcum Sistemleri, Turkey" }, // TKS
+    { 0x493a, "RIZ Transmitters, Croatia" }, // RIZ
+    { 0x11f3, "Metsec Cables, Kenya" }, // DOS
+    { 0x5994, "ABB EPMV Division, Czech Republic" }, // VLT
+    { 0x4f2e, "SMSISTEM, Turkey" }, // SYN
+    { 0x0974, "Bekto Precisa, Bosnia and Herzegovina" }, // BKT
+    { 0x2c33, "Kamstrup, Denmark" }, // KAS
+    { 0x4db1, "SMARTMETERQ, Italy" }, // SMQ
+    { 0x0b2c, "Baylan, Turkey" }, // BYL
+    { 0x2665, "INESH SMART ENERGY P, India" }, // ISE
+    { 0x16f3, "ENLESS WIRELESS" }, // EWS
+    { 0x0614, "Apator, Poland" }, // APT
+    { 0x05a2, "Wurth Elektronik eiSos, Germany" }, // AMB
+    { 0x0a73, "Baylan Su Sayaclari, Turkey" }, // BSS
+    { 0x4c61, "SENECA, Italy" }, // SCA
+    { 0x3674, "Microsoft Corporation, Taiwan" }, // MST
+    { 0x2e6d, "Korea Testing Certification, South Korea" }, // KSM
+    { 0x15d8, "Enetronx, Germany" }, // ENX
+    { 0x4eae, "TIAN JIN SUN ENERGY TECHNOLOGY, China" }, // SUN
+    { 0x11b0, "DM Power, South Korea" }, // DMP
+    { 0x4e86, "STACKFORCE, Germany" }, // STF
+    { 0x2305, "Hexing Electrical, China" }, // HXE
+    { 0x5117, "TW TEAMWARE, Italy" }, // THW
+    { 0x1cb4, "Genus Electrotech, India" }, // GET
+    { 0x58ef, "Vango Technologies, Taiwan" }, // VGO
+    { 0x1676, "ESKA VALVE, Turkey" }, // ESV
+    { 0x08d7, "BFW Buero fuer Waermemesstechnik OHG, Germany" }, // BFW
+    { 0x3654, "MIRTEK, Russian Federation" }, // MRT
+    { 0x250d, "Shenzhen Inhemeter, China" }, // IHM
+    { 0x158d, "Elektromed Elektronik, Turkey" }, // ELM
+    { 0x0ef6, "CMEC Electric Import Export, China" }, // CWV
+    { 0x5f54, "Wizit, South Korea" }, // WZT
+    { 0x2695, "ITRON United States Itron, United States of America" }, // ITU
+    { 0x2d85, "SHIJIAZHUANG KELIN ELECTRIC, China" }, // KLE
+    { 0x492e, "Rayleigh Instruments, United Kingdom" }, // RIN
+    { 0x4e96, "STV Automation Branch of STV Electronic, Germany" }, // STV
+    { 0x15a3, "Embedded Communication Systems, Switzerland" }, // EMC
+    { 0x1111, "YIDU Smart Technology Beijing, China" }, // DHQ
+    { 0x3434, "Mitsubishi Electric Automation, Thailand" }, // MAT
+    { 0x39f1, "NorthQ, Denmark" }, // NOQ
+    { 0x15c7, "ENER G Switch, United Kingdom" }, // ENG
+    { 0x1db4, "GMT, Germany" }, // GMT
+    { 0x1e45, "GE2 Green Energy Electronics, Portugal" }, // GRE
+    { 0x1d2f, "G GIOANOLA, Italy" }, // GIO
+    { 0x4098, "Paradox Engineering, Switzerland" }, // PDX
+    { 0x1d2e, "Gineers, Bulgaria" }, // GIN
+    { 0x59c5, "Vision Networks, India" }, // VNE
+    { 0x0f25, "Quanzhou Chiyoung Electronics Technology, China" }, // CYE
+    { 0x4ed4, "SPUTNIK, Russian Federation" }, // SVT
+    { 0x0c32, "CARI Electronic, France" }, // CAR
+    { 0x6752, "Cangzhou City Hebei Electronic Technology, China" }, // YZR
+    { 0x15c5, "ENERDIS, France" }, // ENE
+    { 0x0463, "Accurate, Pakistan" }, // ACC
+    { 0x10a1, "Dea HT, Italy" }, // DEA
+    { 0x68f8, "ZIGNUX TECHNOLOGY, Spain" }, // ZGX
+    { 0x0d8f, "Clorius Raab Karcher Energi Service" }, // CLO
+    { 0x4db2, "Saudi Meters Company, Saudi Arabia" }, // SMR
+    { 0x10ac, "DELTAMESS DWWF, Germany" }, // DEL
+    { 0x0492, "Adrem Engineering, Romania" }, // ADR
+    { 0x412b, "pikkerton, Germany" }, // PIK
+    { 0x42f2, "Powrtec, United States of America" }, // PWR
+    { 0x5e94, "Watertech, Italy" }, // WTT
+    { 0x1653, "Eurosys, Bulgaria" }, // ERS
+    { 0x2ca5, "Keewe, Bulgaria" }, // KEE
+    { 0x0d99, "Clayster, Sweden" }, // CLY
+    { 0x10e3, "Digicom, Italy" }, // DGC
+    { 0x4c83, "SdC Sistemas de Contagem" }, // SDC
+    { 0x3a70, "M S N S Power, India" }, // NSP
+    { 0x4213, "Palace Power Systems, South Africa" }, // PPS
+    { 0x2690, "M s ITI, India" }, // ITP
+    { 0x4c25, "SAE IT systems, Germany" }, // SAE
+    { 0x0c22, "Cabtronix, Switzerland" }, // CAB
+    { 0x202b, "Hako, Slovakia" }, // HAK
+    { 0x212e, "huebner Informationselektronik, Germany" }, // HIN
+    { 0x0c36, "CaveTronic, Poland" }, // CAV
+    { 0x26e4, "Inkwell Data, Ireland" }, // IWD
+    { 0x30a9, "PCP International, India" }, // LEI
+    { 0x516e, "TECHKNAVE, India" }, // TKN
+    { 0x4274, "PSTec, South Korea" }, // PST
+    { 0x0422, "Milas" }, // AAB
+    { 0x2349, "TANGSHAN HUIZHONG INSTRUMENTATION, China" }, // HZI
+    { 0x2423, "INHEMETER AFRICA COMPANY, Kenya" }, // IAC
+    { 0x2687, "ITRON Gas, France" }, // ITG
+    { 0x3689, "Microtech Industries, Pakistan" }, // MTI
+    { 0x1e65, "Gridspertise, Italy" }, // GSE
+    { 0x25d0, "INNOTAS Produktions, Germany" }, // INP
+    { 0x16cb, "EV KUR ELEKTRIK, Turkey" }, // EVK
+    { 0x5427, "Uher" }, // UAG
+    { 0x2c32, "Keskar Vana Metal Mak Sti, Turkey" }, // KAR
+    { 0x592d, "VIEN ENERJI SISTEMLERI SANAYI VE TICARET SIRKETI, Turkey" }, // VIM
+    { 0x156f, "EKOLIS, France" }, // EKO
+    { 0x4d2c, "Silicon Laboratories, United States of America" }, // SIL
+    { 0x35a6, "MEMF Electrical Industries, Saudi Arabia" }, // MMF
+    { 0x418e, "Prolan Process Control Company, Hungary" }, // PLN
+    { 0x0672, "Erelsan Elektrik ve Elektronik, Turkey" }, // ASR
+    { 0x3b52, "Nordwestdeutsche Zaehlerrevision Ing Aug Knemeyer, Germany" }, // NZR
+    { 0x1089, "DD Infraventures, India" }, // DDI
+    { 0x0654, "Electrotecnica Arteche Smart Grid, Spain" }, // ART
+    { 0x3dd3, "ONUR Elektroteknik, Turkey" }, // ONS
+    { 0x102e, "Danubia" }, // DAN
+    { 0x15b3, "EMS PATVAG, Switzerland" }, // EMS
+    { 0x3c43, "shandong oubiao information Technology, China" }, // OBC
+    { 0x2264, "Ningbo Histar Meter Technology, China" }, // HSD
+    { 0x356c, "MAKEL Elektrik Malzemeleri, Turkey" }, // MKL
+    { 0x14c1, "EFACEC Engenharia e Sistemas, Portugal" }, // EFA
+    { 0x1c34, "GEPDEC SMART TECHNOLOGY, India" }, // GAT
+    { 0x31ac, "LUMEL, Poland" }, // LML
+    { 0x35d7, "MENOWATT GE, Italy" }, // MNW
+    { 0x3428, "MAHAM ELECTRONIC SAMA SANAT" }, // MAH
+    { 0x3613, "Multiprocessor Systems, Bulgaria" }, // MPS
+    { 0x3825, "Nanjing NengRui Automation Equipment, China" }, // NAE
+    { 0x168f, "Sphere of economical technologies, Russian Federation" }, // ETO
+    { 0x5930, "VIPA CZ, Czech Republic" }, // VIP
+    { 0x6a01, "ZPA Smart Energy, Czech Republic" }, // ZPA
+    { 0x0661, "Asac, Italy" }, // ASA
+    { 0x5123, "TOKYO KEISO, Japan" }, // TIC
+    { 0x2493, "IDS, Germany" }, // IDS
+    { 0x0443, "Paya Energy" }, // ABC
+    { 0x1725, "Eco eye, United Kingdom" }, // EYE
+    { 0x30f3, "Landis Gyr, South Africa" }, // LGS
+    { 0x4dd4, "SensorNet, Italy" }, // SNT
+    { 0x1833, "FAST, Italy" }, // FAS
+    { 0x2af3, "Wesson energy saving technology tianjin, China" }, // JWS
+    { 0x4c43, "Saia Burgess Controls, Switzerland" }, // SBC
+    { 0x0518, "Sepanta Electronic Tabarestan, Iran" }, // AHX
+    { 0x04f4, "Agnitio Technologies, India" }, // AGT
+    { 0x4e74, "Qingdao Haina Electric Automation Systems, China" }, // SST
+    { 0x1665, "ESE Nordic, Sweden" }, // ESE
+    { 0x2c4e, "Alpamis IT, Turkey" }, // KBN
+    { 0x0962, "Boendekomfort, Sweden" }, // BKB
+    { 0x4203, "Power Plus Communications, Germany" }, // PPC
+    { 0x1690, "Energotechnica" }, // ETP
+    { 0x5c28, "WAHESOFT, Germany" }, // WAH
+    { 0x2729, "KAYI ENERGY Hacettepe Universitesi, Turkey" }, // IYI
+    { 0x34a4, "MAHARASHTRA STATE ELECTRICITY DISTRIBUTION COMPANY, India" }, // MED
+    { 0x10a3, "DECODE Data Communications, Serbia" }, // DEC
+    { 0x08a1, "Baer Energy Automation, Germany" }, // BEA
+    { 0x4e67, "Super Star Electronics, Bangladesh" }, // SSG
+    { 0x04ad, "S C AEM, Romania" }, // AEM
+    { 0x4292, "Pfiffner Transformatoer, Turkey" }, // PTR
+    { 0x2686, "ITF Froeschl, Germany" }, // ITF
+    { 0x0d85, "Shen Zhen Clou Electronics, China" }, // CLE
+    { 0x2c8e, "KADEN VODOMERY, Czech Republic" }, // KDN
+    { 0x108c, "DONGDO LMS, South Korea" }, // DDL
+    { 0x0db3, "CMS Computers" }, // CMS
+    { 0x49b2, "Advanced Technology RAMAR, United Kingdom" }, // RMR
+    { 0x3592, "PKK Milandr, Russian Federation" }, // MLR
+    { 0x4d90, "Sylop spolka z ograniczona odpowiedzialnoscia sp k, Poland" }, // SLP
+    { 0x4de7, "Sogecam Industrial, Spain" }, // SOG
+    { 0x04e5, "AccessGate, Sweden" }, // AGE
+    { 0x1995, "SHANDONG FEILONG INSTRUMENT, China" }, // FLU
+    { 0x0498, "ADD Production, Moldova" }, // ADX
+    { 0x10ed, "Diehl Gas Metering, Germany" }, // DGM
+    { 0x11a3, "DMC International, United Arab Emirates" }, // DMC
+    { 0x1af3, "FW Systeme, Germany" }, // FWS
+    { 0x4d74, "SkyToll, Slovakia" }, // SKT
+    { 0x3c33, "Omni Agate Systems, India" }, // OAS
+    { 0x1609, "EPI USE AFRICA, South Africa" }, // EPI
+    { 0x68ae, "ZenMeter Solutions, India" }, // ZEN
+    { 0x0467, "Actaris Gas, France" }, // ACG
+    { 0x5686, "UtiliFlex, United States of America" }, // UTF
+    { 0x31cb, "Loenk F, South Korea" }, // LNK
+    { 0x3b27, "Ningbo Yonggang Instrument, China" }, // NYG
+    { 0x0596, "Alvicom, Hungary" }, // ALV
+    { 0x1210, "DECCAN POWER PRODUCTS, India" }, // DPP
+    { 0x29b4, "JM TRONIC, Poland" }, // JMT
+    { 0x3e61, "Osaki Electric Europe, Japan" }, // OSA
+    { 0x21a9, "HMI Energy, Taiwan" }, // HMI
+    { 0x31c3, "Lancier Monitoring, Germany" }, // LNC
+    { 0x2462, "Inscobee, South Korea" }, // ICB
+    { 0x4c30, "Sappel" }, // SAP
+    { 0x0d74, "CKT Elektrik Elektronik Sanayi ve Ticaret, Turkey" }, // CKT
+    { 0x3270, "Landis Gyr, Germany" }, // LSP
+    { 0x0a70, "Byucksan Power, South Korea" }, // BSP
+    { 0x58b3, "Viterra Energy Services" }, // VES
+    { 0x0f4d, "Cazzaniga" }, // CZM
+    { 0x0c81, "Centre for Development of Advanced Computing, India" }, // CDA
+    { 0x0d03, "CHUN IL INSTRUMENT, South Korea" }, // CHC
+    { 0x2099, "Dalian hundao instrument, China" }, // HDY
+    { 0x1dad, "Gamma International, Egypt" }, // GMM
+    { 0x4ced, "Swiss Gas Metering, Switzerland" }, // SGM
+    { 0x0da3, "CMC EKOCON, Slovenia" }, // CMC
+    { 0x4dac, "Siemens Measurements" }, // SML
+    { 0x198f, "Flonidan, Denmark" }, // FLO
+    { 0x1645, "Enermatics Energy, South Africa" }, // ERE
+    { 0x29f9, "Zhejiang Joy Electronic Technology, China" }, // JOY
+    { 0x282e, "Janitza electronics, Germany" }, // JAN
+    { 0x25cd, "Inepro Metering, Netherlands" }, // INM
+    { 0x3a14, "CJSC PROGTECH, Russian Federation" }, // NPT
+    { 0x352a, "MAXWELL, India" }, // MIJ
+    { 0x1254, "DRESSER Italia, Italy" }, // DRT
+    { 0x4e1a, "SPowerZ Solutions, India" }, // SPZ
+    { 0x182e, "Fantini Cosmi, Italy" }, // FAN
+    { 0x2d0c, "Kohler, Turkey" }, // KHL
+    { 0x0a81, "Buta Elektromekanik, Turkey" }, // BTA
+    { 0x49a1, "Mess und Regeltechnik, Germany" }, // RMA
+    { 0x4e9a, "Steinbeis Innovation Center Embedded Design and Networking, Germany" }, // STZ
+    { 0x15cc, "ENEL, Serbia" }, // ENL
+    { 0x1da5, "Global Metering Electronics, Netherlands" }, // GME
+    { 0x6505, "Youho Electric, South Korea" }, // YHE
+    { 0x6936, "ZIV Aplicaciones y Tecnologia" }, // ZIV
+    { 0x14a5, "3E, Italy" }, // EEE
+    { 0x14b3, "Eletra Industria e Comercio de Medidores Eletricos, Brazil" }, // EES
+    { 0x68b8, "ZEXON ENERGY, India" }, // ZEX
+    { 0x0590, "Alphion, India" }, // ALP
+    { 0x262f, "Kwhiq, Netherlands" }, // IQO
+    { 0x32f4, "Lotus Wireless Technologies, India" }, // LWT
+    { 0x48a6, "REFERANS ELEKTRIK SAYACLARI, Turkey" }, // REF
+    { 0x4865, "RC ENERGY METERING, India" }, // RCE
+    { 0x5e89, "Weihai Sunts Electric Meter, China" }, // WTI
+    { 0x04d8, "Alflex Products, Netherlands" }, // AFX
+    { 0x4c77, "ScatterWeb, Germany" }, // SCW
+    { 0x5074, "Tecnotel, Italy" }, // TCT
+    { 0x5265, "Nichi Manufacturing, India" }, // TSE
+    { 0x2661, "Isabellenhutte Heusler, Germany" }, // ISA
+    { 0x4ca9, "Sicom Electronics International, Chile" }, // SEI
+    { 0x0e8c, "Cyan Technology, United Kingdom" }, // CTL
+    { 0x2a6d, "Jining Goldwater Science Technology, China" }, // JSM
+    { 0x1e85, "GREATech, Germany" }, // GTE
+    { 0x20c9, "Nanjing Hu Measurement Control Technology, China" }, // HFI
+    { 0x3b10, "NXP Semiconductors, Netherlands" }, // NXP
+    { 0x512c, "Thermal Integration, United Kingdom" }, // TIL
+    { 0x31a7, "Luftmeister, Germany" }, // LMG
+    { 0x4d6b, "Shikoku Instrumentation, Japan" }, // SKK
+    { 0x09a5, "Beifeng, Germany" }, // BME
+    { 0x1592, "Elster Metering, United Kingdom" }, // ELR
+    { 0x19a7, "Flow Meter Group, Netherlands" }, // FMG
+    { 0x488b, "Wuhan Radarking Electronics, China" }, // RDK
+    { 0x062c, "Aqualoc, South Africa" }, // AQL
+    { 0x4ca8, "SAMRAKSHANA ELECTRICALS, India" }, // SEH
+    { 0x4d2d, "Sana Intelligent Meter, Iran" }, // SIM
+    { 0x1981, "FLASH ELECTRONICS, India" }, // FLA
+    { 0x4cd4, "Sotflink, Czech Republic" }, // SFT
+    { 0x30a3, "Lectrotek Systems, India" }, // LEC
+    { 0x3688, "njmeter, China" }, // MTH
+    { 0x1e50, "GlobalRnD, Poland" }, // GRP
+    { 0x2c2c, "Kallenbach Elektronik" }, // KAL
+    { 0x5267, "Testo Sensor, Germany" }, // TSG
+    { 0x21b3, "Hermes Systems, Australia" }, // HMS
+    { 0x3424, "Maddalena, Italy" }, // MAD
+    { 0x6827, "Zellweger Uster, Switzerland" }, // ZAG
+    { 0x6a49, "ZENNER International, Germany" }, // ZRI
+    { 0x22e3, "Qingdao Hiwits Meter, China" }, // HWC
+    { 0x4d71, "SKI sherkate kontorsazi, Iran" }, // SKQ
+    { 0x0486, "ADFweb com, Italy" }, // ADF
+    { 0x5a87, "vemm tec Messtechnik" }, // VTG
+    { 0x504e, "TBEA Nanjing Intelligent Electric, China" }, // TBN
+    { 0x0e44, "CRDM DEVELOPPEMENTS, France" }, // CRD
+    { 0x20ab, "Hexing Technology Company, Kenya" }, // HEK
+    { 0x0865, "ShenZhen B C Electronic, China" }, // BCE
+    { 0x28e6, "Janz Contagem e Gestao de Fluidos, Portugal" }, // JGF
+    { 0x2253, "HomeRider, France" }, // HRS
+    { 0x4492, "Quadrar Tecnologia, Brazil" }, // QDR
+    { 0x1274, "Shenzhen Donsun Technology, China" }, // DST
+    { 0x4052, "PFIFFNER do Brasil, Brazil" }, // PBR
+    { 0x31a3, "Lumacol, Slovakia" }, // LMC
+    { 0x28e4, "tianjin guangdaweiye measuring instrument technology, China" }, // JGD
+    { 0x5264, "Theobroma Systems Design und Consulting, Austria" }, // TSD
+    { 0x3529, "Apator Miitors ApS, Denmark" }, // MII
+    { 0x15b5, "EMU Elektronik, Switzerland" }, // EMU
+    { 0x388d, "Northern Design, United Kingdom" }, // NDM
+    { 0x50af, "ubitricity Gesellschaft fur verteilte Energiesysteme mbH, Germany" }, // TEO
+    { 0x0833, "BASIC INTELLIGENCE TECHNOLOGY, China" }, // BAS
+    { 0x2681, "iTrona, Switzerland" }, // ITA
+    { 0x1101, "Shanghai dahua measuring auto control instruments manufactory, China" }, // DHA
+    { 0x1ee9, "George Wilson Industries Aldermans Green Industrial Estate, United Kingdom" }, // GWI
+    { 0x42ab, "Paktim Consulting UK, United Kingdom" }, // PUK
+    { 0x4dae, "Saiman Corporation, Kazakhstan" }, // SMN
+    { 0x5249, "Tritech Technology, Sweden" }, // TRI
+    { 0x4e6e, "Silver Spring Networks, United States of America" }, // SSN
+    { 0x14af, "Eppeltone Engineers, India" }, // EEO
+    { 0x1924, "Fi Muhendislik, Turkey" }, // FID
+    { 0x5e65, "Wasion Group, China" }, // WSE
+    { 0x0a54, "BEREKET TEKNOLOJIK OELCUM SISTEMLERI BIL ELK INS ITH IHR SAN VE TIC STI, Turkey" }, // BRT
+    { 0x507a, "Tianjin Chuangzhan Tongcheng Technology Development, China" }, // TCZ
+    { 0x1b4b, "FUNZIN, South Korea" }, // FZK
+    { 0x058b, "Actislink, Poland" }, // ALK
+    { 0x312e, "Ever Meter, Myanmar" }, // LIN
+    { 0x04a1, "Abam Electronic Alborz, Iran" }, // AEA
+    { 0x08a6, "BEFEGA, Germany" }, // BEF
+    { 0x1ca5, "GE Energy, United Kingdom" }, // GEE
+    { 0x36e9, "Magic Wand Intelligent Systems, India" }, // MWI
+    { 0x4934, "Ritz Instrument Transformers, Germany" }, // RIT
+    { 0x4c68, "Schinzel" }, // SCH
+    { 0x4c74, "S I C E Telecomunicazioni, Italy" }, // SCT
+    { 0x3c8b, "Okinawa Denki Kogyo, Japan" }, // ODK
+    { 0x3067, "Landis Gyr Meter System Zhuhai, China" }, // LCG
+    { 0x1125, "Dielen, Germany" }, // DIE
+    { 0x564d, "Urmet Telecomunicazioni, Italy" }, // URM
+    { 0x1591, "ELEQ, Germany" }, // ELQ
+    { 0x42e2, "Paul Wegener, Germany" }, // PWB
+    { 0x4085, "Pfiffner Deutschland, Germany" }, // PDE
+    { 0x49eb, "ROKIP Liability Company, Russian Federation" }, // ROK
+    { 0x22d4, "Helvatron, Switzerland" }, // HVT
+    { 0x1c67, "Goldcard Smart Group, China" }, // GCG
+    { 0x6673, "Yellowstone Soft, Germany" }, // YSS
+    { 0x2333, "Hydrelis" }, // HYS
+    { 0x05b4, "INTEGRA METERING" }, // AMT
+    { 0x6b5a, "Michael Rac, Germany" }, // ZZZ
+    { 0x3423, "RUDNAP Group Meter Control, Serbia" }, // MAC
+    { 0x41fa, "ZEUP Pozyton, Poland" }, // POZ
+    { 0x30d3, "Payolcer Metering Devices, Turkey" }, // LFS
+    { 0x5247, "Trench, Germany" }, // TRG
+    { 0x0cad, "YAVUZ METAL SANAYI VE TICARET, Turkey" }, // CEM
+    { 0x364e, "LLC RPC MEtRON, Ukraine" }, // MRN
+    { 0x0cac, "Creative Electronics, Pakistan" }, // CEL
+    { 0x655a, "Zhuhai Yujian Science Technology, China" }, // YJZ
+    { 0x4cf8, "Gao Xiang Water Meter, China" }, // SGX
+    { 0x520c, "Teplocom Holding, Russian Federation" }, // TPL
+    { 0x1424, "EAD Energieabrechnungssysteme" }, // EAD
+    { 0x4d36, "Sieverding Heizungs und Sanitaertechnik, Germany" }, // SIV
+    { 0x4da5, "Siame, Tunisia" }, // SME
+    { 0x26eb, "IWK Regler und Kompensatoren" }, // IWK
+    { 0x34a9, "Sensus Metering Systems, Germany" }, // MEI
+    { 0x4d82, "Schlumberger Industries, France" }, // SLB
+    { 0x2e83, "Kerman Tablo, Iran" }, // KTC
+    { 0x4c23, "Sacofgas, Italy" }, // SAC
+    { 0x25c5, "INNOTAS Elektronik, Germany" }, // INE
+    { 0x0f29, "QUANZHOU CHIYOUNG INSTRUMENT, China" }, // CYI
+    { 0x1583, "CJSC EMIS, Russian Federation" }, // ELC
+    { 0x0641, "Aranha, United Kingdom" }, // ARA
+    { 0x4245, "Predicate Software, South Africa" }, // PRE
+    { 0x424d, "Promatic, Croatia" }, // PRM
+    { 0x2327, "Hydrometer Group, Germany" }, // HYG
+    { 0x24a5, "I E Electromatic, Spain" }, // IEE
+    { 0x5a8e, "VITEX NOVA, Ukraine" }, // VTN
+    { 0x0618, "Amplex, Denmark" }, // APX
+    { 0x2865, "Janz Contadores de Energia, Portugal" }, // JCE
+    { 0x2e74, "Kundo SystemTechnik" }, // KST
+    { 0x0b24, "BYD Company, China" }, // BYD
+    { 0x0484, "ADD Production, Moldova" }, // ADD
+    { 0x4e69, "Security Solutions Institute, Bulgaria" }, // SSI
+    { 0x54ac, "united electrical industries, India" }, // UEL
+    { 0x2065, "Hsiang Cheng Electric, China" }, // HCE
+    { 0x4de6, "Softflow de, Germany" }, // SOF
+    { 0x4136, "Pivot Access, Rwanda" }, // PIV
+    { 0x352d, "n Intelligence Meters Sdn Bhd, Malaysia" }, // MIM
+    { 0x5255, "Truteq Wireless, South Africa" }, // TRU
+    { 0x2698, "IDEAL TECHNICAL SOLUTIONS, United Arab Emirates" }, // ITX
+    { 0x4d33, "Sevme Informatique Service, France" }, // SIS
+    { 0x0733, "Euromet Stl, Turkey" }, // AYS
+    { 0x1e73, "R D Gran System S, Belarus" }, // GSS
+    { 0x21f9, "Holley Meters, India" }, // HOY
+    { 0x220c, "HPL Socomec, India" }, // HPL
+    { 0x1e74, "Shenzhen Golden Square Technology, China" }, // GST
+    { 0x4247, "Paud Raad Industrial Group, Iran" }, // PRG
+    { 0x15b4, "Elster Messtechnik, Germany" }, // EMT
+    { 0x6b22, "WEIHAI ZHENYU INTELL TECH, China" }, // ZYB
+    { 0x0e63, "CHUBUSEIKI, Japan" }, // CSC
+    { 0x22ab, "Helbeck Kusemann, Germany" }, // HUK
+    { 0x51a5, "TECHNO METERS ELECTRONICS, India" }, // TME
+    { 0x0a8c, "BIT LAB" }, // BTL
+    { 0x18ad, "Fortune Electric, Taiwan" }, // FEM
+    { 0x51ab, "Timi Kosova Sh p k" }, // TMK
+    { 0x502e, "Tianxin instrument group, China" }, // TAN
+    { 0x1584, "Elektromed Elektronik, Turkey" }, // ELD
+    { 0x14c5, "Engelmann Sensor, Germany" }, // EFE
+    { 0x4493, "Qundis, Germany" }, // QDS
+    { 0x0e98, "Contronix, Germany" }, // CTX
+    { 0x52b2, "TURKSAY ELEKTRONIK ELEKTRIK ENDUSTRISI" }, // TUR
+    { 0x352c, "Milur Smart System liability company, Russian Federation" }, // MIL
+    { 0x06b8, "Ningbo Sanxing Smart Electric, China" }, // AUX
+    { 0x25a3, "madar, Iran" }, // IMC
+    { 0x148d, "EDMI" }, // EDM
+    { 0x1c93, "InnoSense, Switzerland" }, // GDS
+    { 0x3f2b, "GULLWING TIANJIN INDUSTRY DEVELOPMENGT, China" }, // OYK
+    { 0x4c27, "Sagemcom Energy Telecom, France" }, // SAG
+    { 0x4d69, "S K I, Germany" }, // SKI
+    { 0x146f, "Engie BtoC Smart program, France" }, // ECO
+    { 0x2683, "INTECH TUNISIE, Tunisia" }, // ITC
+    { 0x08ac, "Belassitsa AD, Bulgaria" }, // BEL
+    { 0x3485, "Diehl Metering Deutschland, Germany" }, // MDE
+    { 0x4e6d, "SCC METERS, Bangladesh" }, // SSM
+    { 0x0592, "Algorab, Italy" }, // ALR
+    { 0x520a, "TAKAHATA PRECISION, Japan" }, // TPJ
+    { 0x15d0, "Kiev Polytechnical Scientific Research" }, // ENP
+    { 0x210d, "Chongqing Huahong Metering, China" }, // HHM
+    { 0x348c, "Maddalena, Italy" }, // MDL
+    { 0x1825, "Fae Technology Company, Brazil" }, // FAE
+    { 0x35a3, "Modern Meters, Syria" }, // MMC
+    { 0x412e, "PFIFFNER Instr Transformers, India" }, // PIN
+    { 0x3ae7, "NINGBO WASSER GERAETE, China" }, // NWG
+    { 0x0ab2, "Bopp und Reuther Messtechnik, Germany" }, // BUR
+    { 0x3b07, "nexgen consultancy, India" }, // NXG
+    { 0x4da7, "Samgas, Italy" }, // SMG
+    { 0x16cc, "Geothermique, United Kingdom" }, // EVL
+    { 0x0465, "Actaris Electricity, France" }, // ACE
+    { 0x4eed, "Smart Water Metering, Canada" }, // SWM
+    { 0x0ee9, "Cewe Instrument, Sweden" }, // CWI
+    { 0x0dcd, "COSTEL, South Korea" }, // CNM
+    { 0x612f, "XIOTA, India" }, // XIO
+    { 0x1ab4, "first utility, United Kingdom" }, // FUT
+    { 0x5203, "Taipit measuring equipment, Russian Federation" }, // TPC
+    { 0x492d, "CJSC Radio and Microelectronics, Russian Federation" }, // RIM
+    { 0x40c9, "PFIFFNER Instrument Transformers, Switzerland" }, // PFI
+    { 0x4db3, "Smart Metering Solutions Changsha, China" }, // SMS
+    { 0x0a6d, "Bluestar Electrical Meter Research Institute, China" }, // BSM
+    { 0x2565, "IK Elektronik Friedrichsgruener Str, Germany" }, // IKE
+    { 0x1672, "Ensor, Switzerland" }, // ESR
+    { 0x158f, "ELO Sistemas Eletronicos, Brazil" }, // ELO
+};
+
+#endif
@@ -15,6 +15,7 @@
  along with this program.  If not, see <http://www.gnu.org/licenses/>.
 */
 
+#include"cbor.h"
 #include"meters.h"
 #include"meters_common_implementation.h"
 #include"units.h"
@@ -27,83 +28,176 @@
 #include<memory.h>
 #include<numeric>
 #include<stdexcept>
+#include<string.h>
 #include<time.h>
 
-std::map<std::string, DriverInfo> *registered_drivers_ = NULL;
-std::vector<DriverInfo*> *registered_drivers_list_ = NULL;
+#include "esphome/core/defines.h"
 
-void verifyDriverLookupCreated()
+#define X(id) extern const DriverInfo driver_info_##id;
+WMBUS_DRIVER_LIST
+#undef X
+
+// The table of compiled in drivers is constant data, it is not built at boot.
+static const DriverInfo *const registered_drivers_[] =
+{
+#define X(id) &driver_info_##id,
+WMBUS_DRIVER_LIST
+#undef X
+};
+
+// Open addressing hash tables over the constant driver table. They are built on first use
+// and map driver names/aliases and detection triples to drivers. Linear probing keeps
+// entries with the same key in table order, so the first match is the same driver
+// that a linear scan over allDrivers() would have found.
+struct DriverIndex
 {
-    if (registered_drivers_ == NULL)
+    struct NameSlot
     {
-        registered_drivers_ = new std::map<std::string,DriverInfo>;
-    }
-    if (registered_drivers_list_ == NULL)
+        uint32_t hash;
+        const char *name;
+        const DriverInfo *driver;
+    };
+
+    struct DetectSlot
     {
-        registered_drivers_list_ = new std::vector<DriverInfo*>;
+        uint32_t key;
+        const DriverInfo *driver;
+    };
+
+    std::vector<NameSlot> names;
+    std::vector<DetectSlot> detections;
+
+    DriverIndex();
+
+    void addName(const char *name, const DriverInfo *di);
+    void addDetection(uint32_t key, const DriverInfo *di);
+};
+
+static uint32_t hashDriverName(const char *s, size_t len)
+{
+    // FNV-1a
+    uint32_t h = 2166136261u;
+    for (size_t i = 0; i < len; i++)
+    {
+        h = (h ^ (uchar)s[i]) * 16777619u;
     }
+    return h;
+}
+
+static uint32_t hashDetectionKey(uint32_t key)
+{
+    return key * 2654435761u;
+}
+
+static uint32_t detectionKey(uint16_t mfct, uchar type, uchar version)
+{
+    // Some weird meters (aptor08 and itronheat) send a mfct where the first character is lower case,
+    // which results in mfct which are bigger than 32767, therefore restrict mfct to correct range.
+    return ((uint32_t)(mfct & 0x7fff) << 16) | ((uint32_t)type << 8) | version;
 }
 
-DriverInfo *lookupDriver(std::string name)
+static size_t hashTableSize(size_t entries)
 {
-    verifyDriverLookupCreated();
+    // Keep the load factor at or below 50%.
+    size_t size = 16;
+    while (size < entries * 2) size *= 2;
+    return size;
+}
 
-    // Check if we have a compiled/loaded driver available.
-    if (registered_drivers_->count(name) == 1)
+DriverIndex::DriverIndex()
+{
+    size_t num_names = 0;
+    size_t num_detections = 0;
+    for (const DriverInfo *di : allDrivers())
     {
-        return &(*registered_drivers_)[name];
+        num_names += 1 + di->nameAliases().size();
+        num_detections += di->detect().size();
     }
 
-    // No, ok lets look for driver aliases.
-    for (DriverInfo *di : *registered_drivers_list_)
+    names.resize(hashTableSize(num_names));
+    detections.resize(hashTableSize(num_detections));
+
+    // Insert all names before the aliases, a driver name always wins over an alias.
+    for (const DriverInfo *di : allDrivers())
     {
-        for (DriverName &dn : di->nameAliases())
+        addName(di->nameCStr(), di);
+    }
+    for (const DriverInfo *di : allDrivers())
+    {
+        for (const char *alias : di->nameAliases())
         {
-            if (dn.str() == name)
-            {
-                return di;
-            }
+            addName(alias, di);
+        }
+        for (auto &dd : di->detect())
+        {
+            if (dd.mfct == 0 && dd.type == 0 && dd.version == 0) continue; // Ignore drivers with no detection.
+            addDetection(detectionKey(dd.mfct, dd.type, dd.version), di);
         }
     }
-
-    return NULL;
 }
 
-std::vector<DriverInfo*> &allDrivers()
+void DriverIndex::addName(const char *name, const DriverInfo *di)
 {
-    return *registered_drivers_list_;
+    uint32_t hash = hashDriverName(name, strlen(name));
+    size_t mask = names.size() - 1;
+    size_t i = hash & mask;
+    while (names[i].driver != NULL) i = (i + 1) & mask;
+    names[i] = { hash, name, di };
 }
 
-void removeDriver(const std::string &name)
+void DriverIndex::addDetection(uint32_t key, const DriverInfo *di)
 {
-    for (auto i = registered_drivers_list_->begin(); i != registered_drivers_list_->end(); i++)
+    size_t mask = detections.size() - 1;
+    size_t i = hashDetectionKey(key) & mask;
+    for (; detections[i].driver != NULL; i = (i + 1) & mask)
     {
-        if ((*i)->name().str() == name)
-        {
-            registered_drivers_list_->erase(i);
-            break;
-        }
+        // Rows that only differ in the lower case mfct bit map to the same key, a driver is detected once.
+        if (detections[i].key == key && detections[i].driver == di) return;
     }
+    detections[i] = { key, di };
+}
 
-    registered_drivers_->erase(name);
-    assert(registered_drivers_->count(name) == 0);
+static DriverIndex &driverIndex()
+{
+    static DriverIndex index;
+    return index;
 }
 
-void addRegisteredDriver(DriverInfo di)
+// Invoke f for each driver that detects the mfct/type/version, in driver table order, until f returns true.
+template<typename F>
+static void forEachDetectedDriver(uint16_t mfct, uchar type, uchar version, F f)
 {
-    verifyDriverLookupCreated();
-    if (registered_drivers_->count(di.name().str()) != 0)
+    std::vector<DriverIndex::DetectSlot> &detections = driverIndex().detections;
+    uint32_t key = detectionKey(mfct, type, version);
+    size_t mask = detections.size() - 1;
+    for (size_t i = hashDetectionKey(key) & mask; detections[i].driver != NULL; i = (i + 1) & mask)
     {
-        error("Two drivers trying to register the name \"%s\"\n", di.name().str().c_str());
-        exit(1);
+        if (detections[i].key == key && f(detections[i].driver)) return;
     }
+}
+
+const DriverInfo *lookupDriver(const std::string &name)
+{
+    std::vector<DriverIndex::NameSlot> &names = driverIndex().names;
+    uint32_t hash = hashDriverName(name.data(), name.size());
+    size_t mask = names.size() - 1;
+    for (size_t i = hash & mask; names[i].driver != NULL; i = (i + 1) & mask)
+    {
+        if (names[i].hash == hash && name == names[i].name)
+        {
+            return names[i].driver;
+        }
+    }
+
+    return NULL;
+}
 
-    (*registered_drivers_)[di.name().str()] = di;
-    // The list elements points into the map.
-    (*registered_drivers_list_).push_back(lookupDriver(di.name().str()));
+ConstArray<const DriverInfo*> allDrivers()
+{
+    return registered_drivers_;
 }
 
-bool DriverInfo::detect(uint16_t mfct, uchar type, uchar version)
+bool DriverInfo::detect(uint16_t mfct, uchar type, uchar version) const
 {
     for (auto &dd : detect_)
     {
@@ -116,7 +210,7 @@ bool DriverInfo::detect(uint16_t mfct, uchar type, uchar version)
     return false;
 }
 
-bool DriverInfo::isValidMedia(uchar type)
+bool DriverInfo::isValidMedia(uchar type) const
 {
     for (auto &dd : detect_)
     {
@@ -125,11 +219,7 @@ bool DriverInfo::isValidMedia(uchar type)
     return false;
 }
 
-DriverInfo::~DriverInfo()
-{
-}
-
-bool DriverInfo::isCloseEnoughMedia(uchar type)
+bool DriverInfo::isCloseEnoughMedia(uchar type) const
 {
     for (auto &dd : detect_)
     {
@@ -138,74 +228,10 @@ bool DriverInfo::isCloseEnoughMedia(uchar type)
     return false;
 }
 
-bool forceRegisterDriver(function<void(DriverInfo&)> setup)
-{
-    DriverInfo di;
-    setup(di);
-
-    // Check that the driver name has not been registered before!
-    assert(lookupDriver(di.name().str()) == NULL);
-
-    // Check that no other driver also triggers on the same detection values.
-    for (auto &d : di.detect())
-    {
-        for (DriverInfo *p : allDrivers())
-        {
-            bool foo = p->detect(d.mfct, d.type, d.version);
-            if (foo)
-            {
-                error("Internal error: driver %s tried to register the same auto detect combo as driver %s alread has taken!\n",
-                      di.name().str().c_str(), p->name().str().c_str());
-            }
-        }
-    }
-
-    // Everything looks, good install this driver.
-    addRegisteredDriver(di);
-
-    // This code is invoked from the static initializers of DriverInfos when starting
-    // wmbusmeters. Thus we do not yet know if the user has supplied --debug or similar setting.
-    // To debug this you have to uncomment the printf below.
-    // fprintf(stderr, "(STATIC) added driver: %s\n", n.c_str());
-    return true;
-}
-
-bool registerDriver(function<void(DriverInfo&)> setup)
-{
-    DriverInfo di;
-    setup(di);
-
-    // Check that the driver name has not been registered before!
-    assert(lookupDriver(di.name().str()) == NULL);
-
-    // Check that no other driver also triggers on the same detection values.
-    for (auto &d : di.detect())
-    {
-        for (DriverInfo *p : allDrivers())
-        {
-            bool foo = p->detect(d.mfct, d.type, d.version);
-            if (foo)
-            {
-                error("Internal error: driver %s tried to register the same auto detect combo as driver %s alread has taken!\n",
-                      di.name().str().c_str(), p->name().str().c_str());
-            }
-        }
-    }
-
-    // Everything looks, good install this driver.
-    addRegisteredDriver(di);
-
-    // This code is invoked from the static initializers of DriverInfos when starting
-    // wmbusmeters. Thus we do not yet know if the user has supplied --debug or similar setting.
-    // To debug this you have to uncomment the printf below.
-    // fprintf(stderr, "(STATIC) added driver: %s\n", n.c_str());
-    return true;
-}
-
 bool lookupDriverInfo(const std::string& driver_name, DriverInfo *out_di)
 {
-    // Lookup an already loaded driver, it might be compiled in as well.
-    DriverInfo *di = lookupDriver(driver_name);
+    // Lookup a compiled in driver.
+    const DriverInfo *di = lookupDriver(driver_name);
     if (di)
     {
         if (out_di) *out_di = *di;
@@ -216,14 +242,14 @@ bool lookupDriverInfo(const std::string& driver_name, DriverInfo *out_di)
 }
 
 MeterCommonImplementation::MeterCommonImplementation(MeterInfo &mi,
-                                                     DriverInfo &di) :
+                                                     const DriverInfo &di) :
     type_(di.type()),
     driver_name_(di.name()),
     driver_info_(&di),
     bus_(mi.bus),
     name_(mi.name),
-    mfct_tpl_status_bits_(di.mfctTPLStatusBits()),
     has_process_content_(di.hasProcessContent()),
+    skip_unchanged_payloads_(di.skipsUnchangedPayloads()),
     more_records_follow_(false)
 {
     address_expressions_ = mi.address_expressions;
@@ -234,6 +260,8 @@ MeterCommonImplementation::MeterCommonImplementation(MeterInfo &mi,
     if (mi.key.length() > 0)
     {
         hex2bin(mi.key, &meter_keys_.confidentiality_key);
+        // Expand the key schedule now instead of when the first telegram arrives.
+        meter_keys_.confidentialityContext();
     }
     for (auto s : mi.shells)
     {
@@ -332,7 +360,7 @@ DriverName MeterCommonImplementation::driverName()
     return driver_name_;
 }
 
-DriverInfo *MeterCommonImplementation::driverInfo()
+const DriverInfo *MeterCommonImplementation::driverInfo()
 {
     return driver_info_;
 }
@@ -616,6 +644,28 @@ int MeterCommonImplementation::numUpdates()
     return num_updates_;
 }
 
+int MeterCommonImplementation::numSkippedExtractions()
+{
+    return num_skipped_extractions_;
+}
+
+// Hash what the field extractors and calculators see: the tpl status and the decrypted
+// payload. The ell/afl counters and the tpl access number live in the header and are left out.
+static uint64_t hashPayload(Telegram *t)
+{
+    // FNV-1a
+    uint64_t h = 14695981039346656037ull;
+    auto add = [&h](uchar b) { h = (h ^ b) * 1099511628211ull; };
+
+    add(t->tpl_ci);
+    add(t->tpl_sts);
+    for (size_t i = t->header_size; i + t->suffix_size < t->frame.size(); i++)
+    {
+        add(t->frame[i]);
+    }
+    return h;
+}
+
 std::string MeterCommonImplementation::datetimeOfUpdateHumanReadable()
 {
     char datetime[40];
@@ -676,7 +726,7 @@ bool MeterCommonImplementation::usesPolling()
 
 bool driverNeedsPolling(DriverName& dn)
 {
-    DriverInfo *di = lookupDriver(dn.str());
+    const DriverInfo *di = lookupDriver(dn.str());
 
     if (di == NULL) return false;
 
@@ -703,7 +753,7 @@ LIST_OF_METER_TYPES
     return MeterType::UnknownMeter;
 }
 
-std::string toString(DriverInfo &di)
+std::string toString(const DriverInfo &di)
 {
     return di.name().str();
 }
@@ -711,7 +761,7 @@ std::string toString(DriverInfo &di)
 bool MeterCommonImplementation::isTelegramForMeter(Telegram *t, Meter *meter, MeterInfo *mi)
 {
     std::string name;
-    std::vector<AddressExpression> address_expressions;
+    std::vector<AddressExpression> *address_expressions;
     std::string driver_name;
 
     assert((meter && !mi) ||
@@ -720,26 +770,25 @@ bool MeterCommonImplementation::isTelegramForMeter(Telegram *t, Meter *meter, Me
     if (meter)
     {
         name = meter->name();
-        address_expressions = meter->addressExpressions();
+        address_expressions = &meter->addressExpressions();
         driver_name = meter->driverName().str();
     }
     else
     {
         name = mi->name;
-        address_expressions = mi->address_expressions;
+        address_expressions = &mi->address_expressions;
         driver_name = mi->driver_name.str();
     }
 
-    // Telegram addresses
-    std::string t_idsc = Address::concat(t->addresses);
-    // Meter/MeterInfo address expressions
-    std::string m_idsc = AddressExpression::concat(address_expressions);
-    debug("(meter) %s: for me? %s in %s\n", name.c_str(), t_idsc.c_str(), m_idsc.c_str());
+    // Telegram addresses in Meter/MeterInfo address expressions
+    debug("(meter) %s: for me? %s in %s\n", name.c_str(),
+          Address::concat(t->addresses).c_str(),
+          AddressExpression::concat(*address_expressions).c_str());
 
 
     bool used_wildcard = false;
     bool match = doesTelegramMatchExpressions(t->addresses,
-                                              address_expressions,
+                                              *address_expressions,
                                               &used_wildcard);
 
     if (!match)
@@ -1021,6 +1070,18 @@ bool MeterCommonImplementation::handleTelegram(AboutTelegram &about, std::vector
     // snprintf(log_prefix, 255, "(%s) log", driverName().str().c_str());
     // logTelegram(t.original, t.frame, t.header_size, t.suffix_size);
 
+    // A repeated payload would extract the same values again, just note that the meter is alive.
+    uint64_t payload_hash = skip_unchanged_payloads_ ? hashPayload(&t) : 0;
+    if (skip_unchanged_payloads_ && has_last_payload_hash_ && payload_hash == last_payload_hash_)
+    {
+        num_skipped_extractions_++;
+        debug("(meter) %s payload unchanged, skipping extraction (%d skipped)\n", name().c_str(), num_skipped_extractions_);
+        t.payload_unchanged = true;
+        triggerUpdate(&t);
+        if (out_analyzed != NULL) *out_analyzed = t;
+        return true;
+    }
+
     // Invoke standardized field extractors!
     processFieldExtractors(&t);
     if (hasProcessContent())
@@ -1038,6 +1099,10 @@ bool MeterCommonImplementation::handleTelegram(AboutTelegram &about, std::vector
 
     triggerUpdate(&t);
 
+    // Only a telegram that updated the fields can stand in for the next one.
+    has_last_payload_hash_ = skip_unchanged_payloads_ && !t.discard;
+    last_payload_hash_ = payload_hash;
+
     if (out_analyzed != NULL) *out_analyzed = t;
     return true;
 }
@@ -1251,11 +1316,12 @@ double MeterCommonImplementation::getNumericValue(FieldInfo *fi, Unit to)
 {
     std::string field_name_no_unit = fi->vname();
     std::pair<std::string,Unit> key(field_name_no_unit,fi->displayUnit());
-    if (numeric_values_.count(key) == 0)
+    auto i = numeric_values_.find(key);
+    if (i == numeric_values_.end())
     {
         return std::numeric_limits<double>::quiet_NaN(); // This is translated into a null in the json.
     }
-    NumericField &nf = numeric_values_[key];
+    NumericField &nf = i->second;
     return convert(nf.value, nf.unit, to);
 }
 
@@ -1431,6 +1497,11 @@ FieldInfo::FieldInfo(int index,
     {
         warning("(meter) field template \"%s\" could not be parsed!\n", vname.c_str());
     }
+
+    vname_with_unit_ = vname_;
+    if (xuantity_ != Quantity::Text) vname_with_unit_ += "_"+unitToStringLowerCase(display_unit_);
+    is_field_name_template_ = vname_.find('{') != std::string::npos;
+    memoize_field_names_ = valid_field_name_ && field_name_->dependsOnlyOnCounters();
 }
 
 std::string FieldInfo::renderJsonOnlyDefaultUnit(Meter *m)
@@ -1443,35 +1514,75 @@ std::string FieldInfo::renderJsonText(Meter *m, DVEntry *dve)
     return renderJson(m, dve);
 }
 
-std::string FieldInfo::generateFieldNameNoUnit(Meter *m, DVEntry *dve)
+static const std::string bad_field_name = "bad_field_name";
+
+const std::string &FieldInfo::generateFieldNameNoUnit(Meter *m, DVEntry *dve)
 {
-    if (!valid_field_name_) return "bad_field_name";
+    if (!valid_field_name_) return bad_field_name;
+    if (!is_field_name_template_) return vname_;
 
-    return field_name_->apply(m, dve);
+    return generateFieldName(m, dve).no_unit;
 }
 
-std::string FieldInfo::generateFieldNameWithUnit(Meter *m, DVEntry *dve)
+const std::string &FieldInfo::generateFieldNameWithUnit(Meter *m, DVEntry *dve)
 {
-    if (!valid_field_name_) return "bad_field_name";
+    if (!valid_field_name_) return bad_field_name;
+    if (!is_field_name_template_) return vname_with_unit_;
 
-    if (xuantity_ == Quantity::Text)
+    return generateFieldName(m, dve).with_unit;
+}
+
+const GeneratedFieldName &FieldInfo::generateFieldName(Meter *m, DVEntry *dve)
+{
+    GeneratedFieldName g;
+    g.has_dve = dve != NULL;
+    if (dve != NULL)
+    {
+        g.storage_nr = dve->storage_nr.intValue();
+        g.tariff_nr = dve->tariff_nr.intValue();
+        g.subunit_nr = dve->subunit_nr.intValue();
+    }
+
+    if (memoize_field_names_)
     {
-        return field_name_->apply(m, dve);
+        for (GeneratedFieldName &p : generated_field_names_)
+        {
+            if (p.has_dve == g.has_dve &&
+                p.storage_nr == g.storage_nr &&
+                p.tariff_nr == g.tariff_nr &&
+                p.subunit_nr == g.subunit_nr) return p;
+        }
     }
 
-    std::string display_unit_s = unitToStringLowerCase(displayUnit());
-    std::string var = field_name_->apply(m, dve);
+    g.no_unit = field_name_->apply(m, dve);
+    g.with_unit = g.no_unit;
+    if (xuantity_ != Quantity::Text) g.with_unit += "_"+unitToStringLowerCase(displayUnit());
+
+    // A meter sending ever new storage numbers must not grow the cache without bounds.
+    if (!memoize_field_names_ || generated_field_names_.size() >= FIELD_NAME_CACHE_SIZE)
+    {
+        uncached_field_name_ = g;
+        return uncached_field_name_;
+    }
 
-    return var+"_"+display_unit_s;
+    generated_field_names_.push_back(g);
+    return generated_field_names_.back();
 }
 
 
 std::string FieldInfo::renderJson(Meter *m, DVEntry *dve)
 {
     std::string s;
+    renderJson(m, dve, &s);
+    return s;
+}
 
-    std::string display_unit_s = unitToStringLowerCase(displayUnit());
-    std::string field_name = generateFieldNameNoUnit(m, dve);
+void FieldInfo::renderJson(Meter *m, DVEntry *dve, std::string *json)
+{
+    // The field name with unit is the json key, for text fields it has no unit.
+    json->push_back('"');
+    json->append(generateFieldNameWithUnit(m, dve));
+    json->append("\":");
 
     if (xuantity() == Quantity::Text)
     {
@@ -1482,37 +1593,44 @@ std::string FieldInfo::renderJson(Meter *m, DVEntry *dve)
             // be translated into "something":null in the json, indicating that there is no value.
             // This should not be a problem for now. Lets deal with it when a meter decides to send "null"
             // as its version std::string for example.
-            s += "\""+field_name+"\":null";
+            json->append("null");
         }
         else
         {
             // Normally the std::string values are quoted in json. TODO quote the value properly.
             // A well crafted meter could send a version std::string with " and break the json format.
-            s += "\""+field_name+"\":\""+v+"\"";
+            json->push_back('"');
+            json->append(v);
+            json->push_back('"');
         }
+        return;
+    }
+
+    const std::string &field_name = generateFieldNameNoUnit(m, dve);
+
+    if (displayUnit() == Unit::DateLT)
+    {
+        json->push_back('"');
+        json->append(strdate(m->getNumericValue(field_name, Unit::DateLT)));
+        json->push_back('"');
+    }
+    else if (displayUnit() == Unit::DateTimeLT)
+    {
+        json->push_back('"');
+        json->append(strdatetime(m->getNumericValue(field_name, Unit::DateTimeLT)));
+        json->push_back('"');
+    }
+    else if (displayUnit() == Unit::DateTimeUTC)
+    {
+        json->push_back('"');
+        json->append(strTimestampUTC(m->getNumericValue(field_name, Unit::DateTimeUTC)));
+        json->push_back('"');
     }
     else
     {
-        if (displayUnit() == Unit::DateLT)
-        {
-            s += "\""+field_name+"_"+display_unit_s+"\":\""+strdate(m->getNumericValue(field_name, Unit::DateLT))+"\"";
-        }
-        else if (displayUnit() == Unit::DateTimeLT)
-        {
-            s += "\""+field_name+"_"+display_unit_s+"\":\""+strdatetime(m->getNumericValue(field_name, Unit::DateTimeLT))+"\"";
-        }
-        else if (displayUnit() == Unit::DateTimeUTC)
-        {
-            s += "\""+field_name+"_"+display_unit_s+"\":\""+strTimestampUTC(m->getNumericValue(field_name, Unit::DateTimeUTC))+"\"";
-        }
-        else
-        {
-            // All numeric values.
-            s += "\""+field_name+"_"+display_unit_s+"\":"+valueToString(m->getNumericValue(field_name, displayUnit()), displayUnit());
-        }
+        // All numeric values.
+        appendValueToString(json, m->getNumericValue(field_name, displayUnit()), displayUnit());
     }
-
-    return s;
 }
 
 void MeterCommonImplementation::createMeterEnv(std::string id,
@@ -1535,6 +1653,28 @@ void MeterCommonImplementation::createMeterEnv(std::string id,
     }
 }
 
+// The media of the innermost layer that carries an id.
+static std::string telegramMedia(Telegram *t)
+{
+    if (t->tpl_id_found)
+    {
+        return mediaTypeJSON(t->tpl_type, t->tpl_mfct);
+    }
+    if (t->ell_id_found)
+    {
+        return mediaTypeJSON(t->ell_type, t->ell_mfct);
+    }
+    return mediaTypeJSON(t->dll_type, t->dll_mfct);
+}
+
+// The "key_field":index line printed after a field of the first telegram, when detailed first is set.
+static std::string detailedFieldRule(const std::string &json, size_t start, int index)
+{
+    size_t pos = json.find("\":", start);
+    if (pos == std::string::npos) return "";
+    return json.substr(start, pos-start)+"_field\":"+std::to_string(index);
+}
+
 void MeterCommonImplementation::printMeter(Telegram *t,
                                            std::string *human_readable,
                                            std::string *fields, char separator,
@@ -1551,19 +1691,7 @@ void MeterCommonImplementation::printMeter(Telegram *t,
     if (fields)
         *fields = concatFields(this, t, separator, field_infos_, false, selected_fields, extra_constant_fields);
 
-    std::string media;
-    if (t->tpl_id_found)
-    {
-        media = mediaTypeJSON(t->tpl_type, t->tpl_mfct);
-    }
-    else if (t->ell_id_found)
-    {
-        media = mediaTypeJSON(t->ell_type, t->ell_mfct);
-    }
-    else
-    {
-        media = mediaTypeJSON(t->dll_type, t->dll_mfct);
-    }
+    std::string media = telegramMedia(t);
 
     std::string id = "";
     if (t->addresses.size() > 0)
@@ -1573,8 +1701,8 @@ void MeterCommonImplementation::printMeter(Telegram *t,
 
     if(json)
     {
-        std::string indent = "";
-        std::string newline = "";
+        const char *indent = "";
+        const char *newline = "";
 
         if (pretty_print_json)
         {
@@ -1582,97 +1710,82 @@ void MeterCommonImplementation::printMeter(Telegram *t,
             newline ="\n";
         }
 
-        std::string s;
-        s += "{"+newline;
-        s += indent+"\"_\":\"telegram\","+newline;
-        s += indent+"\"media\":\""+media+"\","+newline;
-        s += indent+"\"meter\":\""+driverName().str()+"\","+newline;
-        s += indent+"\"name\":\""+name()+"\","+newline;
-        s += indent+"\"id\":\""+id+"\","+newline;
+        // The json is appended piece by piece to the caller's string, which keeps its capacity
+        // when it is reused for the next telegram.
+        std::string &s = *json;
+        s.clear();
+        s += "{"; s += newline;
+        s += indent; s += "\"_\":\"telegram\","; s += newline;
+        s += indent; s += "\"media\":\""; s += media; s += "\","; s += newline;
+        s += indent; s += "\"meter\":\""; s += driverName().str(); s += "\","; s += newline;
+        s += indent; s += "\"name\":\""; s += name(); s += "\","; s += newline;
+        s += indent; s += "\"id\":\""; s += id; s += "\","; s += newline;
 
-        // Iterate over the meter field infos...
-        std::map<FieldInfo*,std::set<DVEntry*>> founds; // Multiple dventries can match to a single field info.
-        std::set<std::string> found_vnames;
+        bool detailed = first && getDetailedFirst();
 
         for (auto &p : numeric_values_)
         {
-            std::string vname = p.first.first;
             NumericField& nf = p.second;
             if (nf.field_info->printProperties().hasHIDE()) continue;
 
-            std::string out = nf.field_info->renderJson(this, &nf.dv_entry);
-            s += indent+out+","+newline;
-
-            if (first && getDetailedFirst())
-            {
-                size_t pos = out.find("\":");
-                if (pos != std::string::npos)
-                {
-                    std::string rule = out.substr(0, pos)+"_field\":"+std::to_string(nf.field_info->index());
-                    s += indent+rule+","+newline;
-                }
-            }
+            s += indent;
+            size_t start = s.size();
+            nf.field_info->renderJson(this, &nf.dv_entry, &s);
+            std::string rule;
+            if (detailed) rule = detailedFieldRule(s, start, nf.field_info->index());
+            s += ","; s += newline;
+            if (rule.length() > 0) { s += indent; s += rule; s += ","; s += newline; }
         }
 
         for (auto &p : string_values_)
         {
-            std::string vname = p.first;
+            const std::string &vname = p.first;
             StringField& sf = p.second;
-            std::string out;
 
             if (sf.field_info->printProperties().hasHIDE()) continue;
+
+            s += indent;
+            size_t start = s.size();
+            s += "\""; s += vname; s += "\":";
             if (sf.field_info->printProperties().hasSTATUS())
             {
-                std::string in = getStatusField(sf.field_info);
-                out = tostrprintf("\"%s\":\"%s\"", vname.c_str(), in.c_str());
-                s += indent+out+","+newline;
+                s += "\""; s += getStatusField(sf.field_info); s += "\"";
             }
-            else
+            else if (sf.value == "null")
             {
-                if (sf.value == "null")
-                {
-                    // The std::string "null" translates to actual json null.
-                    out = tostrprintf("\"%s\":null", vname.c_str());
-                    s += indent+out+","+newline;
-                }
-                else
-                {
-                    out = tostrprintf("\"%s\":\"%s\"", vname.c_str(), sf.value.c_str());
-                    s += indent+out+","+newline;
-                }
+                // The std::string "null" translates to actual json null.
+                s += "null";
             }
-            if (first && getDetailedFirst())
+            else
             {
-                size_t pos = out.find("\":");
-                if (pos != std::string::npos)
-                {
-                    std::string rule = out.substr(0, pos)+"_field\":"+std::to_string(sf.field_info->index());
-                    s += indent+rule+","+newline;
-                }
+                s += "\""; s += sf.value; s += "\"";
             }
+            std::string rule;
+            if (detailed) rule = detailedFieldRule(s, start, sf.field_info->index());
+            s += ","; s += newline;
+            if (rule.length() > 0) { s += indent; s += rule; s += ","; s += newline; }
         }
-        s += indent+"\"timestamp\":\""+datetimeOfUpdateRobot()+"\"";
+        s += indent; s += "\"timestamp\":\""; s += datetimeOfUpdateRobot(); s += "\"";
 
         if (t->about.device != "")
         {
-            s += ","+newline;
-            s += indent+"\"device\":\""+t->about.device+"\","+newline;
-            s += indent+"\"rssi_dbm\":"+std::to_string(t->about.rssi_dbm);
+            s += ","; s += newline;
+            s += indent; s += "\"device\":\""; s += t->about.device; s += "\","; s += newline;
+            s += indent; s += "\"rssi_dbm\":"; s += std::to_string(t->about.rssi_dbm);
         }
-        for (std::string extra_field : meterExtraConstantFields())
+        for (const std::string &extra_field : meterExtraConstantFields())
         {
-            s += ","+newline;
-            s += indent+makeQuotedJson(extra_field);
+            s += ","; s += newline;
+            s += indent; s += makeQuotedJson(extra_field);
         }
         if(extra_constant_fields)
-            for (std::string extra_field : *extra_constant_fields)
+            for (const std::string &extra_field : *extra_constant_fields)
             {
-                s += ","+newline;
-                s += indent+makeQuotedJson(extra_field);
+                s += ","; s += newline;
+                s += indent; s += makeQuotedJson(extra_field);
             }
         s += newline;
         s += "}";
-        *json = s;
     }
 
     if(envs)
@@ -1713,6 +1826,135 @@ void MeterCommonImplementation::printMeter(Telegram *t,
     }
 }
 
+static void cborAppendKey(std::string *cbor, CborTelegramKey key)
+{
+    cborAppendInt(cbor, (int)key);
+}
+
+// Extra constant fields are key=value strings, like in makeQuotedJson.
+static void cborAppendExtraField(std::string *cbor, const std::string &extra_field)
+{
+    size_t p = extra_field.find('=');
+    if (p == std::string::npos)
+    {
+        cborAppendText(cbor, extra_field);
+        cborAppendText(cbor, "");
+        return;
+    }
+    cborAppendText(cbor, extra_field.substr(0, p));
+    cborAppendText(cbor, extra_field.substr(p+1));
+}
+
+void MeterCommonImplementation::printMeterCbor(Telegram *t, std::string *cbor)
+{
+    cbor->clear();
+    cborAppendIndefiniteMap(cbor);
+
+    cborAppendKey(cbor, CborTelegramKey::MEDIA);
+    cborAppendText(cbor, telegramMedia(t));
+    cborAppendKey(cbor, CborTelegramKey::METER);
+    cborAppendText(cbor, driverName().str());
+    cborAppendKey(cbor, CborTelegramKey::NAME);
+    cborAppendText(cbor, name());
+    cborAppendKey(cbor, CborTelegramKey::ID);
+    cborAppendText(cbor, t->addresses.size() > 0 ? build_id(t->addresses.back(), identityMode()) : "");
+
+    for (auto &p : numeric_values_)
+    {
+        NumericField& nf = p.second;
+        FieldInfo *fi = nf.field_info;
+        if (fi->printProperties().hasHIDE()) continue;
+
+        if (fi->isFieldNameTemplate())
+        {
+            cborAppendText(cbor, fi->generateFieldNameWithUnit(this, &nf.dv_entry));
+        }
+        else
+        {
+            cborAppendInt(cbor, fi - field_infos_.data());
+        }
+        // The date units are unix timestamps as numbers, the json formats them as text.
+        cborAppendNumber(cbor, getNumericValue(fi->generateFieldNameNoUnit(this, &nf.dv_entry), fi->displayUnit()));
+    }
+
+    for (auto &p : string_values_)
+    {
+        StringField& sf = p.second;
+        FieldInfo *fi = sf.field_info;
+        if (fi->printProperties().hasHIDE()) continue;
+
+        if (fi->isFieldNameTemplate())
+        {
+            cborAppendText(cbor, p.first);
+        }
+        else
+        {
+            cborAppendInt(cbor, fi - field_infos_.data());
+        }
+        if (fi->printProperties().hasSTATUS())
+        {
+            cborAppendText(cbor, getStatusField(fi));
+        }
+        else if (sf.value == "null")
+        {
+            cborAppendNull(cbor);
+        }
+        else
+        {
+            cborAppendText(cbor, sf.value);
+        }
+    }
+
+    cborAppendKey(cbor, CborTelegramKey::TIMESTAMP);
+    cborAppendInt(cbor, datetime_of_update_);
+
+    if (t->about.device != "")
+    {
+        cborAppendKey(cbor, CborTelegramKey::DEVICE);
+        cborAppendText(cbor, t->about.device);
+        cborAppendKey(cbor, CborTelegramKey::RSSI_DBM);
+        cborAppendInt(cbor, t->about.rssi_dbm);
+    }
+    for (const std::string &extra_field : meterExtraConstantFields())
+    {
+        cborAppendExtraField(cbor, extra_field);
+    }
+
+    cborAppendBreak(cbor);
+}
+
+void MeterCommonImplementation::printMeterCborDictionary(std::string *cbor)
+{
+    cbor->clear();
+    cborAppendIndefiniteMap(cbor);
+
+    cborAppendKey(cbor, CborTelegramKey::MEDIA);
+    cborAppendText(cbor, "media");
+    cborAppendKey(cbor, CborTelegramKey::METER);
+    cborAppendText(cbor, "meter");
+    cborAppendKey(cbor, CborTelegramKey::NAME);
+    cborAppendText(cbor, "name");
+    cborAppendKey(cbor, CborTelegramKey::ID);
+    cborAppendText(cbor, "id");
+    cborAppendKey(cbor, CborTelegramKey::TIMESTAMP);
+    cborAppendText(cbor, "timestamp");
+    cborAppendKey(cbor, CborTelegramKey::DEVICE);
+    cborAppendText(cbor, "device");
+    cborAppendKey(cbor, CborTelegramKey::RSSI_DBM);
+    cborAppendText(cbor, "rssi_dbm");
+
+    for (size_t i = 0; i < field_infos_.size(); i++)
+    {
+        FieldInfo &fi = field_infos_[i];
+        if (fi.printProperties().hasHIDE() || fi.isFieldNameTemplate()) continue;
+
+        cborAppendInt(cbor, i);
+        cborAppendText(cbor, fi.generateFieldNameWithUnit(this, NULL));
+    }
+
+    cborAppendBreak(cbor);
+}
+
 void MeterCommonImplementation::setExpectedTPLSecurityMode(TPLSecurityMode tsm)
 {
     expected_tpl_sec_mode_ = tsm;
@@ -1735,36 +1977,32 @@ ELLSecurityMode MeterCommonImplementation::expectedELLSecurityMode()
 
 void detectMeterDrivers(int manufacturer, int media, int version, std::vector<std::string> *drivers)
 {
-    for (DriverInfo *p : allDrivers())
+    forEachDetectedDriver(manufacturer, media, version, [&](const DriverInfo *p)
     {
-        if (p->detect(manufacturer, media, version))
-        {
-            drivers->push_back(p->name().str());
-        }
-    }
-
+        drivers->push_back(p->name().str());
+        return false;
+    });
 }
 
 bool isMeterDriverValid(DriverName driver_name, int manufacturer, int media, int version)
 {
-    for (DriverInfo *p : allDrivers())
+    bool valid = false;
+    forEachDetectedDriver(manufacturer, media, version, [&](const DriverInfo *p)
     {
-        if (p->detect(manufacturer, media, version))
-        {
-            if (p->hasDriverName(driver_name)) return true;
-        }
-    }
+        valid = p->hasDriverName(driver_name);
+        return valid;
+    });
 
-    return false;
+    return valid;
 }
 
 bool isMeterDriverReasonableForMedia(std::string driver_name, int media)
 {
     if (media == 0x37) return false;  // Skip converter meter side since they do not give any useful information.
 
-    for (DriverInfo *p : allDrivers())
+    for (const DriverInfo *p : allDrivers())
     {
-        if (p->name().str() == driver_name && p->isValidMedia(media))
+        if (driver_name == p->nameCStr() && p->isValidMedia(media))
         {
             return true;
         }
@@ -1788,15 +2026,14 @@ DriverInfo pickMeterDriver(Telegram *t)
         version = t->tpl_version;
     }
 
-    for (DriverInfo *p : allDrivers())
+    const DriverInfo *found = &driver_unknown_;
+    forEachDetectedDriver(manufacturer, media, version, [&](const DriverInfo *p)
     {
-        if (p->detect(manufacturer, media, version))
-        {
-            return *p;
-        }
-    }
+        found = p;
+        return true;
+    });
 
-    return driver_unknown_;
+    return *found;
 }
 
 shared_ptr<Meter> createMeter(MeterInfo *mi)
@@ -1805,7 +2042,7 @@ shared_ptr<Meter> createMeter(MeterInfo *mi)
 
     const char *keymsg = (mi->key[0] == 0) ? "not-encrypted" : "encrypted";
 
-    DriverInfo *di = lookupDriver(mi->driver_name.str());
+    const DriverInfo *di = lookupDriver(mi->driver_name.str());
 
     if (di != NULL)
     {
@@ -1821,7 +2058,8 @@ shared_ptr<Meter> createMeter(MeterInfo *mi)
         }
         else
         {
-            newm->setSelectedFields(di->defaultFields());
+            std::vector<std::string> default_fields = di->defaultFields();
+            newm->setSelectedFields(default_fields);
         }
         
         std::string aesc = AddressExpression::concat(mi->address_expressions);
@@ -2068,8 +2306,6 @@ bool FieldInfo::extractNumeric(Meter *m, Telegram *t, DVEntry *dve)
     assert(dve != NULL);
     assert(key == "" || dve->dif_vif_key.str() == key);
 
-    std::string field_name = generateFieldNameWithUnit(m, dve);
-
     double extracted_double_value = NAN;
 
     bool auto_vif_scaling = vifScaling() == VifScaling::Auto;
@@ -2109,7 +2345,7 @@ bool FieldInfo::extractNumeric(Meter *m, Telegram *t, DVEntry *dve)
 
         debug("(meter) %s %s decoded %s default %s value %g (scale %g)\n",
               toString(matcher_.vif_range),
-              field_name.c_str(),
+              generateFieldNameWithUnit(m, dve).c_str(),
               unitToStringLowerCase(decoded_unit).c_str(),
               unitToStringLowerCase(display_unit_).c_str(),
               extracted_double_value,
@@ -2220,9 +2456,6 @@ bool FieldInfo::extractString(Meter *m, Telegram *t, DVEntry *dve)
     assert(dve != NULL);
     assert(key == "" || dve->dif_vif_key.str() == key);
 
-    // Generate the json field name:
-    std::string field_name = generateFieldNameNoUnit(m, dve);
-
     uint64_t extracted_bits {};
     if (lookup_.hasLookups() || (print_properties_.hasINCLUDETPLSTATUS()))
     {
@@ -28,6 +28,7 @@
 
 #include<assert.h>
 #include<functional>
+#include<list>
 #include<numeric>
 #include<string>
 #include<vector>
@@ -156,68 +157,90 @@ struct DriverDetect
     uchar    version;
 };
 
+// A view of a constant array, typically placed in flash together with the driver info.
+template<typename T>
+struct ConstArray
+{
+    constexpr ConstArray() {}
+    template<size_t N>
+    constexpr ConstArray(const T (&a)[N]) : data_(a), size_(N) {}
+
+    const T *begin() const { return data_; }
+    const T *end() const { return data_ + size_; }
+    size_t size() const { return size_; }
+
+private:
+    const T *data_ {};
+    size_t size_ {};
+};
+
+// The driver info is a literal type. Each driver_*.cc defines its driver info as a
+// constexpr object named driver_info_<name>, which is placed in rodata/flash.
+// The drivers selected in the configuration are collected into a constant table
+// through WMBUS_DRIVER_LIST, thus nothing is executed or allocated at boot.
 struct DriverInfo
 {
+    typedef shared_ptr<Meter> (*Constructor)(MeterInfo&, const DriverInfo&);
+
 private:
 
-    DriverName name_; // auto, unknown, amiplus, lse_07_17, multical21 etc
-    std::vector<DriverName> name_aliases_; // Secondary names that will map to this driver.
-    LinkModeSet linkmodes_; // C1, T1, S1 or combinations thereof.
-    Translate::Lookup mfct_tpl_status_bits_; // Translate any mfct specific bits in tpl status.
-    MeterType type_; // Water, Electricity etc.
-    function<shared_ptr<Meter>(MeterInfo&,DriverInfo&di)> constructor_; // Invoke this to create an instance of the driver.
-    std::vector<DriverDetect> detect_;
-    std::vector<std::string> default_fields_;
+    const char *name_ = ""; // auto, unknown, amiplus, lse_07_17, multical21 etc
+    ConstArray<const char*> name_aliases_; // Secondary names that will map to this driver.
+    uint64_t linkmodes_ {}; // C1, T1, S1 or combinations thereof.
+    MeterType type_ {}; // Water, Electricity etc.
+    Constructor constructor_ {}; // Invoke this to create an instance of the driver.
+    ConstArray<DriverDetect> detect_;
+    const char *default_fields_ = ""; // Comma separated list of fields.
     int force_mfct_index_ = -1; // Used for meters not declaring mfct specific data using the dif 0f.
     bool has_process_content_ = false; // Mark this driver as having mfct specific decoding.
+    bool skip_unchanged_payloads_ = true; // Skip field extraction when the payload repeats the previous one.
 
 public:
-    ~DriverInfo();
-    DriverInfo() {};
-    void setName(std::string n) { name_ = n; }
-    void addNameAlias(std::string n) { name_aliases_.push_back(n); }
-    void setMeterType(MeterType t) { type_ = t; }
-    void setDefaultFields(std::string f) { default_fields_ = splitString(f, ','); }
-    void addLinkMode(LinkMode lm) { linkmodes_.addLinkMode(lm); }
-    void forceMfctIndex(int i) { force_mfct_index_ = i; }
-    void setConstructor(function<shared_ptr<Meter>(MeterInfo&,DriverInfo&)> c) { constructor_ = c; }
-    void addDetection(uint16_t mfct, uchar type, uchar ver) { detect_.push_back({ mfct, type, ver }); }
-    void usesProcessContent() { has_process_content_ = true; }
-
-    std::vector<DriverDetect> &detect() { return detect_; }
-
-    DriverName name() { return name_; }
-    std::vector<DriverName>& nameAliases() { return name_aliases_; }
-    bool hasDriverName(DriverName dn) {
-        if (name_ == dn) return true;
-        for (auto &i : name_aliases_) if (i == dn) return true;
+    constexpr DriverInfo() {}
+    constexpr explicit DriverInfo(const char *n) : name_(n) {}
+    constexpr void setNameAliases(ConstArray<const char*> a) { name_aliases_ = a; }
+    constexpr void setMeterType(MeterType t) { type_ = t; }
+    constexpr void setDefaultFields(const char *f) { default_fields_ = f; }
+    constexpr void addLinkMode(LinkMode lm) { linkmodes_ |= toLinkModeBit(lm); }
+    constexpr void forceMfctIndex(int i) { force_mfct_index_ = i; }
+    constexpr void setConstructor(Constructor c) { constructor_ = c; }
+    constexpr void setDetection(ConstArray<DriverDetect> d) { detect_ = d; }
+    constexpr void usesProcessContent() { has_process_content_ = true; }
+    // For drivers whose decoding depends on more than the tpl status and the payload.
+    constexpr void extractUnchangedPayloads() { skip_unchanged_payloads_ = false; }
+
+    const ConstArray<DriverDetect> &detect() const { return detect_; }
+
+    DriverName name() const { return DriverName(name_); }
+    const char *nameCStr() const { return name_; }
+    const ConstArray<const char*> &nameAliases() const { return name_aliases_; }
+    bool hasDriverName(DriverName dn) const {
+        if (dn.str() == name_) return true;
+        for (const char *i : name_aliases_) if (dn.str() == i) return true;
         return false;
     }
 
-    MeterType type() { return type_; }
-    std::vector<std::string>& defaultFields() { return default_fields_; }
-    LinkModeSet linkModes() { return linkmodes_; }
-    Translate::Lookup &mfctTPLStatusBits() { return mfct_tpl_status_bits_; }
-    shared_ptr<Meter> construct(MeterInfo& mi) { return constructor_(mi, *this); }
-    bool detect(uint16_t mfct, uchar type, uchar version);
-    bool isValidMedia(uchar type);
-    bool isCloseEnoughMedia(uchar type);
-    int forceMfctIndex() { return force_mfct_index_; }
-    bool hasProcessContent() { return has_process_content_; }
+    MeterType type() const { return type_; }
+    std::vector<std::string> defaultFields() const { return splitString(default_fields_, ','); }
+    LinkModeSet linkModes() const { return LinkModeSet(linkmodes_); }
+    shared_ptr<Meter> construct(MeterInfo& mi) const { return constructor_(mi, *this); }
+    bool detect(uint16_t mfct, uchar type, uchar version) const;
+    bool isValidMedia(uchar type) const;
+    bool isCloseEnoughMedia(uchar type) const;
+    int forceMfctIndex() const { return force_mfct_index_; }
+    bool hasProcessContent() const { return has_process_content_; }
+    bool skipsUnchangedPayloads() const { return skip_unchanged_payloads_; }
 };
 
-bool registerDriver(function<void(DriverInfo&di)> setup);
-// Lookup (and load if necessary) driver from memory or disk.
-DriverInfo *lookupDriver(std::string name);
+// Lookup driver by name or alias among the compiled in drivers.
+const DriverInfo *lookupDriver(const std::string &name);
 bool lookupDriverInfo(const std::string& driver, DriverInfo *di = NULL);
 // Return the best driver match for a telegram.
 DriverInfo pickMeterDriver(Telegram *t);
 // Return true for mbus and S2/C2/T2 drivers.
 bool driverNeedsPolling(DriverName& dn);
 
-std::string loadDriver(const std::string &file, const char *content);
-
-std::vector<DriverInfo*>& allDrivers();
+ConstArray<const DriverInfo*> allDrivers();
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -277,6 +300,19 @@ PrintProperties toPrintProperties(std::string s);
 
 #define DEFAULT_PRINT_PROPERTIES 0
 
+// A field name template remembers at most this many generated names.
+#define FIELD_NAME_CACHE_SIZE 32
+
+struct GeneratedFieldName
+{
+    bool has_dve {};
+    int storage_nr {};
+    int tariff_nr {};
+    int subunit_nr {};
+    std::string no_unit;
+    std::string with_unit;
+};
+
 struct FieldInfo
 {
     ~FieldInfo();
@@ -309,6 +345,8 @@ struct FieldInfo
     FieldMatcher& matcher() { return matcher_; }
     std::string help() { return help_; }
     PrintProperties printProperties() { return print_properties_; }
+    // If the vname is a template, then every dventry generates its own field name.
+    bool isFieldNameTemplate() { return is_field_name_template_; }
 
     bool extractNumeric(Meter *m, Telegram *t, DVEntry *dve = NULL);
     bool extractString(Meter *m, Telegram *t, DVEntry *dve = NULL);
@@ -321,13 +359,18 @@ struct FieldInfo
 
     std::string renderJsonOnlyDefaultUnit(Meter *m);
     std::string renderJson(Meter *m, DVEntry *dve);
+    // Append "name_unit":value to the json, without temporary strings for numeric fields.
+    void renderJson(Meter *m, DVEntry *dve, std::string *json);
     std::string renderJsonText(Meter *m, DVEntry *dve);
     // Render the field name based on the actual field from the telegram.
     // A FieldInfo can be declared to handle any number of storage fields of a certain range.
     // The vname is then a pattern total_at_month_{storage_counter} that gets translated into
     // total_at_month_2 (for the dventry with storage nr 2.)
-    std::string generateFieldNameWithUnit(Meter *m, DVEntry *dve);
-    std::string generateFieldNameNoUnit(Meter *m, DVEntry *dve);
+    // The generated names are memoized per storage, tariff and subunit counter. The returned
+    // reference stays valid as long as the FieldInfo, except for templates that read meter fields,
+    // where it is only valid until the next call.
+    const std::string &generateFieldNameWithUnit(Meter *m, DVEntry *dve);
+    const std::string &generateFieldNameNoUnit(Meter *m, DVEntry *dve);
     // Check if the meter object stores a value for this field.
     bool hasValue(Meter *m);
 
@@ -369,10 +412,35 @@ private:
     // If the field name template could not be parsed.
     bool valid_field_name_ {};
 
+    // A field name without a template, with the display unit appended.
+    std::string vname_with_unit_;
+    // If the vname is a template like total_at_month_{storage_counter}.
+    bool is_field_name_template_ {};
+    // If the generated names only depend on the dventry counters.
+    bool memoize_field_names_ {};
+    // Generated names for a template, the list never moves its entries.
+    std::list<GeneratedFieldName> generated_field_names_;
+    // The last generated name that could not be memoized.
+    GeneratedFieldName uncached_field_name_;
+
+    const GeneratedFieldName &generateFieldName(Meter *m, DVEntry *dve);
+
     // If true then this field was fetched from the library.
     bool from_library_ {};
 };
 
+// The keys of the telegram header in printMeterCbor. The fields use the non-negative keys.
+enum class CborTelegramKey : int
+{
+    MEDIA = -1,
+    METER = -2,
+    NAME = -3,
+    ID = -4,
+    TIMESTAMP = -5, // Unix timestamp of the update.
+    DEVICE = -6,
+    RSSI_DBM = -7,
+};
+
 struct Meter
 {
     // Meters are instantiated on the fly from a template, when a telegram arrives
@@ -392,7 +460,7 @@ struct Meter
     virtual void setSelectedFields (std::vector<std::string> &f) = 0;
     virtual std::string name() = 0;
     virtual DriverName driverName() = 0;
-    virtual DriverInfo *driverInfo() = 0;
+    virtual const DriverInfo *driverInfo() = 0;
     virtual bool hasReceivedFirstTelegram() = 0;
     virtual void markFirstTelegramReceived() = 0;
 
@@ -414,6 +482,8 @@ struct Meter
     virtual std::string decodeTPLStatusByte(uchar sts) = 0;
 
     virtual int numUpdates() = 0;
+    // Telegrams whose payload repeated the previous one, so field extraction was skipped.
+    virtual int numSkippedExtractions() = 0;
 
     virtual void createMeterEnv(std::string id,
                                 std::vector<std::string> *envs,
@@ -426,6 +496,14 @@ struct Meter
                             std::vector<std::string> *more_json,
                             std::vector<std::string> *selected_fields,
                             bool pretty_print_json) = 0;
+    // The same content as the json, but as a CBOR map where the fields are keyed by their
+    // position in the driver's field infos. Fields with a templated name and the extra constant
+    // fields keep their text keys. The numbers use the display units of the json, dates are
+    // unix timestamps. See CborTelegramKey for the keys of the telegram header.
+    virtual void printMeterCbor(Telegram *t, std::string *cbor) = 0;
+    // A CBOR map from the integer keys of printMeterCbor to the json keys. It only changes
+    // when the driver or the extra calculated fields change, so it is sent once, not per telegram.
+    virtual void printMeterCborDictionary(std::string *cbor) = 0;
 
     // The handleTelegram expects an input_frame where the DLL crcs have been removed.
     // Returns true of this meter handled this telegram!
@@ -451,7 +529,7 @@ struct Meter
 
 const char *toString(MeterType type);
 MeterType toMeterType(std::string type);
-std::string toString(DriverInfo &driver);
+std::string toString(const DriverInfo &driver);
 LinkModeSet toMeterLinkModeSet(const std::string& driver);
 
 struct Configuration;
@@ -64,7 +64,7 @@ struct MeterCommonImplementation : public virtual Meter
     std::vector<std::string> &extraConstantFields();
     std::string name();
     DriverName driverName();
-    DriverInfo *driverInfo();
+    const DriverInfo *driverInfo();
     bool hasProcessContent();
 
     ELLSecurityMode expectedELLSecurityMode();
@@ -81,11 +81,12 @@ struct MeterCommonImplementation : public virtual Meter
 
     void onUpdate(function<void(Telegram*,Meter*)> cb);
     int numUpdates();
+    int numSkippedExtractions();
 
     static bool isTelegramForMeter(Telegram *t, Meter *meter, MeterInfo *mi);
     MeterKeys *meterKeys();
 
-    MeterCommonImplementation(MeterInfo &mi, DriverInfo &di);
+    MeterCommonImplementation(MeterInfo &mi, const DriverInfo &di);
 
     ~MeterCommonImplementation() = default;
 
@@ -174,6 +175,8 @@ protected:
                     std::vector<std::string> *more_json, // Add this json "key"="value" std::strings.
                     std::vector<std::string> *selected_fields, // Only print these fields.
                     bool pretty_print); // Insert newlines and indentation.
+    void printMeterCbor(Telegram *t, std::string *cbor);
+    void printMeterCborDictionary(std::string *cbor);
     // Json fields include all values except timestamp_ut, timestamp_utc, timestamp_lt
     // since Json is assumed to be decoded by a program and the current timestamp which is the
     // same as timestamp_utc, can always be decoded/recoded into local time or a unix timestamp.
@@ -217,7 +220,7 @@ private:
     int index_ {};
     MeterType type_ {};
     DriverName driver_name_;
-    DriverInfo *driver_info_ {};
+    const DriverInfo *driver_info_ {};
     std::string bus_ {};
     MeterKeys meter_keys_ {};
     ELLSecurityMode expected_ell_sec_mode_ {};
@@ -237,6 +240,11 @@ private:
     int force_mfct_index_ = -1;
     bool has_process_content_ = false;
     bool has_received_first_telegram_ = false;
+    bool skip_unchanged_payloads_ = true;
+    // Hash of the tpl status and payload of the last fully processed telegram.
+    uint64_t last_payload_hash_ {};
+    bool has_last_payload_hash_ = false;
+    int num_skipped_extractions_ {};
 
 protected:
 
@@ -22,60 +22,61 @@
 #include<string.h>
 #include<limits>
 
+// Every conversion is vto = vfrom*scale+offset.
 #define LIST_OF_CONVERSIONS \
-    X(Second, Minute, {vto=vfrom/60.0;}) \
-    X(Minute, Second, {vto=vfrom*60.0;}) \
-    X(Second, Hour, {vto=vfrom/3600.0;}) \
-    X(Hour, Second, {vto=vfrom*3600.0;}) \
-    X(Year, Second, {vto=vfrom*3600.0*24.0*365.2425;}) \
-    X(Second, Year, {vto=vfrom/3600.0/24.0/365.2425;}) \
-    X(Minute, Hour, {vto=vfrom/60.0;}) \
-    X(Hour, Minute, {vto=vfrom*60.0;}) \
-    X(Minute, Year, {vto=vfrom/60.0/24.0/365.2425;}) \
-    X(Year, Minute, {vto=vfrom*60.0*24.0*365.2425;}) \
-    X(Hour, Year, {vto=vfrom/24.0/365.2425;}) \
-    X(Year, Hour, {vto=vfrom*24.0*365.2425;}) \
-    X(Hour,  Day, {vto=vfrom/24.0;}) \
-    X(Day,  Hour, {vto=vfrom*24.0;}) \
-    X(Day,  Year, {vto=vfrom/365.2425;}) \
-    X(Year,  Day, {vto=vfrom*365.2425;}) \
-    X(WH,  KWH, {vto=vfrom/1000.0;})     \
-    X(KWH, GJ, {vto=vfrom*0.0036;})     \
-    X(KWH, MJ, {vto=vfrom*0.0036*1000.0;})     \
-    X(GJ,  KWH,{vto=vfrom/0.0036;}) \
-    X(MJ,  GJ, {vto=vfrom/1000.0;}) \
-    X(MJ,  KWH,{vto=vfrom/1000.0/0.0036;}) \
-    X(GJ,  MJ, {vto=vfrom*1000.0;}) \
-    X(W,   KW, {vto=vfrom/1000.0;})     \
-    X(JH,   W, {vto=vfrom/3600.0;}) \
-    X(W,   JH, {vto=vfrom*3600.0;}) \
-    X(MJH, KW, {vto=vfrom/1000.0/0.0036;}) \
-    X(KW,  MJH,{vto=vfrom*0.0036*1000.0;})\
-    X(M3,  L,  {vto=vfrom*1000.0;}) \
-    X(M3H, LH, {vto=vfrom*1000.0;}) \
-    X(L,   M3, {vto=vfrom/1000.0;}) \
-    X(LH,  M3H,{vto=vfrom/1000.0;}) \
-    X(C,   K,  {vto=vfrom+273.15;}) \
-    X(K,   C,  {vto=vfrom-273.15;}) \
-    X(C,   F,  {vto=(vfrom*9.0/5.0)+32.0;}) \
-    X(F,   C,  {vto=(vfrom-32)*5.0/9.0;}) \
-    X(PA,  BAR,{vto=vfrom/100000.0;}) \
-    X(BAR, PA, {vto=vfrom*100000.0;}) \
-    X(COUNTER, FACTOR,{vto=vfrom;})  \
-    X(FACTOR, COUNTER, {vto=vfrom;}) \
-    X(COUNTER, NUMBER,{vto=vfrom;})  \
-    X(NUMBER, COUNTER, {vto=vfrom;}) \
-    X(FACTOR, NUMBER, {vto=vfrom;})  \
-    X(NUMBER, FACTOR, {vto=vfrom;}) \
-    X(PERCENTAGE, NUMBER, {vto=vfrom;})  \
-    X(NUMBER, PERCENTAGE, {vto=vfrom;}) \
-    X(UnixTimestamp,DateTimeLT, {vto=vfrom; }) \
-    X(DateTimeLT,UnixTimestamp, {vto=vfrom; }) \
-    X(DateLT,UnixTimestamp, {vto=vfrom; }) \
-    X(DateTimeLT, DateLT, {vto=vfrom; }) \
-    X(DateLT, DateTimeLT, {vto=vfrom; }) \
-    X(DEGREE, RADIAN, {vto=vfrom*M_PI/180.0;}) \
-    X(RADIAN, DEGREE, {vto=vfrom*180.0/M_PI;}) \
+    X(Second,        Minute,        1.0/60.0,                   0.0) \
+    X(Minute,        Second,        60.0,                       0.0) \
+    X(Second,        Hour,          1.0/3600.0,                 0.0) \
+    X(Hour,          Second,        3600.0,                     0.0) \
+    X(Year,          Second,        3600.0*24.0*365.2425,       0.0) \
+    X(Second,        Year,          1.0/(3600.0*24.0*365.2425), 0.0) \
+    X(Minute,        Hour,          1.0/60.0,                   0.0) \
+    X(Hour,          Minute,        60.0,                       0.0) \
+    X(Minute,        Year,          1.0/(60.0*24.0*365.2425),   0.0) \
+    X(Year,          Minute,        60.0*24.0*365.2425,         0.0) \
+    X(Hour,          Year,          1.0/(24.0*365.2425),        0.0) \
+    X(Year,          Hour,          24.0*365.2425,              0.0) \
+    X(Hour,          Day,           1.0/24.0,                   0.0) \
+    X(Day,           Hour,          24.0,                       0.0) \
+    X(Day,           Year,          1.0/365.2425,               0.0) \
+    X(Year,          Day,           365.2425,                   0.0) \
+    X(WH,            KWH,           1.0/1000.0,                 0.0) \
+    X(KWH,           GJ,            0.0036,                     0.0) \
+    X(KWH,           MJ,            0.0036*1000.0,              0.0) \
+    X(GJ,            KWH,           1.0/0.0036,                 0.0) \
+    X(MJ,            GJ,            1.0/1000.0,                 0.0) \
+    X(MJ,            KWH,           1.0/(1000.0*0.0036),        0.0) \
+    X(GJ,            MJ,            1000.0,                     0.0) \
+    X(W,             KW,            1.0/1000.0,                 0.0) \
+    X(JH,            W,             1.0/3600.0,                 0.0) \
+    X(W,             JH,            3600.0,                     0.0) \
+    X(MJH,           KW,            1.0/(1000.0*0.0036),        0.0) \
+    X(KW,            MJH,           0.0036*1000.0,              0.0) \
+    X(M3,            L,             1000.0,                     0.0) \
+    X(M3H,           LH,            1000.0,                     0.0) \
+    X(L,             M3,            1.0/1000.0,                 0.0) \
+    X(LH,            M3H,           1.0/1000.0,                 0.0) \
+    X(C,             K,             1.0,                        273.15) \
+    X(K,             C,             1.0,                        -273.15) \
+    X(C,             F,             9.0/5.0,                    32.0) \
+    X(F,             C,             5.0/9.0,                    -32.0*5.0/9.0) \
+    X(PA,            BAR,           1.0/100000.0,               0.0) \
+    X(BAR,           PA,            100000.0,                   0.0) \
+    X(COUNTER,       FACTOR,        1.0,                        0.0) \
+    X(FACTOR,        COUNTER,       1.0,                        0.0) \
+    X(COUNTER,       NUMBER,        1.0,                        0.0) \
+    X(NUMBER,        COUNTER,       1.0,                        0.0) \
+    X(FACTOR,        NUMBER,        1.0,                        0.0) \
+    X(NUMBER,        FACTOR,        1.0,                        0.0) \
+    X(PERCENTAGE,    NUMBER,        1.0,                        0.0) \
+    X(NUMBER,        PERCENTAGE,    1.0,                        0.0) \
+    X(UnixTimestamp, DateTimeLT,    1.0,                        0.0) \
+    X(DateTimeLT,    UnixTimestamp, 1.0,                        0.0) \
+    X(DateLT,        UnixTimestamp, 1.0,                        0.0) \
+    X(DateTimeLT,    DateLT,        1.0,                        0.0) \
+    X(DateLT,        DateTimeLT,    1.0,                        0.0) \
+    X(DEGREE,        RADIAN,        M_PI/180.0,                 0.0) \
+    X(RADIAN,        DEGREE,        180.0/M_PI,                 0.0) \
 
 
 #define LIST_OF_SI_CONVERSIONS  \
@@ -168,23 +169,71 @@ bool overrideConversion(Unit from, Unit to)
     return false;
 }
 
-bool canConvert(Unit ufrom, Unit uto)
+#define NUM_UNITS ((int)Unit::Unknown+1)
+
+struct UnitConversion
 {
-    if (ufrom == uto) return true;
-#define X(from,to,code) if (Unit::from == ufrom && Unit::to == uto) return true;
+    double scale;
+    double offset;
+};
+
+// Index 0 is reserved for impossible conversions.
+static constexpr UnitConversion unit_conversions[] =
+{
+    { 0.0, 0.0 },
+#define X(from,to,scale,offset) { scale, offset },
 LIST_OF_CONVERSIONS
 #undef X
-    return false;
-}
+};
 
-double convert(double vfrom, Unit ufrom, Unit uto)
+static_assert(sizeof(unit_conversions)/sizeof(unit_conversions[0]) <= 256, "Too many unit conversions for a byte index.");
+
+struct UnitConversionTable
 {
-    double vto = -4711.0;
-    if (ufrom == uto) { { vto = vfrom; } return vto; }
+    // index[from][to] is the position in unit_conversions.
+    uint8_t index[NUM_UNITS][NUM_UNITS];
+};
 
-#define X(from,to,code) if (Unit::from == ufrom && Unit::to == uto) { code return vto; }
+static constexpr UnitConversionTable makeUnitConversionTable()
+{
+    UnitConversionTable table {};
+    const Unit froms[] = {
+#define X(from,to,scale,offset) Unit::from,
+LIST_OF_CONVERSIONS
+#undef X
+    };
+    const Unit tos[] = {
+#define X(from,to,scale,offset) Unit::to,
 LIST_OF_CONVERSIONS
 #undef X
+    };
+    for (size_t i = 0; i < sizeof(froms)/sizeof(froms[0]); ++i)
+    {
+        // The first listed conversion wins, as with the old if chain.
+        uint8_t &slot = table.index[(int)froms[i]][(int)tos[i]];
+        if (slot == 0) slot = i+1;
+    }
+    return table;
+}
+
+static constexpr UnitConversionTable unit_conversion_table = makeUnitConversionTable();
+
+bool canConvert(Unit ufrom, Unit uto)
+{
+    if (ufrom == uto) return true;
+    return unit_conversion_table.index[(int)ufrom][(int)uto] != 0;
+}
+
+double convert(double vfrom, Unit ufrom, Unit uto)
+{
+    if (ufrom == uto) return vfrom;
+
+    uint8_t i = unit_conversion_table.index[(int)ufrom][(int)uto];
+    if (i != 0)
+    {
+        const UnitConversion &c = unit_conversions[i];
+        return vfrom*c.scale+c.offset;
+    }
 
     std::string from = unitToStringHR(ufrom);
     std::string to = unitToStringHR(uto);
@@ -243,20 +292,13 @@ bool SIUnit::convertTo(double left, const SIUnit &out_siunit, double *out) const
     }
 
     // Now the special cases. K-C-F
-    if (isKCF(exp()) && isKCF(out_siunit.exp()))
-    {
-        double from_scale {};
-        double from_offset {};
-
-        getScaleOffset(exp(), &from_scale, &from_offset);
-        from_scale *= scale();
-
-        double to_offset {};
-        double to_scale {};
-
-        getScaleOffset(out_siunit.exp(), &to_scale, &to_offset);
-        to_scale *= out_siunit.scale();
+    double from_offset {};
+    double from_scale {};
+    double to_scale {};
+    double to_offset {};
 
+    if (temperatureConversionTo(out_siunit, &from_offset, &from_scale, &to_scale, &to_offset))
+    {
         if (out != NULL) *out = ((left+from_offset)*from_scale)/to_scale-to_offset;
         return true;
     }
@@ -265,6 +307,21 @@ bool SIUnit::convertTo(double left, const SIUnit &out_siunit, double *out) const
     return false;
 }
 
+bool SIUnit::temperatureConversionTo(const SIUnit &out_siunit,
+                                     double *from_offset, double *from_scale,
+                                     double *to_scale, double *to_offset) const
+{
+    if (!isKCF(exp()) || !isKCF(out_siunit.exp())) return false;
+
+    getScaleOffset(exp(), from_scale, from_offset);
+    *from_scale *= scale();
+
+    getScaleOffset(out_siunit.exp(), to_scale, to_offset);
+    *to_scale *= out_siunit.scale();
+
+    return true;
+}
+
 bool forbidden_op(MathOp op, const SIExp &a, const SIExp &b)
 {
     // Two unix timestamps cannot be added together. They can be subtracted though!
@@ -513,22 +570,32 @@ std::string strWithUnitLowerCase(double v, Unit u)
 }
 
 std::string valueToString(double v, Unit u)
+{
+    std::string s;
+    appendValueToString(&s, v, u);
+    return s;
+}
+
+void appendValueToString(std::string *out, double v, Unit u)
 {
     if (::isnan(v))
     {
-        return "null";
+        out->append("null");
+        return;
     }
-    // This rounds the double value to 6 decimal digits.
+    // This rounds the double value to 6 decimal digits, the same as std::to_string.
     // TODO this should be changed to track all double digits available.
-    std::string s = std::to_string(v);
-    while (s.size() > 0 && s.back() == '0') s.pop_back();
-    if (s.back() == '.') {
-        s.pop_back();
-        if (s.length() == 0) return "0";
-        return s;
+    char buf[std::numeric_limits<double>::max_exponent10 + 20];
+    int n = snprintf(buf, sizeof(buf), "%f", v);
+    size_t len = n > 0 ? n : 0;
+    while (len > 0 && buf[len-1] == '0') len--;
+    if (len > 0 && buf[len-1] == '.') len--;
+    if (len == 0)
+    {
+        out->append("0");
+        return;
     }
-    if (s.length() == 0) return "0";
-    return s;
+    out->append(buf, len);
 }
 
 bool extractUnit(const std::string &s, std::string *vname, Unit *u)
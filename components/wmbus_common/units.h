@@ -259,6 +259,11 @@ struct SIUnit
     bool sameExponents(SIUnit &to_siunit) const { return exponents_ == to_siunit.exponents_; }
     // Convert value from this unit to another unit and store it in out. Return false if conversion is impossible!
     bool convertTo(double left, const SIUnit &out_siunit, double *out) const;
+    // Get the constants convertTo uses between temperatures: out = ((left+from_offset)*from_scale)/to_scale-to_offset.
+    // Return false if the units are not both K, C or F based!
+    bool temperatureConversionTo(const SIUnit &out_siunit,
+                                 double *from_offset, double *from_scale,
+                                 double *to_scale, double *to_offset) const;
     // Do a math op. Store the resulting unit and value into the destination pointers.
     // Return false if the addion cannot be performed.
     bool mathOpTo(MathOp op, double left, double right, const SIUnit &right_siunit, SIUnit *out_siunit, double *out) const;
@@ -298,6 +303,8 @@ std::string unitToStringHR(Unit u);
 std::string unitToStringLowerCase(Unit u);
 std::string unitToStringUpperCase(Unit u);
 std::string valueToString(double v, Unit u);
+// Append the valueToString text without creating a temporary std::string.
+void appendValueToString(std::string *out, double v, Unit u);
 
 bool extractUnit(const std::string &s, std::string *vname, Unit *u);
 
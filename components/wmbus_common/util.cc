@@ -368,16 +368,21 @@ void incrementIV(uchar *iv, size_t len) {
     }
 }
 
-void debugPayload(const std::string& intro, std::vector<uchar> &payload)
+// The hex dump is formatted inside the debug arguments, so it costs nothing when debug logging is compiled out.
+// The casts keep the parameters used then.
+void debugPayload(const char *intro, std::vector<uchar> &payload)
 {
-    std::string msg = bin2hex(payload);
-    debug("%s \"%s\"\n", intro.c_str(), msg.c_str());
+    (void)intro;
+    (void)payload;
+    debug("%s \"%s\"\n", intro, bin2hex(payload).c_str());
 }
 
-void debugPayload(const std::string& intro, std::vector<uchar> &payload, std::vector<uchar>::iterator &pos)
+void debugPayload(const char *intro, std::vector<uchar> &payload, std::vector<uchar>::iterator &pos)
 {
-    std::string msg = bin2hex(pos, payload.end(), 1024);
-    debug("%s \"%s\"\n", intro.c_str(), msg.c_str());
+    (void)intro;
+    (void)payload;
+    (void)pos;
+    debug("%s \"%s\"\n", intro, bin2hex(pos, payload.end(), 1024).c_str());
 }
 
 void logTelegram (std::vector<uchar> &original, std::vector<uchar> &parsed, int header_size, int suffix_size)
@@ -480,36 +485,81 @@ int parseTime(const std::string& s)
 
 #define CRC16_EN_13757 0x3D65
 
-uint16_t crc16_EN13757_per_byte(uint16_t crc, uchar b)
-{
-    unsigned char i;
+// Define WMBUS_CRC16_SLICE_BY_4 to consume four bytes per step. It needs
+// 2KiB of tables instead of 512 bytes and pays off for long frames.
+#ifndef WMBUS_CRC16_SLICE_BY_4
+#define WMBUS_CRC16_SLICE_BY_4 0
+#endif
 
-    for (i = 0; i < 8; i++) {
+#define CRC16_EN_13757_TABLES (WMBUS_CRC16_SLICE_BY_4 ? 4 : 1)
 
-        if (((crc & 0x8000) >> 8) ^ (b & 0x80)){
-            crc = (crc << 1)  ^ CRC16_EN_13757;
-        }else{
-            crc = (crc << 1);
-        }
+struct Crc16EN13757Tables
+{
+    // t[0][b] is the crc register after shifting in b, t[n][b] the same
+    // followed by n zero bytes.
+    uint16_t t[CRC16_EN_13757_TABLES][256];
+};
 
-        b <<= 1;
+static constexpr Crc16EN13757Tables makeCrc16EN13757Tables()
+{
+    Crc16EN13757Tables tables {};
+    for (int b = 0; b < 256; ++b)
+    {
+        uint16_t crc = b << 8;
+        for (int i = 0; i < 8; ++i)
+        {
+            crc = (crc & 0x8000) ? (crc << 1) ^ CRC16_EN_13757 : (crc << 1);
+        }
+        tables.t[0][b] = crc;
     }
+    for (int n = 1; n < CRC16_EN_13757_TABLES; ++n)
+    {
+        for (int b = 0; b < 256; ++b)
+        {
+            uint16_t prev = tables.t[n-1][b];
+            tables.t[n][b] = (prev << 8) ^ tables.t[0][prev >> 8];
+        }
+    }
+    return tables;
+}
+
+static constexpr Crc16EN13757Tables crc16_EN13757_tables = makeCrc16EN13757Tables();
 
+static inline uint16_t crc16_EN13757_update(uint16_t crc, const uchar *data, size_t len)
+{
+    const auto &t = crc16_EN13757_tables.t;
+    size_t i = 0;
+#if WMBUS_CRC16_SLICE_BY_4
+    for (; i+4 <= len; i += 4)
+    {
+        crc = t[3][(crc >> 8) ^ data[i]] ^
+              t[2][(crc & 0xff) ^ data[i+1]] ^
+              t[1][data[i+2]] ^
+              t[0][data[i+3]];
+    }
+#endif
+    for (; i < len; ++i)
+    {
+        crc = (crc << 8) ^ t[0][(crc >> 8) ^ data[i]];
+    }
     return crc;
 }
 
 uint16_t crc16_EN13757(uchar *data, size_t len)
 {
-    uint16_t crc = 0x0000;
-
     assert(len == 0 || data != NULL);
 
-    for (size_t i=0; i<len; ++i)
-    {
-        crc = crc16_EN13757_per_byte(crc, data[i]);
-    }
+    return ~crc16_EN13757_update(0x0000, data, len);
+}
 
-    return (~crc);
+void Crc16En13757::update(uchar b)
+{
+    crc_ = (crc_ << 8) ^ crc16_EN13757_tables.t[0][(crc_ >> 8) ^ b];
+}
+
+void Crc16En13757::update(const uchar *data, size_t len)
+{
+    crc_ = crc16_EN13757_update(crc_, data, len);
 }
 
 #define CRC16_INIT_VALUE 0xFFFF
@@ -98,8 +98,8 @@ std::string format3fdot3f(double v);
 #define warning(...) //esph_log_w("wmbusmeters", __VA_ARGS__)
 #define error(...) //esph_log_e("wmbusmeters", __VA_ARGS__)
 
-void debugPayload(const std::string &intro, std::vector<uchar> &payload);
-void debugPayload(const std::string &intro, std::vector<uchar> &payload, std::vector<uchar>::iterator &pos);
+void debugPayload(const char *intro, std::vector<uchar> &payload);
+void debugPayload(const char *intro, std::vector<uchar> &payload, std::vector<uchar>::iterator &pos);
 void logTelegram(std::vector<uchar> &original, std::vector<uchar> &parsed, int header_size, int suffix_size);
 
 enum class Alarm
@@ -144,6 +144,23 @@ bool isValidTimePeriod(const std::string &periods);
 
 uint16_t crc16_EN13757(uchar *data, size_t len);
 
+// Incremental crc16_EN13757, for checking a block while its bytes arrive.
+// Feeding the bytes in any number of update calls gives the same value()
+// as a single crc16_EN13757 over all of them.
+class Crc16En13757
+{
+public:
+    void reset() { crc_ = 0; }
+    void update(uchar b);
+    void update(const uchar *data, size_t len);
+    uint16_t value() const { return ~crc_; }
+    // The crc is transmitted big endian directly after the block it covers.
+    bool matches(const uchar *crc_bytes) const { return value() == (crc_bytes[0] << 8 | crc_bytes[1]); }
+
+private:
+    uint16_t crc_ = 0;
+};
+
 // This crc is used by im871a for its serial communication.
 uint16_t crc16_CCITT(uchar *data, uint16_t length);
 bool crc16_CCITT_check(uchar *data, uint16_t length);
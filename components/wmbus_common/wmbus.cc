@@ -20,6 +20,7 @@
 #include"wmbus_utils.h"
 #include"dvparser.h"
 #include"manufacturer_specificities.h"
+#include"manufacturer_table.h"
 #include<assert.h>
 #include<cmath>
 #include<stdarg.h>
@@ -199,30 +200,28 @@ std::string LinkModeSet::hr()
     return r;
 }
 
-struct Manufacturer {
-    const char *code;
-    int m_field;
-    const char *name;
-
-    Manufacturer(const char *c, int m, const char *n) {
-        code = c;
-        m_field = m;
-        name = n;
-    }
-};
-
-std::vector<Manufacturer> manufacturers_;
-
-struct Initializer { Initializer(); };
-
-static Initializer initializser_;
+// The perfect-hash table is generated from LIST_OF_MANUFACTURERS, make sure it is
+// regenerated (scripts/generate_manufacturer_table.py) when manufacturers.h changes.
+#define X(key,code,name) +1
+static_assert(MANUFACTURER_TABLE_SOURCE_ENTRIES == 0 LIST_OF_MANUFACTURERS,
+              "manufacturer_table.h is out of date with manufacturers.h");
+#undef X
 
-Initializer::Initializer() {
+static uint32_t manufacturerHash(uint32_t m_field, uint32_t seed)
+{
+    uint32_t x = (m_field ^ seed) * 0x9E3779B1u;
+    return x ^ (x >> 16);
+}
 
-#define X(key,code,name) manufacturers_.push_back(Manufacturer(#key,code,name));
-LIST_OF_MANUFACTURERS
-#undef X
+static const char *lookupManufacturer(int m_field)
+{
+    const size_t num_seeds = sizeof(manufacturer_seeds_)/sizeof(manufacturer_seeds_[0]);
+    const size_t num_entries = sizeof(manufacturer_table_)/sizeof(manufacturer_table_[0]);
 
+    uint32_t seed = manufacturer_seeds_[manufacturerHash(m_field, 0) % num_seeds];
+    const ManufacturerEntry &e = manufacturer_table_[manufacturerHash(m_field, seed) % num_entries];
+    if (e.m_field != m_field) return NULL;
+    return e.name;
 }
 
 void Telegram::addAddressMfctFirst(const std::vector<uchar>::iterator &pos)
@@ -260,7 +259,7 @@ void Telegram::print()
     notice("Received telegram from: %02x%02x%02x%02x\n", a,b,c,d);
     notice("          manufacturer: (%s) %s (0x%02x)\n",
            manufacturerFlag(dll_mfct).c_str(),
-           manufacturer(dll_mfct).c_str(),
+           manufacturer(dll_mfct),
            dll_mfct);
     notice("                  type: %s (0x%02x)%s\n", mediaType(dll_type, dll_mfct).c_str(), dll_type, enc);
 
@@ -271,7 +270,7 @@ void Telegram::print()
         notice("      Concerning meter: %02x%02x%02x%02x\n", tpl_id_b[3],tpl_id_b[2],tpl_id_b[1],tpl_id_b[0]);
         notice("          manufacturer: (%s) %s (0x%02x)\n",
            manufacturerFlag(tpl_mfct).c_str(),
-           manufacturer(tpl_mfct).c_str(),
+           manufacturer(tpl_mfct),
            tpl_mfct);
         notice("                  type: %s (0x%02x)%s\n", mediaType(tpl_type, dll_mfct).c_str(), tpl_type, enc);
 
@@ -386,15 +385,12 @@ void Telegram::printTPL()
 }
 
 
-std::string manufacturer(int m_field) {
-    for (auto &m : manufacturers_) {
-	if (m.m_field == m_field) return m.name;
-    }
+const char *manufacturer(int m_field) {
+    const char *name = lookupManufacturer(m_field);
+    if (name) return name;
     // Some weird meters send the first char in lower case aPT iTW. Fix and try again.
-    m_field &= 0x7fff;
-    for (auto &m : manufacturers_) {
-	if (m.m_field == m_field) return m.name;
-    }
+    name = lookupManufacturer(m_field & 0x7fff);
+    if (name) return name;
     return "Unknown";
 }
 
@@ -1022,7 +1018,7 @@ bool Telegram::parseELL (std::vector<uchar>::iterator &pos)
         {
             if (meter_keys)
             {
-                decrypt_ELL_AES_CTR(this, frame, pos, meter_keys->confidentiality_key);
+                decrypt_ELL_AES_CTR(this, frame, pos, meter_keys->confidentialityContext());
                 // Actually this ctr decryption always succeeds, if wrong key, it will decrypt to garbage.
             }
             // Now the frame from pos and onwards has been decrypted, perhaps.
@@ -1069,7 +1065,7 @@ bool Telegram::parseELL (std::vector<uchar>::iterator &pos)
                             check  & 0xff, check >> 8,
                             dll_id_b[3], dll_id_b[2], dll_id_b[1], dll_id_b[0],
                             manufacturerFlag(dll_mfct).c_str(),
-                            manufacturer(dll_mfct).c_str(),
+                            manufacturer(dll_mfct),
                             dll_mfct,
                             mediaType(dll_type, dll_mfct).c_str(), dll_type,
                             dll_version);
@@ -1303,32 +1299,25 @@ bool Telegram::parseTPLConfig(std::vector<uchar>::iterator &pos)
 
         if (tpl_kdf_selection == 1)
         {
-            std::vector<uchar> input;
-            std::vector<uchar> mac;
-            mac.resize(16);
+            uchar input[16];
+            uchar mac[16];
+            int i = 0;
 
             // DC C ID 0x07 0x07 0x07 0x07 0x07 0x07 0x07
             // Derivation Constant DC = 0x00 = encryption from meter.
             //                          0x01 = mac from meter.
             //                          0x10 = encryption from communication partner.
             //                          0x11 = mac from communication partner.
-            input.insert(input.end(), 0x00); // DC 00 = generate ephemereal encryption key from meter.
+            input[i++] = 0x00; // DC 00 = generate ephemereal encryption key from meter.
             // If there is a tpl_counter, then use it, else use afl_counter.
-            input.insert(input.end(), afl_counter_b, afl_counter_b+4);
+            for (int j=0; j<4; ++j) input[i++] = afl_counter_b[j];
             // If there is a tpl_id, then use it, else use ddl_id.
-            if (tpl_id_found)
-            {
-                input.insert(input.end(), tpl_id_b, tpl_id_b+4);
-            }
-            else
-            {
-                input.insert(input.end(), dll_id_b, dll_id_b+4);
-            }
+            for (int j=0; j<4; ++j) input[i++] = tpl_id_found ? tpl_id_b[j] : dll_id_b[j];
 
             // Pad.
-            for (int i=0; i<7; ++i) input.insert(input.end(), 0x07);
+            while (i < 16) input[i++] = 0x07;
 
-            debugPayload("(wmbus) input to kdf for enc", input);
+            debug("(wmbus) input to kdf for enc %s\n", bin2hex(std::vector<uchar>(input, input+16)).c_str());
 
             if (meter_keys == NULL || meter_keys->confidentiality_key.size() != 16)
             {
@@ -1340,25 +1329,17 @@ bool Telegram::parseTPLConfig(std::vector<uchar>::iterator &pos)
                 debug("(wmbus) no key, thus cannot execute kdf.\n");
                 return false;
             }
-            AES_CMAC(safeButUnsafeVectorPtr(meter_keys->confidentiality_key),
-                     safeButUnsafeVectorPtr(input), 16,
-                     safeButUnsafeVectorPtr(mac));
-            std::string s = bin2hex(mac);
-            debug("(wmbus) ephemereal Kenc %s\n", s.c_str());
-            tpl_generated_key.clear();
-            tpl_generated_key.insert(tpl_generated_key.end(), mac.begin(), mac.end());
+            const AES_CMAC_ctx *cmac_ctx = meter_keys->confidentialityCMACContext();
+
+            AES_CMAC(cmac_ctx, input, 16, mac);
+            debug("(wmbus) ephemereal Kenc %s\n", bin2hex(std::vector<uchar>(mac, mac+16)).c_str());
+            tpl_generated_key.assign(mac, mac+16);
 
             input[0] = 0x01; // DC 01 = generate ephemereal mac key from meter.
-            mac.clear();
-            mac.resize(16);
-            debugPayload("(wmbus) input to kdf for mac", input);
-            AES_CMAC(safeButUnsafeVectorPtr(meter_keys->confidentiality_key),
-                     safeButUnsafeVectorPtr(input), 16,
-                     safeButUnsafeVectorPtr(mac));
-            s = bin2hex(mac);
-            debug("(wmbus) ephemereal Kmac %s\n", s.c_str());
-            tpl_generated_mac_key.clear();
-            tpl_generated_mac_key.insert(tpl_generated_mac_key.end(), mac.begin(), mac.end());
+            debug("(wmbus) input to kdf for mac %s\n", bin2hex(std::vector<uchar>(input, input+16)).c_str());
+            AES_CMAC(cmac_ctx, input, 16, mac);
+            debug("(wmbus) ephemereal Kmac %s\n", bin2hex(std::vector<uchar>(mac, mac+16)).c_str());
+            tpl_generated_mac_key.assign(mac, mac+16);
         }
     }
 
@@ -1435,30 +1416,29 @@ bool Telegram::checkMAC(std::vector<uchar> &frame,
                         std::vector<uchar> &inmac,
                         std::vector<uchar> &mackey)
 {
-    std::vector<uchar> input;
-    std::vector<uchar> mac;
-    mac.resize(16);
-
     if (mackey.size() != 16) return false;
-    if (inmac.size() == 0) return false;
+    if (inmac.size() == 0 || inmac.size() > 16) return false;
 
     // AFL.MAC = CMAC (Kmac/Lmac,
     //                 AFL.MCL || AFL.MCR || {AFL.ML || } NextCI || ... || Last Byte of message)
 
-    input.insert(input.end(), afl_mcl);
-    input.insert(input.end(), afl_counter_b, afl_counter_b+4);
-    input.insert(input.end(), from, to);
-    std::string s = bin2hex(input);
-    debug("(wmbus) input to mac %s\n", s.c_str());
-    AES_CMAC(safeButUnsafeVectorPtr(mackey),
-             safeButUnsafeVectorPtr(input), input.size(),
-             safeButUnsafeVectorPtr(mac));
-    std::string calculated = bin2hex(mac);
-    debug("(wmbus) calculated mac %s\n", calculated.c_str());
-    std::string received = bin2hex(inmac);
-    debug("(wmbus) received   mac %s\n", received.c_str());
-    std::string truncated = calculated.substr(0, received.length());
-    bool ok = truncated == received;
+    AES_CMAC_ctx ctx;
+    AES_CMAC_init(&ctx, safeButUnsafeVectorPtr(mackey));
+
+    AES_CMAC_state state;
+    AES_CMAC_start(&state);
+    AES_CMAC_update(&ctx, &state, &afl_mcl, 1);
+    AES_CMAC_update(&ctx, &state, afl_counter_b, 4);
+    if (from != to) AES_CMAC_update(&ctx, &state, &*from, to-from);
+
+    uchar mac[16];
+    AES_CMAC_finish(&ctx, &state, mac);
+
+    debug("(wmbus) calculated mac %s\n", bin2hex(std::vector<uchar>(mac, mac+16)).c_str());
+    debug("(wmbus) received   mac %s\n", bin2hex(inmac).c_str());
+
+    // The received mac can be truncated, compare only the bytes that were sent.
+    bool ok = AES_CMAC_equal(mac, safeButUnsafeVectorPtr(inmac), inmac.size());
     if (ok)
     {
         debug("(wmbus) mac ok!\n");
@@ -1496,7 +1476,7 @@ bool Telegram::potentiallyDecrypt (std::vector<uchar>::iterator &pos)
                         "id: %02x%02x%02x%02x mfct: (%s) %s (0x%02x) type: %s (0x%02x) ver: 0x%02x\n",
                             dll_id_b[3], dll_id_b[2], dll_id_b[1], dll_id_b[0],
                             manufacturerFlag(dll_mfct).c_str(),
-                            manufacturer(dll_mfct).c_str(),
+                            manufacturer(dll_mfct),
                             dll_mfct,
                             mediaType(dll_type, dll_mfct).c_str(), dll_type,
                             dll_version);
@@ -1512,7 +1492,7 @@ bool Telegram::potentiallyDecrypt (std::vector<uchar>::iterator &pos)
         int num_encrypted_bytes = 0;
         int num_not_encrypted_at_end = 0;
 
-        bool ok = decrypt_TPL_AES_CBC_IV(this, frame, pos, meter_keys->confidentiality_key,
+        bool ok = decrypt_TPL_AES_CBC_IV(this, frame, pos, meter_keys->confidentialityContext(),
                                          &num_encrypted_bytes, &num_not_encrypted_at_end);
         if (!ok)
         {
@@ -1529,7 +1509,7 @@ bool Telegram::potentiallyDecrypt (std::vector<uchar>::iterator &pos)
                             "Permanently ignoring telegrams from id: %02x%02x%02x%02x mfct: (%s) %s (0x%02x) type: %s (0x%02x) ver: 0x%02x\n",
                             dll_id_b[3], dll_id_b[2], dll_id_b[1], dll_id_b[0],
                             manufacturerFlag(dll_mfct).c_str(),
-                            manufacturer(dll_mfct).c_str(),
+                            manufacturer(dll_mfct),
                             dll_mfct,
                             mediaType(dll_type, dll_mfct).c_str(), dll_type,
                             dll_version);
@@ -1564,7 +1544,7 @@ bool Telegram::potentiallyDecrypt (std::vector<uchar>::iterator &pos)
                             "Permanently ignoring telegrams from id: %02x%02x%02x%02x mfct: (%s) %s (0x%02x) type: %s (0x%02x) ver: 0x%02x\n",
                             dll_id_b[3], dll_id_b[2], dll_id_b[1], dll_id_b[0],
                             manufacturerFlag(dll_mfct).c_str(),
-                            manufacturer(dll_mfct).c_str(),
+                            manufacturer(dll_mfct),
                             dll_mfct,
                             mediaType(dll_type, dll_mfct).c_str(), dll_type,
                             dll_version);
@@ -1586,7 +1566,7 @@ bool Telegram::potentiallyDecrypt (std::vector<uchar>::iterator &pos)
                         "id: %02x%02x%02x%02x mfct: (%s) %s (0x%02x) type: %s (0x%02x) ver: 0x%02x\n",
                             dll_id_b[3], dll_id_b[2], dll_id_b[1], dll_id_b[0],
                             manufacturerFlag(dll_mfct).c_str(),
-                            manufacturer(dll_mfct).c_str(),
+                            manufacturer(dll_mfct),
                             dll_mfct,
                             mediaType(dll_type, dll_mfct).c_str(), dll_type,
                             dll_version);
@@ -1609,7 +1589,7 @@ bool Telegram::potentiallyDecrypt (std::vector<uchar>::iterator &pos)
                             "Permanently ignoring telegrams from id: %02x%02x%02x%02x mfct: (%s) %s (0x%02x) type: %s (0x%02x) ver: 0x%02x\n",
                             dll_id_b[3], dll_id_b[2], dll_id_b[1], dll_id_b[0],
                             manufacturerFlag(dll_mfct).c_str(),
-                            manufacturer(dll_mfct).c_str(),
+                            manufacturer(dll_mfct),
                             dll_mfct,
                             mediaType(dll_type, dll_mfct).c_str(), dll_type,
                             dll_version);
@@ -1629,9 +1609,13 @@ bool Telegram::potentiallyDecrypt (std::vector<uchar>::iterator &pos)
             return false;
         }
 
+        // The ephemeral key is derived per telegram, so its schedule is not cached.
+        AES_ctx generated_ctx;
+        if (tpl_generated_key.size() > 0) AES_init_ctx(&generated_ctx, safeButUnsafeVectorPtr(tpl_generated_key));
+
         int num_encrypted_bytes = 0;
         int num_not_encrypted_at_end = 0;
-        bool ok = decrypt_TPL_AES_CBC_NO_IV(this, frame, pos, tpl_generated_key,
+        bool ok = decrypt_TPL_AES_CBC_NO_IV(this, frame, pos, tpl_generated_key.size() > 0 ? &generated_ctx : NULL,
                                             &num_encrypted_bytes,
                                             &num_not_encrypted_at_end);
         if (!ok)
@@ -1665,7 +1649,7 @@ bool Telegram::potentiallyDecrypt (std::vector<uchar>::iterator &pos)
                             "Permanently ignoring telegrams from id: %02x%02x%02x%02x mfct: (%s) %s (0x%02x) type: %s (0x%02x) ver: 0x%02x\n",
                             dll_id_b[3], dll_id_b[2], dll_id_b[1], dll_id_b[0],
                             manufacturerFlag(dll_mfct).c_str(),
-                            manufacturer(dll_mfct).c_str(),
+                            manufacturer(dll_mfct),
                             dll_mfct,
                             mediaType(dll_type, dll_mfct).c_str(), dll_type,
                             dll_version);
@@ -1699,7 +1683,7 @@ bool Telegram::potentiallyDecrypt (std::vector<uchar>::iterator &pos)
                 "id: %02x%02x%02x%02x mfct: (%s) %s (0x%02x) type: %s (0x%02x) ver: 0x%02x\n",
                 dll_id_b[3], dll_id_b[2], dll_id_b[1], dll_id_b[0],
                 manufacturerFlag(dll_mfct).c_str(),
-                manufacturer(dll_mfct).c_str(),
+                manufacturer(dll_mfct),
                 dll_mfct,
                 mediaType(dll_type, dll_mfct).c_str(), dll_type,
                 dll_version);
@@ -4152,194 +4136,186 @@ LIST_OF_AFL_AUTH_TYPES
     return AFLAuthenticationType::Reserved1;
 }
 
-bool trimCRCsFrameFormatAInternal(std::vector<uchar> &payload, bool fail_is_ok)
+const AES_ctx *MeterKeys::confidentialityContext()
 {
-    if (payload.size() < 12) {
-        if (!fail_is_ok)
-        {
-            debug("(wmbus) not enough bytes! expected at least 12 but got (%zu)!\n", payload.size());
-        }
-        return false;
-    }
-    size_t len = payload.size();
-    if (!fail_is_ok)
+    const AES_CMAC_ctx *ctx = confidentialityCMACContext();
+    return ctx ? &ctx->aes : NULL;
+}
+
+const AES_CMAC_ctx *MeterKeys::confidentialityCMACContext()
+{
+    if (confidentiality_key.size() == 0) return NULL;
+
+    // A key shorter than the AES key length is zero padded, longer keys are truncated.
+    uchar key[AES_KEYLEN] {};
+    memcpy(key, safeButUnsafeVectorPtr(confidentiality_key), std::min(confidentiality_key.size(), sizeof(key)));
+
+    if (!confidentiality_ctx_valid_ || memcmp(key, confidentiality_ctx_key_, sizeof(key)) != 0)
     {
-        debugPayload("(wmbus) trimming frame A", payload);
+        AES_CMAC_init(&confidentiality_ctx_, key);
+        memcpy(confidentiality_ctx_key_, key, sizeof(key));
+        confidentiality_ctx_valid_ = true;
     }
+    return &confidentiality_ctx_;
+}
 
-    std::vector<uchar> out;
+// Put back the crcs of the first num_blocks blocks, which were verified and
+// compacted to the start of p, so that a failed strip leaves p unchanged.
+static void restoreDLLCRCs(uchar *p, const size_t *blocks, int num_blocks)
+{
+    size_t out = 0;
+    for (int i = 0; i < num_blocks; ++i) out += blocks[i];
+    size_t in = out + 2*num_blocks;
 
-    uint16_t calc_crc = crc16_EN13757(safeButUnsafeVectorPtr(payload), 10);
-    uint16_t check_crc = payload[10] << 8 | payload[11];
+    for (int i = num_blocks-1; i >= 0; --i)
+    {
+        size_t n = blocks[i];
+        out -= n;
+        in -= n+2;
+        memmove(p+in, p+out, n);
+        uint16_t crc = crc16_EN13757(p+in, n);
+        p[in+n] = crc >> 8;
+        p[in+n+1] = crc & 0xff;
+    }
+}
 
-    if (calc_crc != check_crc && !FUZZING)
+// Verify and remove the dll crcs in a single pass, sliding every block down over
+// the crcs before it. Format is 'A', 'B' or 0 to pick it from the first block crc.
+static DLLCRCResult stripDLLCRCs(std::vector<uchar> &payload, char format, bool fail_is_ok)
+{
+    DLLCRCResult result;
+    size_t len = payload.size();
+    if (len < 12)
     {
         if (!fail_is_ok)
         {
-            debug("(wmbus) ff a dll crc first (calculated %04x) did not match (expected %04x) for bytes 0-%zu!\n", calc_crc, check_crc, 10);
+            debug("(wmbus) not enough bytes! expected at least 12 but got (%zu)!\n", len);
         }
-        return false;
+        result.failed_block = 0;
+        return result;
     }
-    out.insert(out.end(), payload.begin(), payload.begin()+10);
-    if (!fail_is_ok)
+    uchar *p = safeButUnsafeVectorPtr(payload);
+
+    if (format == 0)
     {
-        debug("(wmbus) ff a dll crc 0-%zu %04x ok\n", 10-1, calc_crc);
+        // Format A has a crc after the first 10 bytes, format B only by
+        // coincidence or when its L-field is 11. A format A frame with
+        // that L-field is 16 bytes long though.
+        Crc16En13757 crc;
+        crc.update(p, 10);
+        format = crc.matches(p+10) && !(p[0] == 11 && len < 16) ? 'A' : 'B';
     }
-
-    size_t pos = 12;
-    for (pos = 12; pos+18 <= len; pos += 18)
+    if (!fail_is_ok)
     {
-        size_t to = pos+16;
-        calc_crc = crc16_EN13757(&payload[pos], 16);
-        check_crc = payload[to] << 8 | payload[to+1];
-        if (calc_crc != check_crc && !FUZZING)
-        {
-            if (!fail_is_ok)
-            {
-                debug("(wmbus) ff a dll crc mid (calculated %04x) did not match (expected %04x) for bytes %zu-%zu!\n",
-                      calc_crc, check_crc, pos, to-1);
-            }
-            return false;
-        }
-        out.insert(out.end(), payload.begin()+pos, payload.begin()+pos+16);
-        if (!fail_is_ok)
-        {
-            debug("(wmbus) ff a dll crc mid %zu-%zu %04x ok\n", pos, to-1, calc_crc);
-        }
+        debugPayload(format == 'A' ? "(wmbus) trimming frame A" : "(wmbus) trimming frame B", payload);
     }
 
-    if (pos < len-2)
+    // The L-field does not count the crcs in format A but does in format B.
+    size_t data_len = p[0]+1;
+    size_t blocks[WMBUS_DLL_MAX_BLOCKS];
+    int num_blocks = 0;
+    if (format == 'A')
     {
-        size_t tto = len-2;
-        size_t blen = (tto-pos);
-        calc_crc = crc16_EN13757(&payload[pos], blen);
-        check_crc = payload[tto] << 8 | payload[tto+1];
-        if (calc_crc != check_crc && !FUZZING)
+        if (data_len >= 10)
         {
-            if (!fail_is_ok)
+            blocks[num_blocks++] = 10;
+            for (size_t left = data_len-10; left > 0; left -= blocks[num_blocks-1])
             {
-                debug("(wmbus) ff a dll crc final (calculated %04x) did not match (expected %04x) for bytes %zu-%zu!\n",
-                      calc_crc, check_crc, pos, tto-1);
+                blocks[num_blocks++] = std::min(left, (size_t)16);
             }
-            return false;
-        }
-        out.insert(out.end(), payload.begin()+pos, payload.begin()+tto);
-        if (!fail_is_ok)
-        {
-            debug("(wmbus) ff a dll crc final %zu-%zu %04x ok\n", pos, tto-1, calc_crc);
-        }
-    }
-
-    debugPayload("(wmbus) trimming frame A", payload);
-
-    out[0] = out.size()-1;
-    size_t new_len = out[0]+1;
-    size_t old_size = payload.size();
-    payload = out;
-    size_t new_size = payload.size();
-
-    debug("(wmbus) trimmed %zu dll crc bytes from frame a and ignored %zu suffix bytes.\n", (len-new_len), (old_size-new_size)-(len-new_len));
-    debugPayload("(wmbus) trimmed frame A", payload);
-
-    return true;
-}
-
-bool trimCRCsFrameFormatBInternal(std::vector<uchar> &payload, bool fail_is_ok)
-{
-    if (payload.size() < 12) {
-        if (!fail_is_ok)
-        {
-            debug("(wmbus) not enough bytes! expected at least 12 but got (%zu)!\n", payload.size());
         }
-        return false;
     }
-    size_t len = payload.size();
-    if (!fail_is_ok)
+    else if (data_len <= 128)
     {
-        debugPayload("(wmbus) trimming frame B", payload);
+        if (data_len > 2) blocks[num_blocks++] = data_len-2;
     }
-
-    std::vector<uchar> out;
-    size_t crc1_pos, crc2_pos;
-    if (len <= 128)
+    else if (data_len > 130)
     {
-        crc1_pos = len-2;
-        crc2_pos = 0;
+        blocks[num_blocks++] = 126;
+        blocks[num_blocks++] = data_len-130;
     }
-    else
-    {
-        crc1_pos = 126;
-        crc2_pos = len-2;
-    }
-
-    uint16_t calc_crc = crc16_EN13757(safeButUnsafeVectorPtr(payload), crc1_pos);
-    uint16_t check_crc = payload[crc1_pos] << 8 | payload[crc1_pos+1];
-
-    if (calc_crc != check_crc && !FUZZING)
+    if (num_blocks == 0)
     {
         if (!fail_is_ok)
         {
-            debug("(wmbus) ff b dll crc (calculated %04x) did not match (expected %04x) for bytes 0-%zu!\n", calc_crc, check_crc, crc1_pos);
+            debug("(wmbus) ff %c bad L-field %02x\n", format, p[0]);
         }
-        return false;
+        result.failed_block = 0;
+        return result;
     }
 
-    out.insert(out.end(), payload.begin(), payload.begin()+crc1_pos);
-    if (!fail_is_ok)
+    // A failing block 0 means the frame matched no format, so the format is
+    // only reported once the first block passed.
+    size_t in = 0, out = 0;
+    for (int i = 0; i < num_blocks; ++i)
     {
-        debug("(wmbus) ff b dll crc first 0-%zu %04x ok\n", crc1_pos, calc_crc);
-    }
-
-    if (crc2_pos > 0)
-    {
-        calc_crc = crc16_EN13757(&payload[crc1_pos+2], crc2_pos);
-        check_crc = payload[crc2_pos] << 8 | payload[crc2_pos+1];
-
-        if (calc_crc != check_crc && !FUZZING)
+        size_t n = blocks[i];
+        if (in+n+2 > len)
         {
             if (!fail_is_ok)
             {
-                debug("(wmbus) ff b dll crc (calculated %04x) did not match (expected %04x) for bytes %zu-%zu!\n",
-                      calc_crc, check_crc, crc1_pos+2, crc2_pos);
+                debug("(wmbus) ff %c dll block %d incomplete, needs bytes %zu-%zu but got %zu bytes!\n",
+                      format, i, in, in+n+1, len);
             }
-            return false;
+            restoreDLLCRCs(p, blocks, i);
+            result.format = i == 0 ? 0 : format;
+            result.failed_block = i;
+            return result;
         }
 
-        out.insert(out.end(), payload.begin()+crc1_pos+2, payload.begin()+crc2_pos);
+        Crc16En13757 crc;
+        crc.update(p+in, n);
+        if (!crc.matches(p+in+n) && !FUZZING)
+        {
+            if (!fail_is_ok)
+            {
+                debug("(wmbus) ff %c dll crc (calculated %04x) did not match (expected %04x) for block %d bytes %zu-%zu!\n",
+                      format, crc.value(), p[in+n] << 8 | p[in+n+1], i, in, in+n-1);
+            }
+            restoreDLLCRCs(p, blocks, i);
+            result.format = i == 0 ? 0 : format;
+            result.failed_block = i;
+            return result;
+        }
         if (!fail_is_ok)
         {
-            debug("(wmbus) ff b dll crc final %zu-%zu %04x ok\n", crc1_pos+2, crc2_pos, calc_crc);
+            debug("(wmbus) ff %c dll crc %zu-%zu %04x ok\n", format, in, in+n-1, crc.value());
         }
+
+        memmove(p+out, p+in, n);
+        out += n;
+        in += n+2;
     }
 
-    debugPayload("(wmbus) trimming frame B", payload);
+    p[0] = out-1;
+    payload.resize(out);
+    result.format = format;
 
-    out[0] = out.size()-1;
-    size_t new_len = out[0]+1;
-    size_t old_size = payload.size();
-    payload = out;
-    size_t new_size = payload.size();
+    debug("(wmbus) trimmed %zu dll crc bytes from frame %c and ignored %zu suffix bytes.\n",
+          in-out, format, len-in);
+    debugPayload(format == 'A' ? "(wmbus) trimmed frame A" : "(wmbus) trimmed frame B", payload);
 
-    debug("(wmbus) trimmed %zu dll crc bytes from frame b and ignored %zu suffix bytes.\n", (len-new_len), (old_size-new_size)-(len-new_len));
-    debugPayload("(wmbus) trimmed frame B", payload);
+    return result;
+}
 
-    return true;
+DLLCRCResult removeDLLCRCs(std::vector<uchar> &payload)
+{
+    return stripDLLCRCs(payload, 0, true);
 }
 
 void removeAnyDLLCRCs(std::vector<uchar> &payload)
 {
-    bool trimmed = trimCRCsFrameFormatAInternal(payload, true);
-    if (!trimmed) trimCRCsFrameFormatBInternal(payload, true);
+    stripDLLCRCs(payload, 0, true);
 }
 
 bool trimCRCsFrameFormatA(std::vector<uchar> &payload)
 {
-    return trimCRCsFrameFormatAInternal(payload, false);
+    return stripDLLCRCs(payload, 'A', false).ok();
 }
 
 bool trimCRCsFrameFormatB(std::vector<uchar> &payload)
 {
-    return trimCRCsFrameFormatBInternal(payload, false);
+    return stripDLLCRCs(payload, 'B', false).ok();
 }
 
 FrameStatus checkWMBusFrame (std::vector<uchar> &data,
@@ -19,6 +19,7 @@
 #define WMBUS_H
 
 #include"address.h"
+#include"aescmac.h"
 #include"dvparser.h"
 #include"manufacturers.h"
 #include"translatebits.h"
@@ -28,8 +29,23 @@
 #include<map>
 #include<set>
 
-// Check and remove the data link layer CRCs from a wmbus telegram.
-// If the CRCs do not pass the test, return false.
+// A format A frame has at most 17 crc protected blocks, format B at most 2.
+#define WMBUS_DLL_MAX_BLOCKS 17
+
+struct DLLCRCResult
+{
+    // 'A' or 'B' when the crc of the first block matched that frame format.
+    char format = 0;
+    // The first block, counting from 0, with a bad or missing crc. -1 if all matched.
+    int failed_block = -1;
+
+    bool ok() const { return format != 0 && failed_block < 0; }
+};
+
+// Check and remove the data link layer CRCs from a wmbus telegram in place.
+// The frame format is detected from the crc of the first block.
+// If the CRCs do not pass the test, the payload is left unchanged.
+DLLCRCResult removeDLLCRCs(std::vector<uchar> &payload);
 void removeAnyDLLCRCs(std::vector<uchar> &payload);
 bool trimCRCsFrameFormatA(std::vector<uchar> &payload);
 bool trimCRCsFrameFormatB(std::vector<uchar> &payload);
@@ -140,6 +156,17 @@ LIST_OF_LINK_MODES
 LIST_OF_LINK_MODES
 #undef X
 
+constexpr uint64_t toLinkModeBit(LinkMode lm)
+{
+    switch (lm)
+    {
+#define X(name,lcname,option,val) case LinkMode::name: return val;
+LIST_OF_LINK_MODES
+#undef X
+    }
+    return 0;
+}
+
 LinkMode toLinkMode(const char *arg);
 LinkMode isLinkModeOption(const char *arg);
 const char *toString(LinkMode lm);
@@ -284,6 +311,17 @@ struct MeterKeys
 
     bool hasConfidentialityKey() { return confidentiality_key.size() > 0; }
     bool hasAuthenticationKey() { return authentication_key.size() > 0; }
+
+    // The expanded AES key schedule and CMAC subkeys of the confidentiality key, or NULL
+    // if there is no key. They are computed once and only recomputed if the key is changed.
+    const AES_ctx *confidentialityContext();
+    const AES_CMAC_ctx *confidentialityCMACContext();
+
+private:
+
+    AES_CMAC_ctx confidentiality_ctx_ {};
+    uchar confidentiality_ctx_key_[AES_KEYLEN] {};
+    bool confidentiality_ctx_valid_ {};
 };
 
 enum class FrameType
@@ -466,6 +504,7 @@ public:
     void extractMfctData (std::vector<uchar> *pl); // Extract frame data after the DIF 0x0F.
 
     bool handled {}; // Set to true, when a meter has accepted the telegram.
+    bool payload_unchanged {}; // Set to true, when the payload repeated the previous one and no fields were extracted.
 
     bool parseHeader (std::vector<uchar> &input_frame);
     bool parse (std::vector<uchar> &input_frame, MeterKeys *mk, bool warn);
@@ -571,7 +610,7 @@ struct SendBusContent
 
 struct Meter;
 
-std::string manufacturer(int m_field);
+const char *manufacturer(int m_field);
 std::string mediaType(int a_field_device_type, int m_field);
 std::string mediaTypeJSON(int a_field_device_type, int m_field);
 bool isCiFieldOfType(int ci_field, CI_TYPE type);
@@ -20,17 +20,15 @@
 #include"util.h"
 #include"wmbus.h"
 
+#include<algorithm>
 #include<assert.h>
 #include<memory.h>
 
-bool decrypt_ELL_AES_CTR(Telegram *t, std::vector<uchar> &frame, std::vector<uchar>::iterator &pos, std::vector<uchar> &aeskey)
+bool decrypt_ELL_AES_CTR(Telegram *t, std::vector<uchar> &frame, std::vector<uchar>::iterator &pos, const AES_ctx *aes_ctx)
 {
-    if (aeskey.size() == 0) return true;
+    if (aes_ctx == NULL) return true;
 
-    std::vector<uchar> encrypted_bytes;
-    std::vector<uchar> decrypted_bytes;
-    encrypted_bytes.insert(encrypted_bytes.end(), pos, frame.end());
-    debugPayload("(ELL) decrypting", encrypted_bytes);
+    debugPayload("(ELL) decrypting", frame, pos);
 
     uchar iv[16];
     int i=0;
@@ -50,45 +48,28 @@ bool decrypt_ELL_AES_CTR(Telegram *t, std::vector<uchar> &frame, std::vector<uch
     // BC
     iv[i++] = 0;
 
-    std::vector<uchar> ivv(iv, iv+16);
-    std::string s = bin2hex(ivv);
-    debug("(ELL) IV %s\n", s.c_str());
+    debug("(ELL) IV %s\n", bin2hex(std::vector<uchar>(iv, iv+16)).c_str());
 
-    int block = 0;
-    for (size_t offset = 0; offset < encrypted_bytes.size(); offset += 16)
+    // The frame is decrypted in place, block by block.
+    uchar *data = safeButUnsafeVectorPtr(frame) + (pos-frame.begin());
+    size_t len = frame.end()-pos;
+    for (size_t offset = 0; offset < len; offset += 16)
     {
-        size_t block_size = 16;
-        if (offset + block_size > encrypted_bytes.size())
-        {
-            block_size = encrypted_bytes.size() - offset;
-        }
-
-        assert(block_size > 0 && block_size <= 16);
+        size_t block_size = std::min(len - offset, (size_t)16);
 
         // Generate the pseudo-random bits from the IV and the key.
         uchar xordata[16];
-        AES_ECB_encrypt(iv, safeButUnsafeVectorPtr(aeskey), xordata, 16);
-
-        // Xor the data with the pseudo-random bits to decrypt into tmp.
-        uchar tmp[block_size];
-        xorit(xordata, &encrypted_bytes[offset], tmp, block_size);
-
-        debug("(ELL) block %d block_size %d offset %zu\n", block, block_size, offset);
-        block++;
+        memcpy(xordata, iv, 16);
+        AES_ECB_encrypt(aes_ctx, xordata);
 
-        std::vector<uchar> tmpv(tmp, tmp+block_size);
-        debugPayload("(ELL) decrypted", tmpv);
+        // Xor the data with the pseudo-random bits to decrypt.
+        for (size_t j = 0; j < block_size; ++j) data[offset+j] ^= xordata[j];
 
-        decrypted_bytes.insert(decrypted_bytes.end(), tmpv.begin(), tmpv.end());
+        debug("(ELL) block %zu block_size %zu offset %zu\n", offset/16, block_size, offset);
 
         incrementIV(iv, sizeof(iv));
     }
-    debugPayload("(ELL) decrypted", decrypted_bytes);
-
-    // Remove the encrypted bytes.
-    frame.erase(pos, frame.end());
-    // Insert the decrypted bytes.
-    frame.insert(frame.end(), decrypted_bytes.begin(), decrypted_bytes.end());
+    debugPayload("(ELL) decrypted", frame, pos);
 
     return true;
 }
@@ -102,14 +83,12 @@ std::string frameTypeKamstrupC1(int ft) {
 bool decrypt_TPL_AES_CBC_IV(Telegram *t,
                             std::vector<uchar> &frame,
                             std::vector<uchar>::iterator &pos,
-                            std::vector<uchar> &aeskey,
+                            const AES_ctx *aes_ctx,
                             int *num_encrypted_bytes,
                             int *num_not_encrypted_at_end)
 {
-    std::vector<uchar> buffer;
-    buffer.insert(buffer.end(), pos, frame.end());
-
-    size_t num_bytes_to_decrypt = frame.end()-pos;
+    size_t num_bytes_available = frame.end()-pos;
+    size_t num_bytes_to_decrypt = num_bytes_available;
 
     if (t->tpl_num_encr_blocks)
     {
@@ -118,27 +97,27 @@ bool decrypt_TPL_AES_CBC_IV(Telegram *t,
 
     *num_encrypted_bytes = num_bytes_to_decrypt;
 
-    if (buffer.size() < num_bytes_to_decrypt)
+    if (num_bytes_available < num_bytes_to_decrypt)
     {
         warning("(TPL) warning: aes-cbc-iv decryption received less bytes than expected for decryption! "
                 "Got %zu bytes but expected at least %zu bytes since num encr blocks was %d.\n",
-                buffer.size(), num_bytes_to_decrypt,
+                num_bytes_available, num_bytes_to_decrypt,
                 t->tpl_num_encr_blocks);
-        num_bytes_to_decrypt = buffer.size();
+        num_bytes_to_decrypt = num_bytes_available;
         *num_encrypted_bytes = num_bytes_to_decrypt;
 
         // We must have at least 16 bytes to decrypt. Give up otherwise.
         if (num_bytes_to_decrypt < 16) return false;
     }
 
-    *num_not_encrypted_at_end = buffer.size()-num_bytes_to_decrypt;
+    *num_not_encrypted_at_end = num_bytes_available-num_bytes_to_decrypt;
 
     debug("(TPL) num encrypted blocks %zu (%d bytes and remaining unencrypted %zu bytes)\n",
-          t->tpl_num_encr_blocks, num_bytes_to_decrypt, buffer.size()-num_bytes_to_decrypt);
+          t->tpl_num_encr_blocks, num_bytes_to_decrypt, num_bytes_available-num_bytes_to_decrypt);
 
-    if (aeskey.size() == 0) return false;
+    if (aes_ctx == NULL) return false;
 
-    debugPayload("(TPL) AES CBC IV decrypting", buffer);
+    debugPayload("(TPL) AES CBC IV decrypting", frame, pos);
 
     // The content should be a multiple of 16 since we are using AES CBC mode.
     if (num_bytes_to_decrypt % 16 != 0)
@@ -176,42 +155,24 @@ bool decrypt_TPL_AES_CBC_IV(Telegram *t,
     // ACC
     for (int j=0; j<8; ++j) { iv[i++] = t->tpl_acc; }
 
-    std::vector<uchar> ivv(iv, iv+16);
-    std::string s = bin2hex(ivv);
-    debug("(TPL) IV %s\n", s.c_str());
+    debug("(TPL) IV %s\n", bin2hex(std::vector<uchar>(iv, iv+16)).c_str());
 
-    uchar buffer_data[num_bytes_to_decrypt];
-    memcpy(buffer_data, safeButUnsafeVectorPtr(buffer), num_bytes_to_decrypt);
-    uchar decrypted_data[num_bytes_to_decrypt];
-
-    AES_CBC_decrypt_buffer(decrypted_data, buffer_data, num_bytes_to_decrypt, safeButUnsafeVectorPtr(aeskey), iv);
-
-    // Remove the encrypted bytes.
-    frame.erase(pos, frame.end());
-
-    // Insert the decrypted bytes.
-    frame.insert(frame.end(), decrypted_data, decrypted_data+num_bytes_to_decrypt);
+    // Decrypt in place, any bytes after the encrypted blocks are left as they are.
+    AES_CBC_decrypt_buffer(aes_ctx, iv, safeButUnsafeVectorPtr(frame) + (pos-frame.begin()), num_bytes_to_decrypt);
 
     debugPayload("(TPL) decrypted ", frame, pos);
 
-    if (num_bytes_to_decrypt < buffer.size())
-    {
-        frame.insert(frame.end(), buffer.begin()+num_bytes_to_decrypt, buffer.end());
-        debugPayload("(TPL) appended  ", frame, pos);
-    }
     return true;
 }
 
-bool decrypt_TPL_AES_CBC_NO_IV(Telegram *t, std::vector<uchar> &frame, std::vector<uchar>::iterator &pos, std::vector<uchar> &aeskey,
+bool decrypt_TPL_AES_CBC_NO_IV(Telegram *t, std::vector<uchar> &frame, std::vector<uchar>::iterator &pos, const AES_ctx *aes_ctx,
                                int *num_encrypted_bytes,
                                int *num_not_encrypted_at_end)
 {
-    if (aeskey.size() == 0) return true;
+    if (aes_ctx == NULL) return true;
 
-    std::vector<uchar> buffer;
-    buffer.insert(buffer.end(), pos, frame.end());
-
-    size_t num_bytes_to_decrypt = buffer.size();
+    size_t num_bytes_available = frame.end()-pos;
+    size_t num_bytes_to_decrypt = num_bytes_available;
 
     if (t->tpl_num_encr_blocks)
     {
@@ -219,21 +180,19 @@ bool decrypt_TPL_AES_CBC_NO_IV(Telegram *t, std::vector<uchar> &frame, std::vect
     }
 
     *num_encrypted_bytes = num_bytes_to_decrypt;
-    if (buffer.size() < num_bytes_to_decrypt)
+    if (num_bytes_available < num_bytes_to_decrypt)
     {
         warning("(TPL) warning: aes-cbc-no-iv decryption received less bytes than expected for decryption! "
                 "Got %zu bytes but expected at least %zu bytes since num encr blocks was %d.\n",
-                buffer.size(), num_bytes_to_decrypt,
+                num_bytes_available, num_bytes_to_decrypt,
                 t->tpl_num_encr_blocks);
-        num_bytes_to_decrypt = buffer.size();
+        num_bytes_to_decrypt = num_bytes_available;
     }
 
-    *num_not_encrypted_at_end = buffer.size()-num_bytes_to_decrypt;
+    *num_not_encrypted_at_end = num_bytes_available-num_bytes_to_decrypt;
 
     debug("(TPL) num encrypted blocks %d (%d bytes and remaining unencrypted %d bytes)\n",
-          t->tpl_num_encr_blocks, num_bytes_to_decrypt, buffer.size()-num_bytes_to_decrypt);
-
-    if (aeskey.size() == 0) return false;
+          t->tpl_num_encr_blocks, num_bytes_to_decrypt, num_bytes_available-num_bytes_to_decrypt);
 
     // The content should be a multiple of 16 since we are using AES CBC mode.
     if (num_bytes_to_decrypt % 16 != 0)
@@ -248,29 +207,10 @@ bool decrypt_TPL_AES_CBC_NO_IV(Telegram *t, std::vector<uchar> &frame, std::vect
     uchar iv[16];
     memset(iv, 0, sizeof(iv));
 
-    std::vector<uchar> ivv(iv, iv+16);
-    std::string s = bin2hex(ivv);
-    debug("(TPL) IV %s\n", s.c_str());
-
-    uchar buffer_data[num_bytes_to_decrypt];
-    memcpy(buffer_data, safeButUnsafeVectorPtr(buffer), num_bytes_to_decrypt);
-    uchar decrypted_data[num_bytes_to_decrypt];
-
-    AES_CBC_decrypt_buffer(decrypted_data, buffer_data, num_bytes_to_decrypt, safeButUnsafeVectorPtr(aeskey), iv);
-
-    // Remove the encrypted bytes and any potentially not decryptes bytes after.
-    frame.erase(pos, frame.end());
-
-    // Insert the decrypted bytes.
-    frame.insert(frame.end(), decrypted_data, decrypted_data+num_bytes_to_decrypt);
+    // Decrypt in place, any bytes after the encrypted blocks are left as they are.
+    AES_CBC_decrypt_buffer(aes_ctx, iv, safeButUnsafeVectorPtr(frame) + (pos-frame.begin()), num_bytes_to_decrypt);
 
     debugPayload("(TPL) decrypted ", frame, pos);
 
-    if (num_bytes_to_decrypt < buffer.size())
-    {
-        frame.insert(frame.end(), buffer.begin()+num_bytes_to_decrypt, buffer.end());
-        debugPayload("(TPL) appended ", frame, pos);
-    }
-
     return true;
 }
@@ -21,11 +21,11 @@
 #include "util.h"
 #include "wmbus.h"
 
-bool decrypt_ELL_AES_CTR(Telegram *t, std::vector<uchar> &frame, std::vector<uchar>::iterator &pos, std::vector<uchar> &aeskey);
-bool decrypt_TPL_AES_CBC_IV(Telegram *t, std::vector<uchar> &frame, std::vector<uchar>::iterator &pos, std::vector<uchar> &aeskey,
+bool decrypt_ELL_AES_CTR(Telegram *t, std::vector<uchar> &frame, std::vector<uchar>::iterator &pos, const AES_ctx *aes_ctx);
+bool decrypt_TPL_AES_CBC_IV(Telegram *t, std::vector<uchar> &frame, std::vector<uchar>::iterator &pos, const AES_ctx *aes_ctx,
                             int *num_encrypted_bytes,
                             int *num_not_encrypted_at_end);
-bool decrypt_TPL_AES_CBC_NO_IV(Telegram *t, std::vector<uchar> &frame, std::vector<uchar>::iterator &pos, std::vector<uchar> &aeskey,
+bool decrypt_TPL_AES_CBC_NO_IV(Telegram *t, std::vector<uchar> &frame, std::vector<uchar>::iterator &pos, const AES_ctx *aes_ctx,
                                int *num_encrypted_bytes,
                                int *num_not_encrypted_at_end);
 
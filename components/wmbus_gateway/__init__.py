@@ -0,0 +1,144 @@
+import esphome.codegen as cg
+import esphome.config_validation as cv
+from esphome import automation
+from esphome.components.wmbus_common import validate_driver
+from esphome.components.wmbus_meter import (
+    CONF_METER_ID,
+    CONF_ON_TELEGRAM,
+    CONF_RADIO_ID,
+    CONF_SKIP_UNCHANGED,
+    hex_key_validator,
+    meter_id_validator,
+)
+from esphome.components.wmbus_radio import RadioComponent
+from esphome.const import (
+    CONF_ID,
+    CONF_KEY,
+    CONF_TRIGGER_ID,
+    CONF_TYPE,
+)
+
+CONF_KEYS = "keys"
+CONF_KEYS_FILE = "keys_file"
+CONF_KEYS_DATA_ID = "keys_data_id"
+CONF_MAX_METERS = "max_meters"
+CONF_MIN_FREE_HEAP = "min_free_heap"
+
+CODEOWNERS = ["@kubasaw"]
+
+DEPENDENCIES = ["wmbus_radio"]
+
+MULTI_CONF = True
+
+
+wmbus_gateway_ns = cg.esphome_ns.namespace("wmbus_gateway")
+Gateway = wmbus_gateway_ns.class_("Gateway", cg.Component)
+GatewayMeter = wmbus_gateway_ns.class_("GatewayMeter")
+GatewayMeterRef = GatewayMeter.operator("ref")
+TelegramTrigger = wmbus_gateway_ns.class_(
+    "TelegramTrigger",
+    automation.Trigger.template(GatewayMeterRef),
+)
+GatewayAddKeyAction = wmbus_gateway_ns.class_("GatewayAddKeyAction", automation.Action)
+GatewayRemoveKeyAction = wmbus_gateway_ns.class_(
+    "GatewayRemoveKeyAction", automation.Action
+)
+
+
+def keys_validator(keys):
+    if not isinstance(keys, dict):
+        raise cv.Invalid("Expected a mapping of meter ids to keys")
+    return {
+        meter_id_validator(str(meter_id)): hex_key_validator(key)
+        for meter_id, key in keys.items()
+    }
+
+
+CONFIG_SCHEMA = cv.All(
+    cv.Schema(
+        {
+            cv.GenerateID(): cv.declare_id(Gateway),
+            cv.GenerateID(CONF_RADIO_ID): cv.use_id(RadioComponent),
+            cv.Optional(CONF_TYPE, default="auto"): cv.Any(
+                cv.one_of("auto", lower=True), validate_driver
+            ),
+            cv.Optional(CONF_KEYS): keys_validator,
+            cv.Optional(CONF_KEYS_FILE): cv.string_strict,
+            cv.GenerateID(CONF_KEYS_DATA_ID): cv.declare_id(cg.uint8),
+            cv.Optional(CONF_METER_ID): cv.string_strict,
+            cv.Optional(CONF_MAX_METERS, default=32): cv.int_range(min=1, max=1000),
+            cv.Optional(CONF_MIN_FREE_HEAP, default=16384): cv.int_range(min=0),
+            cv.Optional(CONF_SKIP_UNCHANGED, default=False): cv.boolean,
+            cv.Optional(CONF_ON_TELEGRAM): automation.validate_automation(
+                {cv.GenerateID(CONF_TRIGGER_ID): cv.declare_id(TelegramTrigger)},
+            ),
+        }
+    ).extend(cv.COMPONENT_SCHEMA),
+    cv.has_at_least_one_key(CONF_KEYS, CONF_KEYS_FILE, CONF_METER_ID),
+)
+
+
+async def to_code(config):
+    gateway = cg.new_Pvariable(config[CONF_ID])
+    cg.add(gateway.set_driver(config[CONF_TYPE]))
+    cg.add(gateway.set_max_meters(config[CONF_MAX_METERS]))
+    cg.add(gateway.set_min_free_heap(config[CONF_MIN_FREE_HEAP]))
+    cg.add(gateway.set_skip_unchanged(config[CONF_SKIP_UNCHANGED]))
+    if CONF_METER_ID in config:
+        cg.add(gateway.set_meter_id(config[CONF_METER_ID]))
+
+    if keys := config.get(CONF_KEYS):
+        # Kept in flash as packed records of KEY_TABLE_RECORD_SIZE bytes, sorted once at boot.
+        records = []
+        for meter_id, key in keys.items():
+            records += int(meter_id, 16).to_bytes(4, "big") + bytes.fromhex(key)
+        data = cg.progmem_array(config[CONF_KEYS_DATA_ID], records)
+        cg.add(gateway.load_keys(data, len(keys)))
+    if CONF_KEYS_FILE in config:
+        cg.add(gateway.set_keys_file(config[CONF_KEYS_FILE]))
+
+    radio = await cg.get_variable(config[CONF_RADIO_ID])
+    cg.add(gateway.set_radio(radio))
+    await cg.register_component(gateway, config)
+
+    for conf in config.get(CONF_ON_TELEGRAM, []):
+        trig = cg.new_Pvariable(conf[CONF_TRIGGER_ID], gateway)
+        await automation.build_automation(
+            trig,
+            [(GatewayMeterRef, "meter")],
+            conf,
+        )
+
+
+KEY_ACTION_SCHEMA = cv.Schema(
+    {
+        cv.GenerateID(): cv.use_id(Gateway),
+        cv.Required(CONF_METER_ID): cv.templatable(cv.string_strict),
+    }
+)
+
+
+@automation.register_action(
+    "wmbus_gateway.add_key",
+    GatewayAddKeyAction,
+    KEY_ACTION_SCHEMA.extend({cv.Required(CONF_KEY): cv.templatable(cv.string_strict)}),
+)
+async def wmbus_gateway_add_key_to_code(config, action_id, template_arg, args):
+    paren = await cg.get_variable(config[CONF_ID])
+    var = cg.new_Pvariable(action_id, template_arg, paren)
+    meter_id = await cg.templatable(config[CONF_METER_ID], args, cg.std_string)
+    cg.add(var.set_meter_id(meter_id))
+    key = await cg.templatable(config[CONF_KEY], args, cg.std_string)
+    cg.add(var.set_key(key))
+    return var
+
+
+@automation.register_action(
+    "wmbus_gateway.remove_key", GatewayRemoveKeyAction, KEY_ACTION_SCHEMA
+)
+async def wmbus_gateway_remove_key_to_code(config, action_id, template_arg, args):
+    paren = await cg.get_variable(config[CONF_ID])
+    var = cg.new_Pvariable(action_id, template_arg, paren)
+    meter_id = await cg.templatable(config[CONF_METER_ID], args, cg.std_string)
+    cg.add(var.set_meter_id(meter_id))
+    return var
@@ -0,0 +1,52 @@
+#pragma once
+#include "esphome/core/automation.h"
+
+#include "wmbus_gateway.h"
+
+namespace esphome
+{
+    namespace wmbus_gateway
+    {
+        class TelegramTrigger : public Trigger<GatewayMeter &>
+        {
+        public:
+            explicit TelegramTrigger(Gateway *gateway)
+            {
+                gateway->on_telegram([this](GatewayMeter &meter)
+                                     { this->trigger(meter); });
+            }
+        };
+
+        template <typename... Ts>
+        class GatewayAddKeyAction : public Action<Ts...>
+        {
+        public:
+            GatewayAddKeyAction(Gateway *parent) : parent_(parent) {}
+
+            TEMPLATABLE_VALUE(std::string, meter_id)
+            TEMPLATABLE_VALUE(std::string, key)
+
+            void play(Ts... x) override
+            {
+                this->parent_->add_key(this->meter_id_.value(x...), this->key_.value(x...));
+            }
+
+        protected:
+            Gateway *parent_;
+        };
+
+        template <typename... Ts>
+        class GatewayRemoveKeyAction : public Action<Ts...>
+        {
+        public:
+            GatewayRemoveKeyAction(Gateway *parent) : parent_(parent) {}
+
+            TEMPLATABLE_VALUE(std::string, meter_id)
+
+            void play(Ts... x) override { this->parent_->remove_key(this->meter_id_.value(x...)); }
+
+        protected:
+            Gateway *parent_;
+        };
+    }
+}
@@ -0,0 +1,220 @@
+#include "key_table.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+
+#include "esphome/core/log.h"
+
+namespace esphome
+{
+    namespace wmbus_gateway
+    {
+        static const char *TAG = "wmbus_gateway.keys";
+
+        // Average number of keys per bucket the index is sized for.
+        static const size_t BUCKET_LOAD = 4;
+
+        static int hex_digit(char c)
+        {
+            if (c >= '0' && c <= '9')
+                return c - '0';
+            if (c >= 'a' && c <= 'f')
+                return c - 'a' + 10;
+            if (c >= 'A' && c <= 'F')
+                return c - 'A' + 10;
+            return -1;
+        }
+
+        bool KeyTable::parse_id(const char *s, uint32_t *id)
+        {
+            if (s[0] == '0' && (s[1] == 'x' || s[1] == 'X'))
+                s += 2;
+            uint32_t value = 0;
+            size_t digits = 0;
+            for (; *s; s++, digits++)
+            {
+                int d = hex_digit(*s);
+                if (d < 0 || digits == 8)
+                    return false;
+                value = value << 4 | d;
+            }
+            if (digits == 0)
+                return false;
+            *id = value;
+            return true;
+        }
+
+        bool KeyTable::parse_key(const char *s, uint8_t *key)
+        {
+            if (strlen(s) != 2 * KEY_SIZE)
+                return false;
+            for (size_t i = 0; i < KEY_SIZE; i++)
+            {
+                int hi = hex_digit(s[2 * i]);
+                int lo = hex_digit(s[2 * i + 1]);
+                if (hi < 0 || lo < 0)
+                    return false;
+                key[i] = hi << 4 | lo;
+            }
+            return true;
+        }
+
+        void KeyTable::add(uint32_t id, const uint8_t *key)
+        {
+            auto b = this->bucket_(id);
+            auto pos = this->entries_.begin() + this->index_[b];
+            auto end = this->entries_.begin() + this->index_[b + 1];
+            for (; pos != end && hash_(pos->id) <= hash_(id); ++pos)
+            {
+                if (pos->id == id)
+                {
+                    memcpy(pos->key, key, KEY_SIZE);
+                    return;
+                }
+            }
+
+            KeyTableEntry entry;
+            entry.id = id;
+            memcpy(entry.key, key, KEY_SIZE);
+            this->entries_.insert(pos, entry);
+
+            if (this->entries_.size() > BUCKET_LOAD * (this->index_.size() - 1))
+                this->rebuild_index_();
+            else
+                for (auto i = b + 1; i < this->index_.size(); i++)
+                    this->index_[i]++;
+        }
+
+        bool KeyTable::remove(uint32_t id)
+        {
+            auto b = this->bucket_(id);
+            for (auto i = this->index_[b]; i < this->index_[b + 1]; i++)
+            {
+                if (this->entries_[i].id != id)
+                    continue;
+                this->entries_.erase(this->entries_.begin() + i);
+                for (auto j = b + 1; j < this->index_.size(); j++)
+                    this->index_[j]--;
+                return true;
+            }
+            return false;
+        }
+
+        const uint8_t *KeyTable::find(uint32_t id) const
+        {
+            auto b = this->bucket_(id);
+            for (auto i = this->index_[b]; i < this->index_[b + 1]; i++)
+                if (this->entries_[i].id == id)
+                    return this->entries_[i].key;
+            return nullptr;
+        }
+
+        void KeyTable::load(const uint8_t *records, size_t count)
+        {
+            this->entries_.reserve(this->entries_.size() + count);
+            for (size_t i = 0; i < count; i++, records += KEY_TABLE_RECORD_SIZE)
+            {
+                KeyTableEntry entry;
+                entry.id = (uint32_t)records[0] << 24 | (uint32_t)records[1] << 16 | (uint32_t)records[2] << 8 | records[3];
+                memcpy(entry.key, records + 4, KEY_SIZE);
+                this->entries_.push_back(entry);
+            }
+            this->sort_();
+            this->rebuild_index_();
+        }
+
+        int KeyTable::load_file(const std::string &path)
+        {
+            FILE *file = fopen(path.c_str(), "r");
+            if (!file)
+            {
+                ESP_LOGE(TAG, "Cannot open %s", path.c_str());
+                return -1;
+            }
+
+            int count = 0;
+            int line_number = 0;
+            char line[128];
+            while (fgets(line, sizeof(line), file))
+            {
+                line_number++;
+                // Strip the whitespace and split at the comma.
+                char *id = line;
+                while (*id == ' ' || *id == '\t')
+                    id++;
+                auto end = id + strlen(id);
+                while (end > id && (end[-1] == '\n' || end[-1] == '\r' || end[-1] == ' ' || end[-1] == '\t'))
+                    *--end = 0;
+                if (*id == 0 || *id == '#')
+                    continue;
+
+                char *key = strchr(id, ',');
+                KeyTableEntry entry;
+                if (key)
+                {
+                    for (auto p = key; p > id && (p[-1] == ' ' || p[-1] == '\t'); p--)
+                        p[-1] = 0;
+                    *key++ = 0;
+                    while (*key == ' ' || *key == '\t')
+                        key++;
+                }
+                if (!key || !parse_id(id, &entry.id) || !parse_key(key, entry.key))
+                {
+                    ESP_LOGW(TAG, "%s:%d: expected <meter id>,<key>", path.c_str(), line_number);
+                    continue;
+                }
+                this->entries_.push_back(entry);
+                count++;
+            }
+            fclose(file);
+
+            this->sort_();
+            this->rebuild_index_();
+            this->entries_.shrink_to_fit();
+            return count;
+        }
+
+        size_t KeyTable::memory_usage() const
+        {
+            return this->entries_.capacity() * sizeof(KeyTableEntry) + this->index_.capacity() * sizeof(uint32_t);
+        }
+
+        void KeyTable::sort_()
+        {
+            // Stable, so of the entries with the same id the one added last wins.
+            std::stable_sort(this->entries_.begin(), this->entries_.end(), [](const KeyTableEntry &a, const KeyTableEntry &b)
+                             { return hash_(a.id) < hash_(b.id); });
+            auto last = this->entries_.begin();
+            for (auto it = this->entries_.begin(); it != this->entries_.end(); ++it)
+            {
+                if (last != this->entries_.begin() && (last - 1)->id == it->id)
+                    *(last - 1) = *it;
+                else
+                    *last++ = *it;
+            }
+            this->entries_.erase(last, this->entries_.end());
+        }
+
+        void KeyTable::rebuild_index_()
+        {
+            // At least two buckets, so the shift stays below 32.
+            uint8_t bits = 1;
+            while (bits < 24 && ((size_t)1 << bits) * BUCKET_LOAD < this->entries_.size())
+                bits++;
+            this->shift_ = 32 - bits;
+
+            size_t buckets = (size_t)1 << bits;
+            this->index_.assign(buckets + 1, 0);
+            size_t i = 0;
+            for (size_t b = 0; b < buckets; b++)
+            {
+                this->index_[b] = i;
+                while (i < this->entries_.size() && this->bucket_(this->entries_[i].id) == b)
+                    i++;
+            }
+            this->index_[buckets] = i;
+            this->index_.shrink_to_fit();
+        }
+    }
+}
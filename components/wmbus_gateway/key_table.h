@@ -0,0 +1,64 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace esphome
+{
+    namespace wmbus_gateway
+    {
+        static const size_t KEY_SIZE = 16;
+        // A packed entry as loaded by KeyTable::load(), the big endian meter id and the key.
+        static const size_t KEY_TABLE_RECORD_SIZE = 4 + KEY_SIZE;
+
+        struct KeyTableEntry
+        {
+            uint32_t id;
+            uint8_t key[KEY_SIZE];
+        };
+
+        // The AES keys of many meters, looked up by numeric meter id.
+        // The entries are kept in one array sorted by a hash of the id. A bucket is the range
+        // of entries sharing the top bits of the hash, and an index of bucket starts makes a
+        // lookup one index read and a scan of a few entries, whether the id is known or not.
+        // That costs 20 bytes per key plus 4 bytes per bucket of 4 keys on average.
+        class KeyTable
+        {
+        public:
+            KeyTable() { this->rebuild_index_(); }
+
+            // Adds the key, or replaces the key already stored for the id.
+            void add(uint32_t id, const uint8_t *key);
+            bool remove(uint32_t id);
+            // The key of the meter, nullptr when unknown. Valid until the next change.
+            const uint8_t *find(uint32_t id) const;
+
+            // Adds count packed records of KEY_TABLE_RECORD_SIZE bytes, for example from flash.
+            // Sorts once, so this is much faster than adding the keys one by one.
+            void load(const uint8_t *records, size_t count);
+            // Adds the keys from a text file with one "<meter id>,<key>" line per meter, both in
+            // hex. Empty lines and lines starting with # are skipped. Returns the number of keys
+            // read, or -1 when the file cannot be opened.
+            int load_file(const std::string &path);
+
+            size_t size() const { return this->entries_.size(); }
+            size_t memory_usage() const;
+
+            // Parse a meter id of up to 8 and a key of exactly 32 hex digits.
+            static bool parse_id(const char *s, uint32_t *id);
+            static bool parse_key(const char *s, uint8_t *key);
+
+        protected:
+            static uint32_t hash_(uint32_t id) { return id * 2654435761u; }
+            size_t bucket_(uint32_t id) const { return hash_(id) >> this->shift_; }
+            void sort_();
+            void rebuild_index_();
+
+            std::vector<KeyTableEntry> entries_;
+            // Entries of bucket b are entries_[index_[b]] up to entries_[index_[b + 1]].
+            std::vector<uint32_t> index_;
+            uint8_t shift_{31};
+        };
+    }
+}
@@ -0,0 +1,244 @@
+#include "wmbus_gateway.h"
+
+#include <cinttypes>
+
+#include <esp_heap_caps.h>
+
+#include "esphome/core/application.h"
+
+namespace esphome
+{
+    namespace wmbus_gateway
+    {
+        static const char *TAG = "wmbus_gateway";
+
+        std::string GatewayMeter::get_id() const
+        {
+            return this->meter->addressExpressions()[0].id;
+        }
+
+        std::string GatewayMeter::get_driver_name() const
+        {
+            return this->meter->driverName().str();
+        }
+
+        std::string GatewayMeter::as_json(bool pretty_print)
+        {
+            return this->render_json(pretty_print);
+        }
+
+        const std::string &GatewayMeter::render_json(bool pretty_print)
+        {
+            this->meter->printMeter(this->last_telegram.get(), nullptr, nullptr, '\t', &this->json_buffer, nullptr, nullptr, nullptr, pretty_print);
+            return this->json_buffer;
+        }
+
+        std::string GatewayMeter::as_cbor()
+        {
+            std::string cbor;
+            this->meter->printMeterCbor(this->last_telegram.get(), &cbor);
+            return cbor;
+        }
+
+        std::string GatewayMeter::cbor_dictionary()
+        {
+            std::string cbor;
+            this->meter->printMeterCborDictionary(&cbor);
+            return cbor;
+        }
+
+        void Gateway::set_radio(wmbus_radio::Radio *radio)
+        {
+            this->radio = radio;
+            radio->add_frame_handler([this](wmbus_radio::Frame *frame)
+                                     { return this->handle_frame(frame); });
+        }
+
+        void Gateway::setup()
+        {
+            if (!this->meter_id.empty())
+            {
+                if (!isValidSequenceOfAddressExpressions(this->meter_id))
+                {
+                    ESP_LOGE(TAG, "Invalid meter_id %s", this->meter_id.c_str());
+                    this->mark_failed();
+                    return;
+                }
+                this->address_expressions = splitAddressExpressions(this->meter_id);
+            }
+
+            if (this->keys_file.empty())
+                return;
+            auto count = this->keys.load_file(this->keys_file);
+            if (count >= 0)
+                ESP_LOGI(TAG, "Loaded %d keys from %s", count, this->keys_file.c_str());
+        }
+
+        bool Gateway::add_key(const std::string &meter_id, const std::string &key)
+        {
+            uint32_t id;
+            uint8_t key_bytes[KEY_SIZE];
+            if (!KeyTable::parse_id(meter_id.c_str(), &id) || !KeyTable::parse_key(key.c_str(), key_bytes))
+            {
+                ESP_LOGW(TAG, "Invalid meter id or key for %s", meter_id.c_str());
+                return false;
+            }
+            this->keys.add(id, key_bytes);
+            // A meter created with the old key is created again on its next telegram.
+            this->erase_meter(id);
+            return true;
+        }
+
+        bool Gateway::remove_key(const std::string &meter_id)
+        {
+            uint32_t id;
+            if (!KeyTable::parse_id(meter_id.c_str(), &id))
+                return false;
+            this->erase_meter(id);
+            return this->keys.remove(id);
+        }
+
+        void Gateway::on_telegram(std::function<void(GatewayMeter &)> &&callback)
+        {
+            this->on_telegram_callback_manager.add(std::move(callback));
+        }
+
+        void Gateway::handle_frame(wmbus_radio::Frame *frame)
+        {
+            auto about = AboutTelegram(App.get_friendly_name(), frame->rssi(), FrameType::WMBUS);
+
+            // Only the header is parsed to find the key, the meter parses the whole telegram.
+            Telegram header;
+            header.about = about;
+            if (!header.parseHeader(frame->data()))
+                return;
+
+            // The last address is the meter's own, the ones before may be of a repeater.
+            uint32_t id = 0;
+            const uint8_t *key = nullptr;
+            for (auto it = header.addresses.rbegin(); it != header.addresses.rend() && !key; ++it)
+            {
+                if (!it->id_numeric)
+                    continue;
+                id = it->id_value;
+                key = this->keys.find(id);
+            }
+            if (!key)
+            {
+                // Without a key, only the meters selected by meter_id are decoded.
+                bool used_wildcard = false;
+                if (this->address_expressions.empty() || !header.addresses.back().id_numeric ||
+                    !doesTelegramMatchExpressions(header.addresses, this->address_expressions, &used_wildcard))
+                    return;
+                id = header.addresses.back().id_value;
+            }
+
+            auto meter = this->find_meter(id);
+            if (!meter && !(meter = this->create_meter(id, key, &header)))
+                return;
+
+            std::vector<Address> addresses;
+            bool id_match = false;
+            auto telegram = std::make_unique<Telegram>();
+
+            meter->meter->handleTelegram(about, frame->data(), false, &addresses, &id_match, telegram.get());
+            if (!id_match)
+                return;
+            frame->mark_as_handled();
+
+            if (telegram->payload_unchanged && this->skip_unchanged)
+                return;
+
+            meter->last_telegram = std::move(telegram);
+            // By id, the meter may be gone when its key was changed in between.
+            this->defer([this, id]()
+                        { auto it = this->meters.find(id);
+                          if (it == this->meters.end() || !it->second->last_telegram)
+                            return;
+                          this->on_telegram_callback_manager(*it->second);
+                          it->second->last_telegram = nullptr; });
+        }
+
+        GatewayMeter *Gateway::find_meter(uint32_t id)
+        {
+            auto found = this->meters.find(id);
+            if (found == this->meters.end())
+                return nullptr;
+            this->pool.splice(this->pool.begin(), this->pool, found->second);
+            return &*found->second;
+        }
+
+        GatewayMeter *Gateway::create_meter(uint32_t id, const uint8_t *key, Telegram *header)
+        {
+            auto driver = this->driver;
+            if (driver == "auto")
+                driver = pickMeterDriver(header).name().str();
+
+            char meter_id[9];
+            snprintf(meter_id, sizeof(meter_id), "%08" PRIx32, id);
+            if (!lookupDriver(driver))
+            {
+                ESP_LOGV(TAG, "No driver for meter %s", meter_id);
+                return nullptr;
+            }
+
+            // Room is made first, the new meter is the largest allocation here.
+            this->evict_meters();
+
+            MeterInfo meter_info;
+            meter_info.parse(driver + '-' + meter_id, driver, std::string(meter_id) + ',', key ? format_hex(key, KEY_SIZE) : "");
+            auto meter = createMeter(&meter_info);
+            if (!meter)
+                return nullptr;
+
+            ESP_LOGD(TAG, "Created meter %s with driver %s", meter_id, meter->driverName().str().c_str());
+            this->pool.emplace_front(id, std::move(meter));
+            this->meters[id] = this->pool.begin();
+            return &this->pool.front();
+        }
+
+        void Gateway::evict_meters()
+        {
+            // Makes room for one more meter. Meters with a telegram waiting for on_telegram
+            // are kept, they were heard just now anyway.
+            auto it = this->pool.end();
+            while (it != this->pool.begin())
+            {
+                bool full = this->pool.size() >= this->max_meters;
+                if (!full && heap_caps_get_free_size(MALLOC_CAP_INTERNAL) >= this->min_free_heap)
+                    return;
+
+                --it;
+                if (it->last_telegram)
+                    continue;
+                ESP_LOGD(TAG, "Evicting meter %08" PRIx32 " [%s]", it->id, full ? "pool full" : "low memory");
+                this->meters.erase(it->id);
+                it = this->pool.erase(it);
+                this->evicted_meters++;
+            }
+        }
+
+        void Gateway::erase_meter(uint32_t id)
+        {
+            auto found = this->meters.find(id);
+            if (found == this->meters.end())
+                return;
+            this->pool.erase(found->second);
+            this->meters.erase(found);
+        }
+
+        void Gateway::dump_config()
+        {
+            ESP_LOGCONFIG(TAG, "wM-Bus Gateway:");
+            ESP_LOGCONFIG(TAG, "  Driver: %s", this->driver.c_str());
+            if (!this->keys_file.empty())
+                ESP_LOGCONFIG(TAG, "  Keys file: %s", this->keys_file.c_str());
+            ESP_LOGCONFIG(TAG, "  Keys: %zu [%zu bytes]", this->keys.size(), this->keys.memory_usage());
+            if (!this->meter_id.empty())
+                ESP_LOGCONFIG(TAG, "  Meter ID: %s", this->meter_id.c_str());
+            ESP_LOGCONFIG(TAG, "  Max meters: %zu", this->max_meters);
+            ESP_LOGCONFIG(TAG, "  Min free heap: %zu bytes", this->min_free_heap);
+            ESP_LOGCONFIG(TAG, "  Skip unchanged: %s", this->skip_unchanged ? "yes" : "no");
+        }
+    }
+}
@@ -0,0 +1,109 @@
+#pragma once
+#include <list>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "esphome/core/component.h"
+#include "esphome/core/helpers.h"
+
+#include "esphome/components/wmbus_radio/component.h"
+#include "esphome/components/wmbus_common/meters.h"
+
+#include "key_table.h"
+
+namespace esphome
+{
+    namespace wmbus_gateway
+    {
+        // A meter created by the gateway on its first telegram. It offers the same outputs as
+        // wmbus_meter::Meter, so the same lambdas and actions work in on_telegram.
+        class GatewayMeter
+        {
+        public:
+            GatewayMeter(uint32_t id, std::shared_ptr<::Meter> meter) : id(id), meter(std::move(meter)) {}
+
+            std::string get_id() const;
+            std::string get_driver_name() const;
+            int get_skipped_extractions() const { return this->meter->numSkippedExtractions(); }
+            // True in on_telegram for a telegram that repeated the previous payload.
+            bool is_unchanged() const { return this->last_telegram && this->last_telegram->payload_unchanged; }
+
+            std::string as_json(bool pretty_print = false);
+            // Renders into a buffer owned by the meter, valid until the next call.
+            const std::string &render_json(bool pretty_print = false);
+            std::string as_cbor();
+            std::string cbor_dictionary();
+
+        protected:
+            friend class Gateway;
+
+            uint32_t id;
+            std::shared_ptr<::Meter> meter;
+            std::unique_ptr<Telegram> last_telegram;
+            std::string json_buffer;
+        };
+
+        // Decodes the telegrams of every meter in a table of keys, and of the meters matching
+        // an address expression like *, without a wmbus_meter block per meter. The meters are
+        // created when their first telegram arrives and kept in a pool ordered by their last
+        // telegram, the least recently heard one is evicted when the pool is full or the heap
+        // runs low.
+        class Gateway : public Component
+        {
+        public:
+            void set_radio(wmbus_radio::Radio *radio);
+            // A driver name, or "auto" to pick the driver from the first telegram.
+            void set_driver(std::string driver) { this->driver = driver; };
+            void set_keys_file(std::string keys_file) { this->keys_file = keys_file; };
+            // Address expressions of the meters to decode without a key, for example * or 12*.
+            void set_meter_id(std::string meter_id) { this->meter_id = meter_id; };
+            void set_max_meters(size_t max_meters) { this->max_meters = max_meters; };
+            void set_min_free_heap(size_t min_free_heap) { this->min_free_heap = min_free_heap; };
+            // When set, a telegram repeating the previous payload does not trigger on_telegram.
+            void set_skip_unchanged(bool skip_unchanged) { this->skip_unchanged = skip_unchanged; };
+            // Packed records as described in key_table.h, generated from the YAML keys.
+            void load_keys(const uint8_t *records, size_t count) { this->keys.load(records, count); };
+
+            // Adds or replaces a key at runtime, false when the id or key cannot be parsed.
+            bool add_key(const std::string &meter_id, const std::string &key);
+            bool remove_key(const std::string &meter_id);
+
+            void setup() override;
+            void dump_config() override;
+            float get_setup_priority() const override { return setup_priority::DATA; }
+
+            void on_telegram(std::function<void(GatewayMeter &)> &&callback);
+
+            size_t get_key_count() const { return this->keys.size(); }
+            size_t get_meter_count() const { return this->meters.size(); }
+            uint32_t get_evicted_meters() const { return this->evicted_meters; }
+
+        protected:
+            void handle_frame(wmbus_radio::Frame *frame);
+            // The meter, moved to the front of the pool, or nullptr.
+            GatewayMeter *find_meter(uint32_t id);
+            GatewayMeter *create_meter(uint32_t id, const uint8_t *key, Telegram *header);
+            void evict_meters();
+            void erase_meter(uint32_t id);
+
+            wmbus_radio::Radio *radio;
+            std::string driver{"auto"};
+            std::string keys_file;
+            std::string meter_id;
+            std::vector<AddressExpression> address_expressions;
+            size_t max_meters{32};
+            size_t min_free_heap{16384};
+            bool skip_unchanged{false};
+
+            KeyTable keys;
+            // Most recently heard first.
+            std::list<GatewayMeter> pool;
+            std::unordered_map<uint32_t, std::list<GatewayMeter>::iterator> meters;
+            uint32_t evicted_meters{0};
+
+            CallbackManager<void(GatewayMeter &)> on_telegram_callback_manager;
+        };
+    }
+}
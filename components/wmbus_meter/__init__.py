@@ -9,6 +9,7 @@ from esphome.components.mqtt import (
 from esphome.components.wmbus_common import validate_driver
 from esphome.components.wmbus_radio import RadioComponent
 from esphome.const import (
+    CONF_FORMAT,
     CONF_ID,
     CONF_KEY,
     CONF_MODE,
@@ -20,6 +21,8 @@ from esphome.const import (
 CONF_METER_ID = "meter_id"
 CONF_RADIO_ID = "radio_id"
 CONF_ON_TELEGRAM = "on_telegram"
+CONF_ON_UNCHANGED = "on_unchanged"
+CONF_SKIP_UNCHANGED = "skip_unchanged"
 
 CODEOWNERS = ["@kubasaw"]
 
@@ -37,6 +40,10 @@ TelegramTrigger = wmbus_meter_ns.class_(
     "TelegramTrigger",
     automation.Trigger.template(MeterRef),
 )
+UnchangedTrigger = wmbus_meter_ns.class_(
+    "UnchangedTrigger",
+    automation.Trigger.template(MeterRef),
+)
 
 
 def hex_key_validator(key):
@@ -74,6 +81,10 @@ CONFIG_SCHEMA = cv.Schema(
         cv.Optional(CONF_ON_TELEGRAM): automation.validate_automation(
             {cv.GenerateID(CONF_TRIGGER_ID): cv.declare_id(TelegramTrigger)},
         ),
+        cv.Optional(CONF_ON_UNCHANGED): automation.validate_automation(
+            {cv.GenerateID(CONF_TRIGGER_ID): cv.declare_id(UnchangedTrigger)},
+        ),
+        cv.Optional(CONF_SKIP_UNCHANGED, default=False): cv.boolean,
         cv.Optional(CONF_MODE): cv.one_of("c1", "t1", lower=True),
     }
 ).extend(cv.COMPONENT_SCHEMA)
@@ -92,12 +103,13 @@ async def to_code(config):
             config.get(CONF_KEY, ""),
         )
     )
+    cg.add(meter.set_skip_unchanged(config[CONF_SKIP_UNCHANGED]))
 
     radio = await cg.get_variable(config[CONF_RADIO_ID])
     cg.add(meter.set_radio(radio))
     await cg.register_component(meter, config)
 
-    for conf in config.get(CONF_ON_TELEGRAM, []):
+    for conf in config.get(CONF_ON_TELEGRAM, []) + config.get(CONF_ON_UNCHANGED, []):
         trig = cg.new_Pvariable(conf[CONF_TRIGGER_ID], meter)
         await automation.build_automation(
             trig,
@@ -106,15 +118,23 @@ async def to_code(config):
         )
 
 
+TELEGRAM_PAYLOADS = {
+    "json": "return meter.as_json();",
+    "cbor": "return meter.as_cbor();",
+}
+
 TELEGRAM_MQTT_PUBLISH_ACTION_SCHEMA = cv.All(
     MQTT_PUBLISH_ACTION_SCHEMA.extend(
         {
             cv.Optional(CONF_PAYLOAD): cv.invalid(
                 "If you want to specify payload, use generic 'mqtt.publish' action"
-            )
+            ),
+            cv.Optional(CONF_FORMAT, default="json"): cv.one_of(
+                *TELEGRAM_PAYLOADS, lower=True
+            ),
         }
     ),
-    lambda c: {**c, CONF_PAYLOAD: cv.Lambda("return meter.as_json();")},
+    lambda c: {**c, CONF_PAYLOAD: cv.Lambda(TELEGRAM_PAYLOADS[c[CONF_FORMAT]])},
 )
 
 
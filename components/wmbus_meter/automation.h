@@ -17,6 +17,16 @@ namespace esphome
             }
         };
 
+        class UnchangedTrigger : public Trigger<Meter &>
+        {
+        public:
+            explicit UnchangedTrigger(Meter *meter)
+            {
+                meter->on_unchanged([this, meter]()
+                                    { this->trigger(*meter); });
+            }
+        };
+
     }
 
 }
@@ -17,6 +17,12 @@ namespace esphome
             Parented::set_parent(parent);
             this->parent_->on_telegram([this]()
                                        { this->handle_update(); });
+            // Only these fields change when the meter repeats its payload, on_telegram refreshes
+            // them unless such telegrams are skipped.
+            this->parent_->on_unchanged([this]()
+                                        { if (this->parent_->get_skip_unchanged() &&
+                                              (this->field_name == "rssi_dbm" || this->field_name == "timestamp"))
+                                            this->handle_update(); });
         }
 
         void BaseSensor::dump_config()
@@ -64,9 +64,17 @@ namespace esphome
 
             if (id_match)
             {
+                // Nothing but the timestamp and RSSI changed when the meter repeated its payload.
+                auto unchanged = telegram->payload_unchanged;
+                if (unchanged)
+                    ESP_LOGV(TAG, "Payload unchanged, %d extractions skipped", this->meter->numSkippedExtractions());
+
                 this->last_telegram = std::move(telegram);
-                this->defer([this]()
-                            { this->on_telegram_callback_manager();
+                this->defer([this, unchanged]()
+                            { if (unchanged)
+                                this->on_unchanged_callback_manager();
+                              if (!unchanged || !this->skip_unchanged)
+                                this->on_telegram_callback_manager();
                             this->last_telegram=nullptr; });
 
                 frame->mark_as_handled();
@@ -75,9 +83,28 @@ namespace esphome
 
         std::string Meter::as_json(bool pretty_print)
         {
-            std::string json;
-            this->meter->printMeter(this->last_telegram.get(), nullptr, nullptr, '\t', &json, nullptr, nullptr, nullptr, pretty_print);
-            return json;
+            return this->render_json(pretty_print);
+        }
+
+        const std::string &Meter::render_json(bool pretty_print)
+        {
+            // The buffer keeps its capacity, so the json grows in place only for the first telegrams.
+            this->meter->printMeter(this->last_telegram.get(), nullptr, nullptr, '\t', &this->json_buffer, nullptr, nullptr, nullptr, pretty_print);
+            return this->json_buffer;
+        }
+
+        std::string Meter::as_cbor()
+        {
+            std::string cbor;
+            this->meter->printMeterCbor(this->last_telegram.get(), &cbor);
+            return cbor;
+        }
+
+        std::string Meter::cbor_dictionary()
+        {
+            std::string cbor;
+            this->meter->printMeterCborDictionary(&cbor);
+            return cbor;
         }
 
         optional<std::string> Meter::get_string_field(std::string field_name)
@@ -115,5 +142,22 @@ namespace esphome
             this->on_telegram_callback_manager.add(std::move(callback));
         }
 
+        void Meter::on_unchanged(std::function<void()> &&callback)
+        {
+            this->on_unchanged_callback_manager.add(std::move(callback));
+        }
+
+        int Meter::get_skipped_extractions() const
+        {
+            if (!this->meter)
+                return 0;
+            return this->meter->numSkippedExtractions();
+        }
+
+        bool Meter::is_unchanged() const
+        {
+            return this->last_telegram && this->last_telegram->payload_unchanged;
+        }
+
     }
 }
@@ -14,15 +14,29 @@ namespace esphome
         public:
             void set_meter_params(std::string id, std::string driver, std::string key);
             void set_radio(wmbus_radio::Radio *radio);
+            // When set, a telegram repeating the previous payload does not trigger on_telegram.
+            void set_skip_unchanged(bool skip_unchanged) { this->skip_unchanged = skip_unchanged; };
+            bool get_skip_unchanged() const { return this->skip_unchanged; }
 
             void dump_config() override;
 
             void on_telegram(std::function<void()> &&callback);
+            // Called when the meter repeated the payload of its previous telegram, before on_telegram
+            // unless skip_unchanged is set.
+            void on_unchanged(std::function<void()> &&callback);
 
             std::string get_id() const;
             MeterType get_type() const;
+            int get_skipped_extractions() const;
+            // True in the triggers of a telegram that repeated the previous payload.
+            bool is_unchanged() const;
             
             std::string as_json(bool pretty_print = false);
+            // Renders into a buffer owned by the meter, valid until the next call.
+            const std::string &render_json(bool pretty_print = false);
+            // The same content as CBOR with integer keys, translated by cbor_dictionary().
+            std::string as_cbor();
+            std::string cbor_dictionary();
             optional<std::string> get_string_field(std::string field_name);
             optional<float> get_numeric_field(std::string field_name);
 
@@ -34,8 +48,11 @@ namespace esphome
 
             std::shared_ptr<::Meter> meter;
             std::unique_ptr<Telegram> last_telegram;
+            std::string json_buffer;
+            bool skip_unchanged{false};
 
             CallbackManager<void()> on_telegram_callback_manager;
+            CallbackManager<void()> on_unchanged_callback_manager;
 
             virtual void handle_frame(wmbus_radio::Frame *frame);
         };
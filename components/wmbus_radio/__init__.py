@@ -33,6 +33,7 @@ RadioTransceiver = radio_ns.class_("RadioTransceiver", spi.SPIDevice, cg.Compone
 Frame = radio_ns.class_("Frame")
 FrameOutputFormat = Frame.enum("OutputFormat")
 FramePtr = Frame.operator("ptr")
+FrameBinaryPieces = radio_ns.class_("FrameBinaryPieces")
 FrameTrigger = radio_ns.class_("FrameTrigger", automation.Trigger.template(FramePtr))
 
 TRANSCEIVER_NAMES = {
@@ -106,6 +107,7 @@ with suppress(ImportError):
                 "hex",
                 "raw",
                 "rtlwmbus",
+                "binary",
                 lower=True,
             ),
             cv.Optional(CONF_DATA): cv.invalid(
@@ -120,10 +122,12 @@ with suppress(ImportError):
         FRAME_SOCKET_SEND_SCHEMA,
     )
     async def send_frame_with_socket_to_code(config, action_id, template_arg, args):
-        output_type = {
-            "hex": cg.std_string,
-            "raw": cg.std_vector.template(cg.uint8),
-            "rtlwmbus": cg.std_string,
+        output_type, getter = {
+            "hex": (cg.std_string, "as_hex"),
+            "raw": (cg.std_vector.template(cg.uint8), "as_raw"),
+            "rtlwmbus": (cg.std_string, "as_rtlwmbus"),
+            # Sent from the frame's storage, the socket transmitter copies it once into its queue.
+            "binary": (FrameBinaryPieces, "as_binary_pieces"),
         }[config[CONF_FORMAT]]
 
         paren = await cg.get_variable(config[CONF_ID])
@@ -131,7 +135,7 @@ with suppress(ImportError):
             action_id, cg.TemplateArguments(output_type, *template_arg), paren
         )
         template_ = LambdaExpression(
-            f"return frame->as_{config[CONF_FORMAT]}();", args, ""
+            f"return frame->{getter}();", args, ""
         )
 
         cg.add(var.set_data(template_))
@@ -1,5 +1,9 @@
 #include "component.h"
 
+#include <algorithm>
+#include <cinttypes>
+#include <sys/time.h>
+
 #include "freertos/task.h"
 #include "freertos/queue.h"
 
@@ -24,12 +28,12 @@ namespace esphome
 
     void Radio::setup()
     {
-      ASSERT_SETUP(this->packet_queue_ = xQueueCreate(3, sizeof(Packet *)));
+      ASSERT_SETUP(this->frame_queue_ = xQueueCreate(3, sizeof(Frame *)));
 
       ASSERT_SETUP(xTaskCreate(
           (TaskFunction_t)this->receiver_task,
           "radio_recv",
-          3 * 1024,
+          4 * 1024,
           this,
           2,
           &(this->receiver_task_handle_)));
@@ -41,20 +45,17 @@ namespace esphome
 
     void Radio::loop()
     {
-      Packet *p;
-      if (xQueueReceive(this->packet_queue_, &p, 0) != pdPASS)
+      Frame *f;
+      if (xQueueReceive(this->frame_queue_, &f, 0) != pdPASS)
         return;
 
-      auto frame = p->convert_to_frame();
-
-      if (!frame)
-        return;
+      auto frame = std::unique_ptr<Frame>(f);
 
       ESP_LOGI(TAG, "Have data from radio (%zu bytes) [RSSI: %d, mode:%s]", frame->data().size(), frame->rssi(), toString(frame->link_mode()));
 
       uint8_t packet_handled = 0;
       for (auto &handler : this->handlers_)
-        handler(&frame.value());
+        handler(frame.get());
 
       ESP_LOGI(TAG, "Telegram handled by %d handlers", frame->handlers_count());
     }
@@ -77,6 +78,11 @@ namespace esphome
       }
       auto packet = std::make_unique<Packet>();
 
+      // The interrupt marks the start of the frame, which is the rx time of the binary record.
+      struct timeval now;
+      gettimeofday(&now, nullptr);
+      packet->set_rx_time_us((uint64_t)now.tv_sec * 1000000 + now.tv_usec);
+
       if (!this->radio->read_in_task(packet->rx_data_ptr(), packet->rx_capacity()))
       {
         ESP_LOGV(TAG, "Failed to read preamble");
@@ -96,13 +102,31 @@ namespace esphome
       }
 
       packet->set_rssi(this->radio->get_rssi());
-      auto packet_ptr = packet.get();
 
-      if (xQueueSend(this->packet_queue_, &packet_ptr, 0) == pdTRUE)
+      // Decode and check the DLL CRCs here, so corrupt frames are dropped in
+      // the receiver task and never reach loop().
+      DLLCRCResult dll_crc;
+      auto converted = packet.release()->convert_to_frame(&dll_crc);
+      if (dll_crc.failed_block >= 0)
+      {
+        auto block = std::min(dll_crc.failed_block, WMBUS_DLL_MAX_BLOCKS - 1);
+        this->dll_crc_failures_[block]++;
+        ESP_LOGD(TAG, "DLL CRC failed in block %d (format %c), %" PRIu32 " failures in this block so far",
+                 dll_crc.failed_block, dll_crc.format ? dll_crc.format : '?', this->dll_crc_failures_[block]);
+      }
+      if (!converted)
+      {
+        ESP_LOGV(TAG, "Dropping invalid frame");
+        return;
+      }
+      auto frame = std::make_unique<Frame>(std::move(*converted));
+      auto frame_ptr = frame.get();
+
+      if (xQueueSend(this->frame_queue_, &frame_ptr, 0) == pdTRUE)
       {
-        ESP_LOGV(TAG, "Queue items: %zu", uxQueueMessagesWaiting(this->packet_queue_));
+        ESP_LOGV(TAG, "Queue items: %zu", uxQueueMessagesWaiting(this->frame_queue_));
         ESP_LOGV(TAG, "Queue send success");
-        packet.release();
+        frame.release();
       }
       else
         ESP_LOGW(TAG, "Queue send failed");
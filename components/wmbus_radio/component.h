@@ -28,13 +28,17 @@ namespace esphome
 
       void add_frame_handler(std::function<void(Frame *)> &&callback);
 
+      // Frames dropped because of a bad DLL CRC, indexed by the first failing block.
+      const uint32_t *dll_crc_failures() const { return this->dll_crc_failures_; }
+
     protected:
       static void wakeup_receiver_task_from_isr(TaskHandle_t *arg);
       static void receiver_task(Radio *arg);
 
       RadioTransceiver *radio{nullptr};
       TaskHandle_t receiver_task_handle_{nullptr};
-      QueueHandle_t packet_queue_{nullptr};
+      QueueHandle_t frame_queue_{nullptr};
+      uint32_t dll_crc_failures_[WMBUS_DLL_MAX_BLOCKS] = {};
 
       std::vector<std::function<void(Frame *)>> handlers_;
     };
@@ -1,5 +1,6 @@
 #include "packet.h"
 
+#include <algorithm>
 #include <ctime>
 
 #include "esphome/core/helpers.h"
@@ -39,6 +40,11 @@ namespace esphome
             this->rssi_ = rssi;
         }
 
+        void Packet::set_rx_time_us(uint64_t rx_time_us)
+        {
+            this->rx_time_us_ = rx_time_us;
+        }
+
         // Get value of L-field
         uint8_t Packet::l_field()
         {
@@ -100,21 +106,36 @@ namespace esphome
             return total_length;
         }
 
-        std::optional<Frame> Packet::convert_to_frame()
+        std::optional<Frame> Packet::convert_to_frame(DLLCRCResult *dll_crc)
         {
             std::optional<Frame> frame = {};
 
-            if (this->link_mode() == LinkMode::T1 &&
-                this->expected_size() == this->data_.size())
+            if (this->link_mode() == LinkMode::T1)
             {
-                auto decoded_data = decode3of6(this->data_);
-                if (decoded_data)
-                    this->data_ = decoded_data.value();
+                auto decoded_data = this->expected_size() == this->data_.size()
+                                        ? decode3of6(this->data_)
+                                        : std::nullopt;
+                if (!decoded_data)
+                {
+                    delete this;
+                    return frame;
+                }
+                this->data_ = decoded_data.value();
             }
+            else if (this->link_mode() == LinkMode::C1 && this->data_.size() > 2)
+            {
+                // Drop the mode C preamble and block marker, the frame starts at the L-field
+                this->data_.erase(this->data_.begin(), this->data_.begin() + 2);
+            }
+
+            auto crc = removeDLLCRCs(this->data_);
+            if (dll_crc)
+                *dll_crc = crc;
+            this->dll_crc_ok_ = crc.ok();
 
-            removeAnyDLLCRCs(this->data_);
             int dummy;
-            if (checkWMBusFrame(this->data_, (size_t *)&dummy, &dummy, &dummy, false) == FrameStatus::FullFrame)
+            if (crc.ok() &&
+                checkWMBusFrame(this->data_, (size_t *)&dummy, &dummy, &dummy, false) == FrameStatus::FullFrame)
                 frame.emplace(this);
 
             delete this;
@@ -124,13 +145,17 @@ namespace esphome
 
         Frame::Frame(Packet *packet) : data_(std::move(packet->data_)),
                                        link_mode_(packet->link_mode_),
-                                       rssi_(packet->rssi_)
+                                       rssi_(packet->rssi_),
+                                       rx_time_us_(packet->rx_time_us_),
+                                       dll_crc_ok_(packet->dll_crc_ok_)
         {
         }
 
         std::vector<uint8_t> &Frame::data() { return this->data_; }
         LinkMode Frame::link_mode() { return this->link_mode_; }
         int8_t Frame::rssi() { return this->rssi_; }
+        uint64_t Frame::rx_time_us() { return this->rx_time_us_; }
+        bool Frame::dll_crc_ok() { return this->dll_crc_ok_; }
 
         std::vector<uint8_t> Frame::as_raw() { return this->data_; }
         std::string Frame::as_hex() { return format_hex(this->data_); }
@@ -150,11 +175,61 @@ namespace esphome
             output += ';';                            // size 1
             output += std::to_string(this->rssi_);    // size up to 4
             output += ";;;0x";                        // size 5
-            output += this->as_hex();                 // size 2 * frame.size()
+            // Hex encoded in place, lowercase like format_hex.
+            static const char *hex_digits = "0123456789abcdef";
+            for (auto byte : this->data_)             // size 2 * frame.size()
+            {
+                output += hex_digits[byte >> 4];
+                output += hex_digits[byte & 0x0f];
+            }
             output += "\n";                           // size 1
 
             return output;
         }
+        size_t Frame::binary_size()
+        {
+            return FRAME_RECORD_HEADER_SIZE + this->data_.size();
+        }
+
+        void Frame::write_binary_header(uint8_t *buffer)
+        {
+            auto p = buffer;
+            *p++ = FRAME_RECORD_VERSION;
+            *p++ = this->dll_crc_ok_ ? FRAME_RECORD_DLL_CRC_OK : 0;
+            for (int shift = 56; shift >= 0; shift -= 8)
+                *p++ = this->rx_time_us_ >> shift;
+            *p++ = (uint8_t)this->rssi_;
+            *p++ = (uint8_t)this->link_mode_;
+            *p++ = this->data_.size() >> 8;
+            *p++ = this->data_.size() & 0xff;
+        }
+
+        size_t Frame::write_binary(uint8_t *buffer, size_t capacity)
+        {
+            auto size = this->binary_size();
+            if (capacity < size || this->data_.size() > UINT16_MAX)
+                return 0;
+
+            this->write_binary_header(buffer);
+            std::copy(this->data_.begin(), this->data_.end(), buffer + FRAME_RECORD_HEADER_SIZE);
+
+            return size;
+        }
+
+        FrameBinaryPieces Frame::as_binary_pieces()
+        {
+            this->write_binary_header(this->binary_header_);
+            return {{{this->binary_header_, FRAME_RECORD_HEADER_SIZE},
+                     {this->data_.data(), this->data_.size()}}};
+        }
+
+        std::vector<uint8_t> Frame::as_binary()
+        {
+            std::vector<uint8_t> output(this->binary_size());
+            output.resize(this->write_binary(output.data(), output.size()));
+            return output;
+        }
+
         std::string Frame::meter_id()
         {
             Telegram telegram;
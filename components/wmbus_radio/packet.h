@@ -1,20 +1,37 @@
 #pragma once
+#include <array>
 #include <cstdint>
 #include <cstddef>
 #include <ctime>
 #include <optional>
 #include <string>
 #include <vector>
+#include <sys/uio.h>
 
 #include "esphome/core/helpers.h"
 #include "esphome/components/wmbus_common/wmbus.h"
 
+// Binary frame record written by Frame::write_binary, integers are big endian:
+//   uint8  version, FRAME_RECORD_VERSION
+//   uint8  flags, FRAME_RECORD_DLL_CRC_OK when the DLL CRCs were checked and removed
+//   uint64 rx time in microseconds since the unix epoch
+//   int8   rssi in dBm
+//   uint8  link mode, the LinkMode value from wmbus.h (T1 is 5, C1 is 7)
+//   uint16 frame length
+//   the frame bytes, without DLL CRCs
+#define FRAME_RECORD_VERSION (1)
+#define FRAME_RECORD_HEADER_SIZE (14)
+#define FRAME_RECORD_DLL_CRC_OK (0x01)
+
 namespace esphome
 {
     namespace wmbus_radio
     {
         struct Frame;
 
+        // The binary record as its header and the frame bytes, see Frame::as_binary_pieces.
+        using FrameBinaryPieces = std::array<struct iovec, 2>;
+
         struct Packet
         {
             friend class Frame;
@@ -26,8 +43,12 @@ namespace esphome
             size_t rx_capacity();
             bool calculate_payload_size();
             void set_rssi(int8_t rssi);
+            void set_rx_time_us(uint64_t rx_time_us);
 
-            std::optional<Frame> convert_to_frame();
+            // Decodes the packet and strips the DLL CRCs, the outcome of the CRC
+            // check is stored in dll_crc when given and the packet could be decoded.
+            // Deletes the packet.
+            std::optional<Frame> convert_to_frame(DLLCRCResult *dll_crc = nullptr);
 
         protected:
             std::vector<uint8_t> data_;
@@ -37,6 +58,8 @@ namespace esphome
 
             uint8_t l_field();
             int8_t rssi_ = 0;
+            uint64_t rx_time_us_ = 0;
+            bool dll_crc_ok_ = false;
 
             LinkMode link_mode();
             LinkMode link_mode_ = LinkMode::UNKNOWN;
@@ -51,10 +74,19 @@ namespace esphome
             std::vector<uint8_t> &data();
             LinkMode link_mode();
             int8_t rssi();
+            uint64_t rx_time_us();
+            bool dll_crc_ok();
 
             std::vector<uint8_t> as_raw();
             std::string as_hex();
             std::string as_rtlwmbus();
+            std::vector<uint8_t> as_binary();
+            // Writes the binary record into the buffer, returns its size or 0 if the buffer is too small.
+            size_t write_binary(uint8_t *buffer, size_t capacity);
+            size_t binary_size();
+            // The binary record without copying the frame bytes. The pieces point into the
+            // frame and stay valid while it is neither changed nor destroyed.
+            FrameBinaryPieces as_binary_pieces();
             std::string meter_id();
 
             void mark_as_handled();
@@ -64,7 +96,12 @@ namespace esphome
             std::vector<uint8_t> data_;
             LinkMode link_mode_;
             int8_t rssi_;
+            uint64_t rx_time_us_ = 0;
+            bool dll_crc_ok_ = false;
             uint8_t handlers_count_ = 0;
+            uint8_t binary_header_[FRAME_RECORD_HEADER_SIZE];
+
+            void write_binary_header(uint8_t *buffer);
         };
 
     }
@@ -0,0 +1,133 @@
+#!/usr/bin/env python3
+
+import argparse
+import re
+import sys
+from pathlib import Path
+
+# Resolve project root (parent of script directory) once
+script_dir = Path(__file__).resolve().parent
+parent_dir = script_dir.parent
+
+component_dir = parent_dir / "components" / "wmbus_common"
+
+ENTRY_RE = re.compile(
+    r"^X\((?P<key>[A-Z]{3}),MANFCODE\('(?P<a>[A-Z])','(?P<b>[A-Z])','(?P<c>[A-Z])'\),(?P<name>\"(?:[^\"\\]|\\.)*\")\)"
+)
+
+
+def manfcode(a, b, c):
+    return (ord(a) - 64) * 1024 + (ord(b) - 64) * 32 + (ord(c) - 64)
+
+
+def mix(key, seed):
+    # Must match manufacturerHash() in wmbus.cc.
+    x = ((key ^ seed) * 0x9E3779B1) & 0xFFFFFFFF
+    return x ^ (x >> 16)
+
+
+def parse_manufacturers(path):
+    entries = []
+    for line in path.read_text().splitlines():
+        m = ENTRY_RE.match(line)
+        if not m:
+            continue
+        code = manfcode(m["a"], m["b"], m["c"])
+        if m["key"] != m["a"] + m["b"] + m["c"]:
+            sys.exit(f"{path}: key {m['key']} does not match its MANFCODE")
+        entries.append((m["key"], code, m["name"]))
+    return entries
+
+
+def build_perfect_hash(keys):
+    """Hash-and-displace: keys are spread over buckets with seed 0, then every
+    bucket (largest first) gets the smallest seed that places all of its keys
+    in free slots of a table with exactly len(keys) entries."""
+    n = len(keys)
+    num_buckets = max(1, n // 4)
+    buckets = [[] for _ in range(num_buckets)]
+    for k in keys:
+        buckets[mix(k, 0) % num_buckets].append(k)
+
+    seeds = [0] * num_buckets
+    slots = [None] * n
+    for b in sorted(range(num_buckets), key=lambda b: -len(buckets[b])):
+        if not buckets[b]:
+            continue
+        seed = 1
+        while True:
+            placed = [mix(k, seed) % n for k in buckets[b]]
+            if len(set(placed)) == len(placed) and all(slots[p] is None for p in placed):
+                break
+            seed += 1
+            if seed > 0xFFFF:
+                sys.exit("No perfect hash found, change mix()")
+        seeds[b] = seed
+        for k, p in zip(buckets[b], placed):
+            slots[p] = k
+    return seeds, slots
+
+
+def generate(source, target):
+    entries = parse_manufacturers(source)
+    if not entries:
+        sys.exit(f"{source}: no manufacturers found")
+
+    # The first entry wins for codes listed twice, as with the old linear scan.
+    by_code = {}
+    for key, code, name in entries:
+        by_code.setdefault(code, (key, name))
+
+    seeds, slots = build_perfect_hash(sorted(by_code))
+
+    out = []
+    out.append("// Generated by scripts/generate_manufacturer_table.py from manufacturers.h, do not edit.")
+    out.append("#ifndef MANUFACTURER_TABLE_H")
+    out.append("#define MANUFACTURER_TABLE_H")
+    out.append("")
+    out.append("#include <stdint.h>")
+    out.append("")
+    out.append(f"#define MANUFACTURER_TABLE_SOURCE_ENTRIES {len(entries)}")
+    out.append("")
+    out.append("struct ManufacturerEntry")
+    out.append("{")
+    out.append("    uint16_t m_field;")
+    out.append("    const char *name;")
+    out.append("};")
+    out.append("")
+    out.append(f"static const uint16_t manufacturer_seeds_[{len(seeds)}] =")
+    out.append("{")
+    for i in range(0, len(seeds), 12):
+        out.append("    " + " ".join(f"{s}," for s in seeds[i : i + 12]))
+    out.append("};")
+    out.append("")
+    out.append(f"static const ManufacturerEntry manufacturer_table_[{len(slots)}] =")
+    out.append("{")
+    for code in slots:
+        key, name = by_code[code]
+        out.append(f"    {{ 0x{code:04x}, {name} }}, // {key}")
+    out.append("};")
+    out.append("")
+    out.append("#endif")
+    out.append("")
+
+    target.write_text("\n".join(out))
+
+
+def main():
+    parser = argparse.ArgumentParser(
+        description="Generate the perfect-hash manufacturer table from manufacturers.h."
+    )
+    parser.add_argument(
+        "--source", type=Path, default=component_dir / "manufacturers.h"
+    )
+    parser.add_argument(
+        "--target", type=Path, default=component_dir / "manufacturer_table.h"
+    )
+    args = parser.parse_args()
+
+    generate(args.source, args.target)
+
+
+if __name__ == "__main__":
+    main()
@@ -36,6 +36,9 @@ def main():
     tag_file = parent_dir / prefix / ".wmbusmeters_tag"
     tag_file.write_text(args.tag)
 
+    # Regenerate the manufacturer lookup table from the pulled manufacturers.h
+    run(f"{sys.executable} {script_dir / 'generate_manufacturer_table.py'}")
+
 
 if __name__ == "__main__":
     main()
@@ -0,0 +1,128 @@
+#!/usr/bin/env python3
+
+import argparse
+import socket
+import struct
+import sys
+
+# Must match the framed mode in components/socket_transmitter/socket_transmitter.h.
+MAGIC = b"WB"
+VERSION = 2
+HEADER = struct.Struct(">2sBBHI")
+RECORD_HEADER = struct.Struct(">H")
+
+
+class SequenceChecker:
+    """Reports batches lost on the way, or evicted from the transmitter's queue."""
+
+    def __init__(self):
+        self.expected = None
+
+    def check(self, header):
+        sequence = HEADER.unpack(header)[4]
+        if self.expected is not None and sequence != self.expected:
+            if sequence > self.expected:
+                print(f"# {sequence - self.expected} batches missing", file=sys.stderr)
+            else:
+                print(f"# sequence restarted at {sequence}", file=sys.stderr)
+        self.expected = sequence + 1
+
+
+def decode_batch(header, payload):
+    """Return the records of one batch, header is the 10 byte batch header."""
+    magic, version, count, length, _ = HEADER.unpack(header)
+    if magic != MAGIC or version != VERSION:
+        raise ValueError(f"Bad batch header {header.hex()}")
+    if len(payload) != length:
+        raise ValueError(f"Batch has {len(payload)} bytes, header says {length}")
+
+    records = []
+    pos = 0
+    while pos < length:
+        (size,) = RECORD_HEADER.unpack_from(payload, pos)
+        pos += RECORD_HEADER.size
+        records.append(payload[pos : pos + size])
+        pos += size
+    if pos != length or len(records) != count:
+        raise ValueError(f"Batch has {len(records)} records, header says {count}")
+    return records
+
+
+def read_exactly(conn, n):
+    data = b""
+    while len(data) < n:
+        chunk = conn.recv(n - len(data))
+        if not chunk:
+            return None
+        data += chunk
+    return data
+
+
+def print_record(record):
+    try:
+        text = record.decode()
+        if text.isprintable():
+            print(text)
+            return
+    except UnicodeDecodeError:
+        pass
+    print(record.hex())
+
+
+def serve_tcp(host, port):
+    server = socket.create_server((host, port))
+    sequence = SequenceChecker()
+    while True:
+        conn, peer = server.accept()
+        print(f"# connection from {peer[0]}:{peer[1]}", file=sys.stderr)
+        with conn:
+            while True:
+                header = read_exactly(conn, HEADER.size)
+                if header is None:
+                    break
+                length = HEADER.unpack(header)[3]
+                payload = read_exactly(conn, length)
+                if payload is None:
+                    break
+                records = decode_batch(header, payload)
+                sequence.check(header)
+                for record in records:
+                    print_record(record)
+
+
+def serve_udp(host, port):
+    server = socket.socket(socket.AF_INET, socket.SOCK_DGRAM)
+    server.bind((host, port))
+    sequence = SequenceChecker()
+    while True:
+        datagram, peer = server.recvfrom(65535)
+        try:
+            records = decode_batch(datagram[: HEADER.size], datagram[HEADER.size :])
+        except (ValueError, struct.error) as e:
+            print(f"# {peer[0]}:{peer[1]}: {e}", file=sys.stderr)
+            continue
+        sequence.check(datagram[: HEADER.size])
+        for record in records:
+            print_record(record)
+
+
+def main():
+    parser = argparse.ArgumentParser(
+        description="Receive and print the records of a socket_transmitter in framed mode."
+    )
+    parser.add_argument("--host", default="0.0.0.0")
+    parser.add_argument("--port", type=int, required=True)
+    parser.add_argument("--protocol", choices=["tcp", "udp"], default="tcp")
+    args = parser.parse_args()
+
+    try:
+        if args.protocol == "tcp":
+            serve_tcp(args.host, args.port)
+        else:
+            serve_udp(args.host, args.port)
+    except KeyboardInterrupt:
+        pass
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,117 @@
+// Checks the compiled AddressExpression matching against the string matching it
+// replaced, for every expression of up to 9 characters over 1, a, A and * and a set
+// of addresses decoded from telegrams or set from strings.
+#include "address.h"
+
+#include <cstdio>
+#include <string>
+#include <vector>
+
+// The string matcher before the expressions were compiled, verbatim.
+static bool baselineIdMatch(const std::string &s, std::string match)
+{
+    std::string id = s;
+    if (id.length() == 0) return false;
+
+    bool can_match = true;
+    while (id.length() > 0 && match.length() > 0 && match.front() != '*')
+    {
+        if (id.front() != match.front())
+        {
+            can_match = false;
+            break;
+        }
+        id.erase(0, 1);
+        match.erase(0, 1);
+    }
+
+    bool wildcard_used = false;
+    if (match.length() && match.front() == '*')
+    {
+        wildcard_used = true;
+        match.erase(0, 1);
+    }
+
+    if (can_match)
+    {
+        if (wildcard_used) can_match = match.length() == 0;
+        else can_match = match.length() == 0 && id.length() == 0;
+    }
+    return can_match;
+}
+
+static bool baselineMatch(const AddressExpression &e, const Address &a)
+{
+    if (!(e.mfct == 0xffff || e.mfct == a.mfct)) return false;
+    if (!(e.version == 0xff || e.version == a.version)) return false;
+    if (!(e.type == 0xff || e.type == a.type)) return false;
+    return baselineIdMatch(a.id, e.id);
+}
+
+int main()
+{
+    std::vector<AddressExpression> expressions;
+    const char alphabet[] = {'1', 'a', 'A', '*'};
+    for (int length = 0; length <= 9; length++)
+    {
+        long count = 1;
+        for (int i = 0; i < length; i++) count *= 4;
+        for (long k = 0; k < count; k++)
+        {
+            std::string s;
+            for (long x = k, i = 0; i < length; i++, x /= 4) s += alphabet[x % 4];
+            // The parser keeps the valid ones.
+            for (const char *prefix : {"", "!"})
+            {
+                AddressExpression e;
+                if (e.parse(prefix + s)) expressions.push_back(e);
+            }
+        }
+    }
+    for (const char *s : {"p0", "p1", "p250", "100002842941011B", "10000284a941011b", "12345678.M=PII.T=1b.V=01",
+                          "1*.V=01", "*.T=1b", "*.M=ABB", "a1*.M=abcd", "11111111.V!=66"})
+    {
+        AddressExpression e;
+        if (e.parse(s)) expressions.push_back(e);
+    }
+
+    std::vector<Address> addresses;
+    const uchar digits[] = {0x11, 0x1a, 0xa1, 0xaa};
+    for (int k = 0; k < 256; k++)
+    {
+        // Ids of 8 digits 1 and a, as decoded from a telegram.
+        std::vector<uchar> frame = {digits[k & 3], digits[(k >> 2) & 3], digits[(k >> 4) & 3], digits[(k >> 6) & 3],
+                                    0x30, 0x42, (uchar)(k % 3), (uchar)(0x1b + k % 2)};
+        Address a;
+        a.decodeIdFirst(frame.begin());
+        addresses.push_back(a);
+    }
+    for (const char *id : {"p0", "p1", "1", "11", "1111111", "111111111", "1111111A", "AAAAAAAA", "1a1a1a1a", ""})
+    {
+        Address a;
+        a.setId(id);
+        a.mfct = 0x4230;
+        addresses.push_back(a);
+        // An id set directly, without its numeric value.
+        a.id = id;
+        a.id_numeric = false;
+        addresses.push_back(a);
+    }
+
+    long checked = 0;
+    long failed = 0;
+    for (AddressExpression &e : expressions)
+    {
+        for (Address &a : addresses)
+        {
+            checked++;
+            bool expected = baselineMatch(e, a);
+            if (e.match(a) == expected) continue;
+            if (failed++ < 10)
+                printf("  %s against %s: expected %d\n", e.str().c_str(), a.str().c_str(), expected);
+        }
+    }
+    printf("  %zu expressions, %zu addresses, %ld pairs checked, %ld failed\n",
+           expressions.size(), addresses.size(), checked, failed);
+    return failed != 0;
+}
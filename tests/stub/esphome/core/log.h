@@ -0,0 +1,9 @@
+#pragma once
+// Stands in for the ESPHome logger, the host tests do not log.
+#define ESP_LOGE(tag, ...) do {} while (0)
+#define ESP_LOGW(tag, ...) do {} while (0)
+#define ESP_LOGI(tag, ...) do {} while (0)
+#define ESP_LOGD(tag, ...) do {} while (0)
+#define ESP_LOGV(tag, ...) do {} while (0)
+#define ESP_LOGVV(tag, ...) do {} while (0)
+#define ESP_LOGCONFIG(tag, ...) do {} while (0)
@@ -0,0 +1,138 @@
+// Checks the unit conversion table against the conversions it replaced, for every pair
+// of units. A conversion that multiplies by a folded constant can differ from the chain
+// of operations before in the last bits, so values may differ by rounding: at most
+// 1e-15 of the larger of the input and the result. Relative to the result alone the
+// difference is larger where a conversion cancels, like 32.0000001 F to C.
+#include "units.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+
+// The conversions before the table, verbatim.
+#define BASELINE_CONVERSIONS \
+    X(Second, Minute, {vto=vfrom/60.0;}) \
+    X(Minute, Second, {vto=vfrom*60.0;}) \
+    X(Second, Hour, {vto=vfrom/3600.0;}) \
+    X(Hour, Second, {vto=vfrom*3600.0;}) \
+    X(Year, Second, {vto=vfrom*3600.0*24.0*365.2425;}) \
+    X(Second, Year, {vto=vfrom/3600.0/24.0/365.2425;}) \
+    X(Minute, Hour, {vto=vfrom/60.0;}) \
+    X(Hour, Minute, {vto=vfrom*60.0;}) \
+    X(Minute, Year, {vto=vfrom/60.0/24.0/365.2425;}) \
+    X(Year, Minute, {vto=vfrom*60.0*24.0*365.2425;}) \
+    X(Hour, Year, {vto=vfrom/24.0/365.2425;}) \
+    X(Year, Hour, {vto=vfrom*24.0*365.2425;}) \
+    X(Hour,  Day, {vto=vfrom/24.0;}) \
+    X(Day,  Hour, {vto=vfrom*24.0;}) \
+    X(Day,  Year, {vto=vfrom/365.2425;}) \
+    X(Year,  Day, {vto=vfrom*365.2425;}) \
+    X(WH,  KWH, {vto=vfrom/1000.0;})     \
+    X(KWH, GJ, {vto=vfrom*0.0036;})     \
+    X(KWH, MJ, {vto=vfrom*0.0036*1000.0;})     \
+    X(GJ,  KWH,{vto=vfrom/0.0036;}) \
+    X(MJ,  GJ, {vto=vfrom/1000.0;}) \
+    X(MJ,  KWH,{vto=vfrom/1000.0/0.0036;}) \
+    X(GJ,  MJ, {vto=vfrom*1000.0;}) \
+    X(W,   KW, {vto=vfrom/1000.0;})     \
+    X(JH,   W, {vto=vfrom/3600.0;}) \
+    X(W,   JH, {vto=vfrom*3600.0;}) \
+    X(MJH, KW, {vto=vfrom/1000.0/0.0036;}) \
+    X(KW,  MJH,{vto=vfrom*0.0036*1000.0;})\
+    X(M3,  L,  {vto=vfrom*1000.0;}) \
+    X(M3H, LH, {vto=vfrom*1000.0;}) \
+    X(L,   M3, {vto=vfrom/1000.0;}) \
+    X(LH,  M3H,{vto=vfrom/1000.0;}) \
+    X(C,   K,  {vto=vfrom+273.15;}) \
+    X(K,   C,  {vto=vfrom-273.15;}) \
+    X(C,   F,  {vto=(vfrom*9.0/5.0)+32.0;}) \
+    X(F,   C,  {vto=(vfrom-32)*5.0/9.0;}) \
+    X(PA,  BAR,{vto=vfrom/100000.0;}) \
+    X(BAR, PA, {vto=vfrom*100000.0;}) \
+    X(COUNTER, FACTOR,{vto=vfrom;})  \
+    X(FACTOR, COUNTER, {vto=vfrom;}) \
+    X(COUNTER, NUMBER,{vto=vfrom;})  \
+    X(NUMBER, COUNTER, {vto=vfrom;}) \
+    X(FACTOR, NUMBER, {vto=vfrom;})  \
+    X(NUMBER, FACTOR, {vto=vfrom;}) \
+    X(PERCENTAGE, NUMBER, {vto=vfrom;})  \
+    X(NUMBER, PERCENTAGE, {vto=vfrom;}) \
+    X(UnixTimestamp,DateTimeLT, {vto=vfrom; }) \
+    X(DateTimeLT,UnixTimestamp, {vto=vfrom; }) \
+    X(DateLT,UnixTimestamp, {vto=vfrom; }) \
+    X(DateTimeLT, DateLT, {vto=vfrom; }) \
+    X(DateLT, DateTimeLT, {vto=vfrom; }) \
+    X(DEGREE, RADIAN, {vto=vfrom*M_PI/180.0;}) \
+    X(RADIAN, DEGREE, {vto=vfrom*180.0/M_PI;}) \
+
+
+static const double TOLERANCE = 1e-15;
+
+static bool baselineCanConvert(Unit ufrom, Unit uto)
+{
+    if (ufrom == uto) return true;
+#define X(from,to,code) if (Unit::from == ufrom && Unit::to == uto) return true;
+BASELINE_CONVERSIONS
+#undef X
+    return false;
+}
+
+static double baselineConvert(double vfrom, Unit ufrom, Unit uto)
+{
+    double vto = -4711.0;
+    if (ufrom == uto) { { vto = vfrom; } return vto; }
+#define X(from,to,code) if (Unit::from == ufrom && Unit::to == uto) { code return vto; }
+BASELINE_CONVERSIONS
+#undef X
+    return NAN;
+}
+
+int main()
+{
+    const double values[] = {0, 1, -1, 0.5, 3.7, 12345.678, 1e-7, 273.15, -40, 100, 32, 212, 98.6, 1e9, 4711.0815, 0.001, -1e12};
+    int units = (int)Unit::Unknown + 1;
+    long pairs = 0;
+    long checked = 0;
+    long different = 0;
+    long failed = 0;
+    double worst = 0;
+    for (int a = 0; a < units; a++)
+    {
+        for (int b = 0; b < units; b++)
+        {
+            Unit from = (Unit)a;
+            Unit to = (Unit)b;
+            bool expected = baselineCanConvert(from, to);
+            if (canConvert(from, to) != expected)
+            {
+                if (failed++ < 10)
+                    printf("  canConvert %s to %s: expected %d\n", unitToStringLowerCase(from).c_str(), unitToStringLowerCase(to).c_str(), expected);
+                continue;
+            }
+            if (!expected) continue;
+
+            pairs++;
+            for (double v : values)
+            {
+                for (int k = 0; k < 200; k++)
+                {
+                    double x = v * (1 + k * 1e-3) + k;
+                    double old_value = baselineConvert(x, from, to);
+                    double new_value = convert(x, from, to);
+                    checked++;
+                    if (new_value == old_value) continue;
+
+                    different++;
+                    double error = fabs(new_value - old_value) / std::max(fabs(x), fabs(old_value));
+                    worst = std::max(worst, error);
+                    if (error > TOLERANCE && failed++ < 10)
+                        printf("  %s to %s of %.17g: expected %.17g, got %.17g\n", unitToStringLowerCase(from).c_str(),
+                               unitToStringLowerCase(to).c_str(), x, old_value, new_value);
+                }
+            }
+        }
+    }
+    printf("  %ld convertible pairs, %ld values checked, %ld differ by rounding, worst %.2g, %ld failed\n",
+           pairs, checked, different, worst, failed);
+    return failed != 0;
+}